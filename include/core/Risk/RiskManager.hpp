@@ -1,63 +1,245 @@
 #pragma once
 
+#include <array>
 #include <atomic>
-#include <mutex>
-#include <iostream>
 #include <cmath>
-#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/models/Order.hpp"
+#include "core/models/PositionBook.hpp"
+#include "core/models/SymbolRegistry.hpp"
+#include "utils/Clock.hpp"
+#include "utils/Metrics.hpp"
 
 namespace TradingSystem {
 
+/// @brief Outcome of a pre-trade check; everything but Accepted is a rejection reason.
+enum class RiskCheck : uint8_t {
+    Accepted = 0,
+    StrategyHalted,
+    InvalidOrder,
+    OrderSize,
+    PriceBand,
+    SymbolNotional,
+    CurrencyNotional,
+    OrderRate,
+    Count
+};
+
+/// @brief Metric-style name of a check outcome, e.g. "price_band".
+const char* toString(RiskCheck check) noexcept;
+
+/// @brief Per-symbol limits. Defaults leave every check open.
+struct SymbolRiskLimits {
+    static constexpr double kUnlimited = std::numeric_limits<double>::max();
+
+    double maxOrderNotional = kUnlimited;      // quantity * price of one order
+    double maxPositionNotional = kUnlimited;   // |net quantity after the order| * price
+    double priceBandBps = kUnlimited;          // max distance from the reference price
+    uint32_t maxOrdersPerSecond = UINT32_MAX;
+};
+
 /// @brief RiskManager monitors positions and ensures risk controls.
+///
+/// The pre-trade check takes no lock and does no I/O: limits are relaxed atomics any
+/// thread may change at runtime, positions and currency exposure are read from a
+/// PositionBook snapshot, and each rejection bumps a per-reason atomic instead of
+/// printing. Exporting those to Metrics is left to publishMetrics(), off the check
+/// path. Checks may run on several threads; the order-rate throttles are then
+/// approximate by a few orders at window boundaries.
+///
+/// Position and currency caps apply to booked fills plus the order being checked.
+/// Notionals are in the symbol's quote currency; currency caps in the currency's own units.
 class RiskManager {
 public:
-    RiskManager(double capital)
-        : allocatedCapital_(capital), currentDrawdown_(0.0), isStrategyActive_(true) {}
-
-    /// @brief Pre-trade risk control: evaluates if a new order is permissible.
-    bool evaluateOrderRisk(double potentialOrderSize, double volatilityFactor) {
-        std::lock_guard<std::mutex> lock(riskMutex_);
-        // Example condition: no order should exceed 5% of allocated capital when volatility is high.
-        if (potentialOrderSize > allocatedCapital_ * 0.05 * volatilityFactor) {
-            std::cerr << "RiskManager: Order size exceeds risk limits.\n";
+    static constexpr double kUnlimited = SymbolRiskLimits::kUnlimited;
+
+    /// @param capital    allocated capital, for the drawdown halt and evaluateOrderRisk()
+    /// @param positions  booked positions for the position and currency caps; may be null
+    explicit RiskManager(double capital, const PositionBook* positions = nullptr,
+                         std::size_t maxSymbols = symbolRegistry().capacity());
+
+    RiskManager(const RiskManager&) = delete;
+    RiskManager& operator=(const RiskManager&) = delete;
+
+    /// @brief Pre-trade risk control. Checks are ordered cheapest first; the throttles
+    /// run last so an order rejected for another reason does not use up rate budget.
+    inline RiskCheck check(SymbolId symbol, bool isBuy, double quantity, double price,
+                           uint64_t nowTicks = TscClock::now()) noexcept {
+        if (halted_.load(std::memory_order_acquire)) return reject(RiskCheck::StrategyHalted);
+        if (symbol >= maxSymbols_ || !(quantity > 0.0) || !(price > 0.0)) return reject(RiskCheck::InvalidOrder);
+
+        SymbolState& s = symbols_[symbol];
+        const double notional = quantity * price;
+        if (notional > s.maxOrderNotional.load(std::memory_order_relaxed)
+            || notional > maxOrderNotional_.load(std::memory_order_relaxed)) {
+            return reject(RiskCheck::OrderSize);
+        }
+
+        const double bandBps = s.priceBandBps.load(std::memory_order_relaxed);
+        if (bandBps < kUnlimited) {
+            // No reference yet means no fat-finger protection: fail closed.
+            const double reference = s.referencePrice.load(std::memory_order_relaxed);
+            if (!(reference > 0.0) || std::fabs(price - reference) > reference * bandBps * 1e-4) {
+                return reject(RiskCheck::PriceBand);
+            }
+        }
+
+        if (positions_ != nullptr) {
+            const double signedQty = isBuy ? quantity : -quantity;
+            const PositionSnapshot p = positions_->snapshot(symbol);
+            if (std::fabs(p.netQuantity + signedQty) * price > s.maxPositionNotional.load(std::memory_order_relaxed)) {
+                return reject(RiskCheck::SymbolNotional);
+            }
+            const PositionBook::CurrencyId base = positions_->baseCurrency(symbol);
+            if (base != PositionBook::kInvalidCurrency) {
+                const PositionBook::CurrencyId quote = positions_->quoteCurrency(symbol);
+                if (std::fabs(positions_->exposure(base) + signedQty) > currencyLimit(base)
+                    || std::fabs(positions_->exposure(quote) - signedQty * price) > currencyLimit(quote)) {
+                    return reject(RiskCheck::CurrencyNotional);
+                }
+            }
+        }
+
+        // Per-symbol first: an order that symbol's throttle turns away must not use up the
+        // global budget, and one the global throttle turns away gives its symbol token back.
+        if (!s.rate.admit(nowTicks, ticksPerSecond_)) return reject(RiskCheck::OrderRate);
+        if (!globalRate_.admit(nowTicks, ticksPerSecond_)) {
+            s.rate.refund();
+            return reject(RiskCheck::OrderRate);
+        }
+        return RiskCheck::Accepted;
+    }
+
+    inline RiskCheck check(const Order& order, uint64_t nowTicks = TscClock::now()) noexcept {
+        return check(order.getSymbolId(), order.getSide() == OrderSide::BUY, order.getQuantity(), order.getPrice(),
+                     nowTicks);
+    }
+
+    /// @brief Coarse size check against allocated capital, scaled by volatility.
+    inline bool evaluateOrderRisk(double potentialOrderSize, double volatilityFactor) noexcept {
+        // No order should exceed 5% of allocated capital when volatility is high.
+        if (potentialOrderSize > allocatedCapital_.load(std::memory_order_relaxed) * 0.05 * volatilityFactor) {
+            reject(RiskCheck::OrderSize);
             return false;
         }
         return true;
     }
 
-    /// @brief Real-time risk engine: updates positions with fill executions.
-    void updatePosition(double pnlChange) {
-        std::lock_guard<std::mutex> lock(riskMutex_);
-        currentPnL_ += pnlChange;
-        updateDrawdown();
+    /// @brief Real-time risk engine: fold a fill's PnL in. Halts the strategy as soon as
+    /// the drawdown limit is crossed, so the order path stops without waiting for a monitor.
+    void updatePosition(double pnlChange) noexcept;
+
+    /// @brief Checks if strategy should be disabled due to drawdown. Never blocks the order path.
+    [[nodiscard]] inline bool isStrategyAllowed() const noexcept { return !halted_.load(std::memory_order_acquire); }
+
+    /// @brief Kill switch: reject every order until the process restarts.
+    inline void halt() noexcept { halted_.store(true, std::memory_order_release); }
+
+    [[nodiscard]] inline double currentPnL() const noexcept { return pnl_.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline double currentDrawdown() const noexcept { return -minPnL_.load(std::memory_order_relaxed); }
+
+    // Limits: any thread, any time.
+    void setSymbolLimits(SymbolId symbol, const SymbolRiskLimits& limits) noexcept;
+    /// @return false if the currency is unknown to the position book.
+    bool setCurrencyLimit(std::string_view currency, double maxAbsExposure) noexcept;
+    inline void setMaxOrderNotional(double limit) noexcept { maxOrderNotional_.store(limit, std::memory_order_relaxed); }
+    inline void setMaxOrdersPerSecond(uint32_t limit) noexcept { globalRate_.limit.store(limit, std::memory_order_relaxed); }
+    /// @param fraction drawdown, as a fraction of capital, that halts the strategy (default 3%)
+    inline void setMaxDrawdown(double fraction) noexcept { maxDrawdownFraction_.store(fraction, std::memory_order_relaxed); }
+
+    /// @brief Reference for the price band, usually the mid from market data.
+    inline void updateReferencePrice(SymbolId symbol, double price) noexcept {
+        if (symbol < maxSymbols_) symbols_[symbol].referencePrice.store(price, std::memory_order_relaxed);
     }
-    
-    /// @brief Checks if strategy should be disabled due to drawdown.
-    bool isStrategyAllowed() {
-        std::lock_guard<std::mutex> lock(riskMutex_);
-        if (currentDrawdown_ > allocatedCapital_ * 0.03) {  // 3% max drawdown
-            isStrategyActive_ = false;
-        }
-        return isStrategyActive_;
+
+    /// @brief Rejections so far, per reason, for the metrics exporter.
+    [[nodiscard]] inline uint64_t rejections(RiskCheck reason) const noexcept {
+        return rejections_[static_cast<std::size_t>(reason)].load(std::memory_order_relaxed);
     }
+    [[nodiscard]] uint64_t totalRejections() const noexcept;
+
+    /// @brief Register one counter per reason in `metrics`, named "<prefix>.<reason>"
+    /// (e.g. "risk.rejected.price_band"), for publishMetrics() to fill. Startup only:
+    /// call it before any thread runs publishMetrics().
+    void attachMetrics(Metrics& metrics, std::string_view prefix = "risk.rejected");
+
+    /// @brief Add the rejections since the last call to the attached counters. Counting
+    /// into Metrics may lock on a thread's first add, so this belongs on a monitor or
+    /// exporter thread, never on the check path; call it from one thread at a time.
+    void publishMetrics() noexcept;
 
 private:
-    /// @brief Updates maximum drawdown based on current PnL.
-    void updateDrawdown() {
-        // For demonstration, we assume currentPnL_ is negative when drawing down.
-        if (currentPnL_ < minPnL_) {
-            minPnL_ = currentPnL_;
-            currentDrawdown_ = allocatedCapital_ - (allocatedCapital_ + minPnL_);
-            std::cerr << "RiskManager: Updated drawdown: " << currentDrawdown_ << "\n";
+    // Fixed one-second window. The thread that sees the window expire restarts it.
+    struct Throttle {
+        std::atomic<uint64_t> windowStart{0};
+        std::atomic<uint32_t> count{0};
+        std::atomic<uint32_t> limit{UINT32_MAX};
+
+        inline bool admit(uint64_t now, uint64_t window) noexcept {
+            const uint32_t max = limit.load(std::memory_order_relaxed);
+            if (max == UINT32_MAX) return true;
+            uint64_t start = windowStart.load(std::memory_order_relaxed);
+            if (now >= start + window && windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+                count.store(0, std::memory_order_relaxed);
+            }
+            return count.fetch_add(1, std::memory_order_relaxed) < max;
+        }
+
+        // Give back a token admit() just granted. Never below zero: the window may have
+        // restarted in between.
+        inline void refund() noexcept {
+            uint32_t n = count.load(std::memory_order_relaxed);
+            while (n > 0 && !count.compare_exchange_weak(n, n - 1, std::memory_order_relaxed)) {
+            }
         }
+    };
+
+    // Everything one check touches for a symbol, on one cache line.
+    struct alignas(kCacheLineSize) SymbolState {
+        std::atomic<double> maxOrderNotional{kUnlimited};
+        std::atomic<double> maxPositionNotional{kUnlimited};
+        std::atomic<double> priceBandBps{kUnlimited};
+        std::atomic<double> referencePrice{0.0};
+        Throttle rate;
+    };
+    static_assert(sizeof(SymbolState) == kCacheLineSize);
+
+    inline RiskCheck reject(RiskCheck reason) noexcept {
+        rejections_[static_cast<std::size_t>(reason)].fetch_add(1, std::memory_order_relaxed);
+        return reason;
     }
 
-    double allocatedCapital_;
-    double currentPnL_ {0.0};
-    double minPnL_ {0.0};
-    double currentDrawdown_;
-    bool isStrategyActive_;
-    std::mutex riskMutex_;
+    [[nodiscard]] inline double currencyLimit(PositionBook::CurrencyId currency) const noexcept {
+        return currency < maxCurrencies_ ? currencyLimits_[currency].load(std::memory_order_relaxed) : kUnlimited;
+    }
+
+    const PositionBook* positions_;
+    const std::size_t maxSymbols_;
+    const std::size_t maxCurrencies_;
+    const uint64_t ticksPerSecond_;
+    std::unique_ptr<SymbolState[]> symbols_;                  // symbols_[symbol]
+    std::unique_ptr<std::atomic<double>[]> currencyLimits_;   // by PositionBook currency id
+
+    std::atomic<bool> halted_{false};
+    std::atomic<double> maxOrderNotional_{kUnlimited};
+    alignas(kCacheLineSize) Throttle globalRate_;
+
+    // Written by fills, read by monitors.
+    alignas(kCacheLineSize) std::atomic<double> allocatedCapital_;
+    std::atomic<double> maxDrawdownFraction_{0.03};
+    std::atomic<double> pnl_{0.0};
+    std::atomic<double> minPnL_{0.0};
+
+    alignas(kCacheLineSize) std::array<std::atomic<uint64_t>, static_cast<std::size_t>(RiskCheck::Count)> rejections_{};
+    // Owned by the publishMetrics() caller.
+    std::array<Counter, static_cast<std::size_t>(RiskCheck::Count)> rejectCounters_{};   // unattached: no-ops
+    std::array<uint64_t, static_cast<std::size_t>(RiskCheck::Count)> published_{};
 };
 
 } // namespace TradingSystem
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace TradingSystem {
+
+/// @brief Cache line size used to keep producer and consumer indices on separate lines.
+/// Pinned to 64 bytes (x86-64 / most ARM cores) rather than relying on
+/// std::hardware_destructive_interference_size, which is not portable across toolchains.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/// @brief Hint to the CPU that we are in a spin loop (PAUSE on x86, YIELD on ARM).
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// ============================================================================
+// Wait policies
+//
+// A policy decides what an idle consumer does while the ring is empty.
+// `waitUntil(ready, signal)` returns once `ready()` is true; `notify(signal)` is
+// called by producers after every successful push.
+// ============================================================================
+
+/// @brief Spin on the core without ever yielding. Lowest latency; burns a dedicated core.
+struct BusySpinWait {
+    template <typename Ready>
+    static void waitUntil(Ready&& ready, std::atomic<uint32_t>&) noexcept {
+        while (!ready()) cpuRelax();
+    }
+    static void notify(std::atomic<uint32_t>&) noexcept {}
+};
+
+/// @brief Spin for a short burst, then yield the time slice between polls.
+struct SpinYieldWait {
+    static constexpr uint32_t kSpinLimit = 256;
+
+    template <typename Ready>
+    static void waitUntil(Ready&& ready, std::atomic<uint32_t>&) noexcept {
+        uint32_t spins = 0;
+        while (!ready()) {
+            if (spins < kSpinLimit) {
+                ++spins;
+                cpuRelax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+    static void notify(std::atomic<uint32_t>&) noexcept {}
+};
+
+/// @brief Spin briefly, then park on a futex-backed epoch counter (C++20 atomic wait).
+/// No mutex is involved; producers bump the epoch after publishing an element.
+struct BlockingWait {
+    static constexpr uint32_t kSpinLimit = 64;
+
+    template <typename Ready>
+    static void waitUntil(Ready&& ready, std::atomic<uint32_t>& signal) noexcept {
+        for (uint32_t spins = 0; spins < kSpinLimit; ++spins) {
+            if (ready()) return;
+            cpuRelax();
+        }
+        for (;;) {
+            // Read the epoch *before* re-checking so a push that lands in between
+            // changes the value we park on and wakes us immediately.
+            const uint32_t seen = signal.load(std::memory_order_acquire);
+            if (ready()) return;
+            signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+    static void notify(std::atomic<uint32_t>& signal) noexcept {
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+    }
+};
+
+// ============================================================================
+// Rings
+// ============================================================================
+
+/// @brief Bounded single-producer / single-consumer ring.
+/// Each side caches the other side's index so the common case touches only its own cache line.
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>,
+                  "Ring elements must be nothrow default-constructible and copy-assignable");
+
+public:
+    using value_type = T;
+    static constexpr std::size_t kCapacity = Capacity;
+
+    SpscRing() : slots_(std::make_unique<T[]>(Capacity)) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /// @brief Producer side. Returns false if the ring is full.
+    [[nodiscard]] bool tryPush(const T& value) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ == Capacity) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ == Capacity) return false;
+        }
+        slots_[tail & kMask] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Consumer side. Returns false if the ring is empty.
+    [[nodiscard]] bool tryPop(T& out) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_) return false;
+        }
+        out = std::move(slots_[head & kMask]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Approximate occupancy; exact only when called from a quiescent state.
+    [[nodiscard]] std::size_t sizeApprox() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};  // written by consumer
+    std::size_t tailCache_ = 0;                                  // consumer's view of tail_
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};  // written by producer
+    std::size_t headCache_ = 0;                                  // producer's view of head_
+    alignas(kCacheLineSize) std::unique_ptr<T[]> slots_;
+};
+
+/// @brief Bounded multi-producer / single-consumer ring (Vyukov sequence-numbered slots).
+/// Producers claim a slot with one CAS on the tail; the consumer never performs an RMW.
+template <typename T, std::size_t Capacity>
+class MpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>,
+                  "Ring elements must be nothrow default-constructible and copy-assignable");
+
+public:
+    using value_type = T;
+    static constexpr std::size_t kCapacity = Capacity;
+
+    MpscRing() : slots_(std::make_unique<Slot[]>(Capacity)) {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /// @brief Safe to call from any number of producer threads. Returns false if the ring is full.
+    [[nodiscard]] bool tryPush(const T& value) noexcept {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & kMask];
+            const std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Single consumer only. Returns false if the ring is empty.
+    [[nodiscard]] bool tryPop(T& out) noexcept {
+        const std::size_t pos = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & kMask];
+        const std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0) return false;
+        out = std::move(slot.value);
+        slot.sequence.store(pos + Capacity, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// @brief Approximate occupancy; exact only when called from a quiescent state.
+    [[nodiscard]] std::size_t sizeApprox() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    // One slot per cache line so adjacent producers do not false-share.
+    struct alignas(kCacheLineSize) Slot {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};  // consumer-owned
+    alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};  // shared by producers
+    alignas(kCacheLineSize) std::unique_ptr<Slot[]> slots_;
+};
+
+// ============================================================================
+// Queue facade
+// ============================================================================
+
+/// @brief Couples a ring with a wait policy and exposes the blocking/non-blocking queue API.
+/// @tparam Ring       SpscRing or MpscRing
+/// @tparam WaitPolicy BusySpinWait, SpinYieldWait or BlockingWait
+template <typename Ring, typename WaitPolicy = SpinYieldWait>
+class ConcurrentQueue {
+public:
+    using value_type = typename Ring::value_type;
+
+    ConcurrentQueue() = default;
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    /// @brief Non-blocking push. Returns false if the ring is full.
+    [[nodiscard]] bool tryPush(const value_type& value) noexcept {
+        if (!ring_.tryPush(value)) return false;
+        WaitPolicy::notify(signal_);
+        return true;
+    }
+
+    /// @brief Push, applying backpressure (spin, then yield) while the ring is full.
+    void push(const value_type& value) noexcept {
+        uint32_t spins = 0;
+        while (!ring_.tryPush(value)) {
+            if (++spins < SpinYieldWait::kSpinLimit) cpuRelax();
+            else std::this_thread::yield();
+        }
+        WaitPolicy::notify(signal_);
+    }
+
+    /// @brief Non-blocking pop. Returns false if the ring is empty.
+    [[nodiscard]] bool pop(value_type& out) noexcept { return ring_.tryPop(out); }
+
+    /// @brief Wait (per WaitPolicy) until an element is available.
+    void waitAndPop(value_type& out) noexcept {
+        WaitPolicy::waitUntil([&] { return ring_.tryPop(out); }, signal_);
+    }
+
+    /// @brief Wait until an element is available or `stop` is raised.
+    /// @return true if an element was popped, false if woken by `stop`.
+    [[nodiscard]] bool waitAndPop(value_type& out, const std::atomic<bool>& stop) noexcept {
+        bool popped = false;
+        WaitPolicy::waitUntil([&] {
+            popped = ring_.tryPop(out);
+            return popped || stop.load(std::memory_order_relaxed);
+        }, signal_);
+        return popped;
+    }
+
+    /// @brief Wake a parked consumer so it can observe a stop flag.
+    void wakeConsumer() noexcept {
+        signal_.fetch_add(1, std::memory_order_release);
+        signal_.notify_all();
+    }
+
+    [[nodiscard]] std::size_t sizeApprox() const noexcept { return ring_.sizeApprox(); }
+
+private:
+    Ring ring_;
+    alignas(kCacheLineSize) std::atomic<uint32_t> signal_{0};
+};
+
+} // namespace TradingSystem
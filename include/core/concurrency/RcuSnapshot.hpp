@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "LockFreeQueue.hpp"
+
+namespace TradingSystem {
+
+/// @brief Read-copy-update cell holding an immutable snapshot of T.
+///
+/// Readers are wait-free: read() registers in one of two reader counters, loads the
+/// current pointer and returns a guard that deregisters on destruction. Writers build
+/// a fresh T off the hot path and publish() it with an atomic pointer swap, then wait
+/// for every reader that could still hold the old snapshot before deleting it. The
+/// counters are flipped twice per publish (grace period) so a steady stream of new
+/// readers can never starve the writer. Writers are serialised by a mutex; only
+/// publishers ever touch it.
+///
+/// Guards are short-lived: hold one for the duration of a routing decision, not
+/// across a blocking call, or publishers will wait on you.
+template <typename T>
+class RcuSnapshot {
+public:
+    class ReadGuard {
+    public:
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard(ReadGuard&& other) noexcept : counter_(other.counter_), value_(other.value_) {
+            other.counter_ = nullptr;
+        }
+        ~ReadGuard() {
+            if (counter_) counter_->fetch_sub(1, std::memory_order_release);
+        }
+
+        [[nodiscard]] const T& operator*() const noexcept { return *value_; }
+        [[nodiscard]] const T* operator->() const noexcept { return value_; }
+        [[nodiscard]] const T* get() const noexcept { return value_; }
+
+    private:
+        friend class RcuSnapshot;
+        ReadGuard(std::atomic<uint64_t>* counter, const T* value) noexcept : counter_(counter), value_(value) {}
+
+        std::atomic<uint64_t>* counter_;
+        const T* value_;
+    };
+
+    explicit RcuSnapshot(std::unique_ptr<const T> initial) : current_(initial.release()) {}
+
+    ~RcuSnapshot() { delete current_.load(std::memory_order_acquire); }
+
+    RcuSnapshot(const RcuSnapshot&) = delete;
+    RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+
+    /// @brief Wait-free access to the current snapshot.
+    [[nodiscard]] ReadGuard read() const noexcept {
+        std::atomic<uint64_t>& counter = readers_[epoch_.load(std::memory_order_acquire) & 1].count;
+        // seq_cst so the registration is ordered before the pointer load (and the
+        // writer's exchange), which is what the grace period relies on.
+        counter.fetch_add(1, std::memory_order_seq_cst);
+        return ReadGuard(&counter, current_.load(std::memory_order_seq_cst));
+    }
+
+    /// @brief Swap in `next` and reclaim the previous snapshot once no reader holds it.
+    /// Blocks the caller for one grace period; never call it while holding a ReadGuard.
+    void publish(std::unique_ptr<const T> next) {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        const T* old = current_.exchange(next.release(), std::memory_order_seq_cst);
+        for (int flip = 0; flip < 2; ++flip) {
+            const uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+            waitForReaders(readers_[epoch & 1].count);
+        }
+        ++version_;
+        delete old;
+    }
+
+    /// @brief Number of snapshots published since construction.
+    [[nodiscard]] uint64_t version() const noexcept {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        return version_;
+    }
+
+private:
+    struct alignas(kCacheLineSize) ReaderCounter {
+        mutable std::atomic<uint64_t> count{0};
+    };
+
+    static void waitForReaders(const std::atomic<uint64_t>& counter) noexcept {
+        uint32_t spins = 0;
+        while (counter.load(std::memory_order_seq_cst) != 0) {
+            if (++spins < SpinYieldWait::kSpinLimit) cpuRelax();
+            else std::this_thread::yield();
+        }
+    }
+
+    std::atomic<const T*> current_;
+    alignas(kCacheLineSize) std::atomic<uint64_t> epoch_{0};
+    ReaderCounter readers_[2];
+    mutable std::mutex writerMutex_;
+    uint64_t version_ = 0;
+};
+
+} // namespace TradingSystem
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "LockFreeQueue.hpp"
+
+namespace TradingSystem {
+
+/// @brief Single-writer sequence lock around a small trivially copyable T.
+///
+/// The writer bumps the sequence to odd, stores the value, then bumps it to even;
+/// readers copy the value out and retry if the sequence was odd or moved meanwhile.
+/// Readers never block the writer and never see a half-written value. The value is
+/// kept as relaxed atomic words, so the racing copy is well defined.
+///
+/// store() must only be called from one thread at a time.
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock<T> copies T bytewise");
+    static_assert(sizeof(T) % sizeof(uint64_t) == 0, "pad T to a multiple of 8 bytes");
+
+    static constexpr std::size_t kWords = sizeof(T) / sizeof(uint64_t);
+    using Words = std::array<uint64_t, kWords>;
+
+public:
+    explicit Seqlock(const T& initial = T{}) noexcept {
+        const Words words = std::bit_cast<Words>(initial);
+        for (std::size_t i = 0; i < kWords; ++i) words_[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    void store(const T& value) noexcept {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        const Words words = std::bit_cast<Words>(value);
+        for (std::size_t i = 0; i < kWords; ++i) words_[i].store(words[i], std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    [[nodiscard]] T load() const noexcept {
+        Words words;
+        for (;;) {
+            const uint64_t before = seq_.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                for (std::size_t i = 0; i < kWords; ++i) words[i] = words_[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (seq_.load(std::memory_order_relaxed) == before) return std::bit_cast<T>(words);
+            }
+            cpuRelax();
+        }
+    }
+
+    /// @brief Completed writes so far.
+    [[nodiscard]] uint64_t version() const noexcept { return seq_.load(std::memory_order_acquire) / 2; }
+
+private:
+    std::atomic<uint64_t> seq_{0};
+    std::array<std::atomic<uint64_t>, kWords> words_;
+};
+
+} // namespace TradingSystem
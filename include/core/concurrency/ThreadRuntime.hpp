@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <pthread.h>
+
+#include "LockFreeQueue.hpp"
+
+namespace TradingSystem {
+
+/// @brief What a polling loop does when it finds no work.
+enum class IdlePolicy : uint8_t {
+    BusyPoll,    // pause and poll again; for isolated cores only
+    SpinYield,   // spin briefly, then yield the core
+    Sleep,       // spin briefly, then sleep for ThreadSpec::sleep
+};
+
+[[nodiscard]] std::string_view toString(IdlePolicy policy) noexcept;
+/// @return false (and leaves `out` alone) for an unknown name.
+bool parseIdlePolicy(std::string_view name, IdlePolicy& out) noexcept;
+
+/// @brief How one named thread should run. Defaults leave the thread as the OS made it.
+struct ThreadSpec {
+    std::string name;
+    int cpu = -1;                        // pin to this CPU; -1: unpinned
+    int priority = 0;                    // SCHED_FIFO priority (1-99) if permitted; 0: SCHED_OTHER.
+                                         // Pair it with a pinned, isolated CPU: a FIFO thread
+                                         // that busy-polls starves everything else on its core.
+    int numaNode = -1;                   // prefer memory from this node; -1: the node of `cpu`, if pinned
+    IdlePolicy idle = IdlePolicy::SpinYield;
+    std::chrono::microseconds sleep{100};
+};
+
+/// @brief The thread layout of the process, usually from the "threads" config section.
+struct ThreadTopology {
+    std::vector<ThreadSpec> threads;
+
+    /// @return the spec for `name`, or nullptr if the topology does not mention it.
+    [[nodiscard]] const ThreadSpec* find(std::string_view name) const noexcept;
+};
+
+/// @brief Per-thread idle loop following a ThreadSpec's policy.
+///
+/// Polling loops call idle() each time they come up empty and reset() when they find
+/// work, so a Sleep thread only sleeps once it has been idle for a while.
+class IdleStrategy {
+public:
+    IdleStrategy() noexcept = default;
+    IdleStrategy(IdlePolicy policy, std::chrono::microseconds sleep) noexcept : policy_(policy), sleep_(sleep) {}
+
+    /// @brief The policy of the calling thread, if ThreadRuntime started it; SpinYield otherwise.
+    [[nodiscard]] static IdleStrategy forCurrentThread() noexcept;
+
+    inline void idle() noexcept {
+        if (policy_ == IdlePolicy::BusyPoll || ++spins_ < SpinYieldWait::kSpinLimit) {
+            cpuRelax();
+        } else if (policy_ == IdlePolicy::SpinYield) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(sleep_);
+        }
+    }
+    inline void reset() noexcept { spins_ = 0; }
+
+    [[nodiscard]] IdlePolicy policy() const noexcept { return policy_; }
+
+private:
+    IdlePolicy policy_ = IdlePolicy::SpinYield;
+    std::chrono::microseconds sleep_{100};
+    uint32_t spins_ = 0;
+};
+
+/// @brief What a thread asked for, what it got, and what it has cost so far.
+struct ThreadStats {
+    std::string name;
+    int tid = 0;
+    bool running = false;
+    int requestedCpu = -1;
+    bool pinned = false;                 // affinity applied
+    bool realtime = false;               // SCHED_FIFO applied
+    int numaNode = -1;                   // preferred node applied; -1 if none
+    int lastCpu = -1;                    // CPU it last ran on
+    uint64_t cpuNanos = 0;               // user + system
+    uint64_t voluntarySwitches = 0;      // blocked or yielded
+    uint64_t involuntarySwitches = 0;    // preempted: the jitter to look for on a pinned thread
+};
+
+/// @brief Starts the process's long-lived threads by name and applies the topology.
+///
+/// start("zmq_listener", fn) returns an ordinary std::thread, owned and joined by the
+/// caller as before. Before running `fn` the new thread names itself (visible in top
+/// and perf), then applies its ThreadSpec: CPU affinity, SCHED_FIFO, and a preferred
+/// NUMA node so the memory it touches first is node-local. Each step is best effort;
+/// a step the host does not permit (no CAP_SYS_NICE, an offline CPU) is skipped and
+/// shows in stats(). Threads not named in the topology run unpinned with the default
+/// idle policy, so components behave the same when no topology is configured.
+///
+/// stats() reads each thread's CPU time and context-switch counts from the kernel;
+/// a thread's final figures are kept after it exits.
+class ThreadRuntime {
+public:
+    ThreadRuntime() = default;
+    explicit ThreadRuntime(ThreadTopology topology) : topology_(std::move(topology)) {}
+
+    ThreadRuntime(const ThreadRuntime&) = delete;
+    ThreadRuntime& operator=(const ThreadRuntime&) = delete;
+
+    /// @brief Replace the topology. Applies to threads started afterwards.
+    void setTopology(ThreadTopology topology);
+    [[nodiscard]] ThreadSpec spec(std::string_view name) const;
+
+    template <typename Fn>
+    [[nodiscard]] std::thread start(std::string_view name, Fn&& fn) {
+        return start(spec(name), std::forward<Fn>(fn));
+    }
+
+    /// @brief Start with an explicit spec, e.g. the topology's with a caller override.
+    template <typename Fn>
+    [[nodiscard]] std::thread start(ThreadSpec spec, Fn&& fn) {
+        return std::thread(&ThreadRuntime::runThread, this, std::move(spec), std::function<void()>(std::forward<Fn>(fn)));
+    }
+
+    [[nodiscard]] std::vector<ThreadStats> stats() const;
+
+    /// @brief Apply `spec` to the calling thread (for threads not started here).
+    /// @return what was applied, with no usage figures.
+    static ThreadStats applyToCurrentThread(const ThreadSpec& spec);
+
+private:
+    struct Record {
+        ThreadStats stats;
+        pthread_t handle{};              // valid while running
+    };
+
+    void runThread(ThreadSpec spec, std::function<void()> fn);
+
+    mutable std::mutex mutex_;
+    ThreadTopology topology_;
+    std::vector<Record> records_;
+};
+
+/// @brief Process-wide runtime; empty topology until main configures one.
+ThreadRuntime& threadRuntime();
+
+} // namespace TradingSystem
@@ -2,11 +2,10 @@
 #include <atomic>
 #include <thread>
 #include <vector>
-#include <iostream>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
 #include "IOrderRouter.hpp"  // Provided interface stub
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
+#include "utils/Logger.hpp"
 #include <cstdint>
 
 namespace TradingSystem {
@@ -20,36 +19,13 @@ struct Order {
     // Additional fields can include venue, order type, etc.
 };
 
-/// @brief A lock-free-like order queue using a mutex-protected STL queue for demonstration.
-/// In production, replace this with a properly optimized lock-free queue.
-class OrderQueue {
-public:
-    void push(const Order& order) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        queue_.push(order);
-        cond_var_.notify_one();
-    }
-
-    bool pop(Order& order) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        if(queue_.empty()) return false;
-        order = queue_.front();
-        queue_.pop();
-        return true;
-    }
+/// @brief Bounded lock-free order queue feeding the execution worker.
+/// MPSC so several strategies can share one ExecutionManager; producers back off
+/// (spin, then yield) if the ring fills instead of growing it.
+using OrderQueue = ConcurrentQueue<MpscRing<Order, 4096>, SpinYieldWait>;
 
-    // Blocking pop for worker thread; production system would use busy-waiting with low latency.
-    void waitAndPop(Order& order) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        cond_var_.wait(lock, [&]{ return !queue_.empty(); });
-        order = queue_.front();
-        queue_.pop();
-    }
-private:
-    std::queue<Order> queue_;
-    std::mutex mutex_;
-    std::condition_variable cond_var_;
-};
+/// @brief SPSC variant for a dedicated signal -> execution path (one strategy, one worker).
+using SpscOrderQueue = ConcurrentQueue<SpscRing<Order, 4096>, SpinYieldWait>;
 
 /// @brief Implements the IExecutionManager interface with atomic triangular trade execution.
 class ExecutionManager : public IExecutionManager {
@@ -57,11 +33,12 @@ public:
     ExecutionManager(OrderQueue &orderQueue) 
         : orderQueue_(orderQueue), shutdownFlag_(false) {
             // Start a worker thread to process order executions asynchronously.
-            workerThread_ = std::thread(&ExecutionManager::orderProcessingLoop, this);
+            workerThread_ = threadRuntime().start("execution", [this] { orderProcessingLoop(); });
     }
 
     ~ExecutionManager() noexcept override {
         shutdownFlag_.store(true);
+        orderQueue_.wakeConsumer();
         if(workerThread_.joinable())
             workerThread_.join();
     }
@@ -75,10 +52,8 @@ public:
     /// @brief Callback for handling execution reports.
     void onExecutionReport(uint64_t orderId, double fillPrice, double fillQty) noexcept override {
         // Handle report asynchronously, update order statuses, risk positions, etc.
-        // For demonstration, we simply print the execution report.
-        std::cout << "Execution Report - OrderID: " << orderId 
-                  << ", Fill Price: " << fillPrice 
-                  << ", Fill Qty: " << fillQty << "\n";
+        // For demonstration, we simply log the execution report.
+        defaultLogger().info("Execution Report - OrderID: {}, Fill Price: {}, Fill Qty: {}", orderId, fillPrice, fillQty);
     }
 
 private:
@@ -86,7 +61,7 @@ private:
     void orderProcessingLoop() {
         while(!shutdownFlag_.load(std::memory_order_relaxed)) {
             Order order;
-            orderQueue_.waitAndPop(order);
+            if (!orderQueue_.waitAndPop(order, shutdownFlag_)) break;
             // Simulate atomic multi-leg execution:
             // In real implementation, the system would ensure all three legs
             // execute synchronously, with contingency plans for partial fills.
@@ -98,7 +73,7 @@ private:
         // Here you would interface with the exchange/trading venue,
         // use smart order routing (SOR), and prepare contingency logic.
         // This is a simulation of a sub-millisecond end-to-end execution.
-        std::cout << "Processing Order: " << order.id << "\n";
+        defaultLogger().info("Processing Order: {}", order.id);
         // Simulate an execution delay (ultra-low latency simulation).
         // In production, such delays are measured in microseconds.
         onExecutionReport(order.id, order.price, order.quantity);
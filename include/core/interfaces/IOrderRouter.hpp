@@ -1,19 +1,19 @@
 #pragma once
 
 #include <string>
-// Use a fixed‑width string type or fixed‑size char array for symbol fields in ultra‑low latency contexts.
-// For now we use std::string for ease of use.
 #include <vector>
 #include <memory>
 #include <cstdint>
 
+#include "core/models/SymbolRegistry.hpp"
+
 namespace TradingSystem {
 
 // Include an order identifier inside Order for consistency across the system.
-// In a production system, you might want to use a union or a fixed‑buffer for the symbol.
+// The symbol is an interned id (see SymbolRegistry.hpp), so orders copy without allocating.
 struct Order {
     uint64_t orderId;      // Unique identifier for the order
-    std::string symbol;    // Could be replaced with a fixed-length string or string_view with careful lifetime management
+    SymbolId symbol;
     double price;
     double quantity;
     bool isBuy;
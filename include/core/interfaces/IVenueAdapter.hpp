@@ -17,8 +17,8 @@ public:
     // Acknowledgement callback ideally should be minimal overhead and asynchronous.
     virtual void onOrderAcknowledgement(uint64_t orderId) noexcept = 0;
     
-    // Returns the venue name – consider caching this value if it’s used frequently.
-    virtual std::string venueName() const noexcept = 0;
+    // Interned venue id; venueName(venueId()) gives the name for logging.
+    virtual VenueId venueId() const noexcept = 0;
 };
 
 } // namespace TradingSystem
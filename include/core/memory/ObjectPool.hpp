@@ -0,0 +1,170 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+
+namespace TradingSystem {
+
+/// @brief Per-thread slab pool of T with recycled slots.
+///
+/// Objects are constructed in place in fixed-size slabs and their slots go back on a
+/// free list when released, so once a thread has reserved its working set, acquire()
+/// and release() never call malloc. A slab is added only when the free list runs dry.
+///
+/// A pool belongs to the thread that constructed it; local() gives each thread its
+/// own. The owner acquires and releases through a plain free list; any other thread
+/// may release an object too (an order that crossed a queue), which pushes the slot
+/// onto the owner's lock-free remote list. The owner takes that whole list back in one
+/// exchange when its own list is empty.
+///
+/// Objects must be released before their owning thread exits; a pool that still has
+/// objects out when it is destroyed leaks its slabs rather than free them under a user.
+template <typename T, std::size_t SlabSize = 256>
+class ObjectPool {
+    static_assert(SlabSize > 0, "slabs must hold at least one object");
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Slot* next;
+        ObjectPool* owner;
+    };
+    static_assert(std::is_standard_layout_v<Slot>, "Slot must start with the object");
+
+public:
+    /// @brief RAII owner of one pooled object; releases it on destruction.
+    class Handle {
+    public:
+        Handle() noexcept = default;
+        explicit Handle(T* object) noexcept : object_(object) {}
+        Handle(Handle&& other) noexcept : object_(std::exchange(other.object_, nullptr)) {}
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                object_ = std::exchange(other.object_, nullptr);
+            }
+            return *this;
+        }
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        ~Handle() { reset(); }
+
+        [[nodiscard]] T* get() const noexcept { return object_; }
+        [[nodiscard]] T& operator*() const noexcept { return *object_; }
+        [[nodiscard]] T* operator->() const noexcept { return object_; }
+        explicit operator bool() const noexcept { return object_ != nullptr; }
+
+        /// @brief Give up ownership, e.g. to pass the raw pointer through a ring.
+        [[nodiscard]] T* detach() noexcept { return std::exchange(object_, nullptr); }
+
+        void reset() noexcept {
+            if (object_) ObjectPool::release(std::exchange(object_, nullptr));
+        }
+
+    private:
+        T* object_ = nullptr;
+    };
+
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ~ObjectPool() {
+        if (outstanding() != 0) {
+            for (auto& slab : slabs_) (void)slab.release();
+        }
+    }
+
+    /// @brief The calling thread's pool.
+    static ObjectPool& local() noexcept {
+        thread_local ObjectPool pool;
+        return pool;
+    }
+
+    /// @brief Grow until at least `count` objects fit without further allocation. Startup only.
+    void reserve(std::size_t count) {
+        while (capacity_ < count) addSlab();
+    }
+
+    /// @brief Construct a T in a recycled slot. Allocates only if every slot is in use.
+    template <typename... Args>
+    [[nodiscard]] T* acquire(Args&&... args) {
+        if (free_ == nullptr) {
+            free_ = remoteFree_.exchange(nullptr, std::memory_order_acquire);
+            if (free_ == nullptr) addSlab();
+        }
+        Slot* slot = free_;
+        free_ = slot->next;
+        ++acquired_;
+        return ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    [[nodiscard]] Handle make(Args&&... args) {
+        return Handle(acquire(std::forward<Args>(args)...));
+    }
+
+    /// @brief Destroy `object` and return its slot to the pool it came from, from any thread.
+    static void release(T* object) noexcept {
+        if (object == nullptr) return;
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        ObjectPool* owner = slot->owner;
+        if (owner->ownerThread_ == std::this_thread::get_id()) {
+            slot->next = owner->free_;
+            owner->free_ = slot;
+            ++owner->releasedLocal_;
+            return;
+        }
+        Slot* head = owner->remoteFree_.load(std::memory_order_relaxed);
+        do {
+            slot->next = head;
+        } while (!owner->remoteFree_.compare_exchange_weak(head, slot, std::memory_order_release,
+                                                           std::memory_order_relaxed));
+        owner->releasedRemote_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] std::size_t slabCount() const noexcept { return slabs_.size(); }
+
+    /// @brief Objects acquired from this pool and not yet released.
+    [[nodiscard]] std::size_t outstanding() const noexcept {
+        return acquired_ - releasedLocal_ - releasedRemote_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void addSlab() {
+        auto slab = std::make_unique<Slot[]>(SlabSize);
+        // Thread the new slots onto the free list in address order.
+        for (std::size_t i = 0; i < SlabSize; ++i) {
+            slab[i].owner = this;
+            slab[i].next = i + 1 < SlabSize ? &slab[i + 1] : free_;
+        }
+        free_ = &slab[0];
+        slabs_.push_back(std::move(slab));
+        capacity_ += SlabSize;
+    }
+
+    const std::thread::id ownerThread_ = std::this_thread::get_id();
+
+    // Owner thread only.
+    Slot* free_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t acquired_ = 0;
+    std::size_t releasedLocal_ = 0;
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+
+    // Pushed by other threads, drained by the owner.
+    alignas(kCacheLineSize) std::atomic<Slot*> remoteFree_{nullptr};
+    std::atomic<std::size_t> releasedRemote_{0};
+};
+
+} // namespace TradingSystem
@@ -0,0 +1,134 @@
+// CurrencyGraph.hpp
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TradeLeg.hpp"
+
+namespace TradingSystem {
+
+/// @brief One conversion step of a cycle: sell `from`, receive `to` through `pair`.
+struct CycleLeg {
+    uint16_t from = 0;
+    uint16_t to = 0;
+    uint32_t pair = 0;
+    bool sellBase = false;  // true: from == base (hit the bid); false: from == quote (lift the ask)
+    double rate = 0.0;      // units of `to` received per unit of `from`
+};
+
+/// @brief A profitable closed conversion cycle, starting and ending in legs[0].from.
+struct ArbitrageOpportunity {
+    static constexpr std::size_t kMaxLegs = 4;
+
+    std::array<CycleLeg, kMaxLegs> legs{};
+    uint8_t length = 0;
+    double logProfit = 0.0;  // sum of log-rates; exp(logProfit) - 1 is the gross return
+
+    [[nodiscard]] inline bool uses(uint16_t from, uint16_t to) const noexcept {
+        for (uint8_t i = 0; i < length; ++i) {
+            if (legs[i].from == from && legs[i].to == to) return true;
+        }
+        return false;
+    }
+};
+
+/// @brief Dense log-rate graph over N currencies with incremental cycle detection.
+///
+/// Every quoted pair BASE/QUOTE contributes two directed edges:
+///   w[base][quote] = log(bid)     and     w[quote][base] = -log(ask)
+/// so a cycle is profitable when the sum of its edge weights exceeds `minLogProfit`
+/// (set it to the round-trip cost in log terms). Weights live in a row-major N x N
+/// matrix plus its transpose, which makes the 3-cycle scan for a changed edge u->v
+///   w[u][v] + w[v][k] + w[k][u]   for every k
+/// two contiguous row reads. A quote only rechecks cycles through its own two edges:
+/// O(N) for triangles, O(N^2) when 4-cycles are enabled. Missing edges hold a large
+/// negative sentinel rather than -inf so the sums stay finite under -ffast-math.
+///
+/// The live opportunity list is kept sorted by profit and never grows past the
+/// capacity given at construction, so onQuote() does not allocate. When it is full,
+/// a better cycle evicts the worst one, and an evicted cycle is not remembered: it
+/// only comes back once a quote on one of its own edges rechecks it, even if later
+/// quotes free up room in the meantime. Size the capacity for the busiest market.
+class CurrencyGraph {
+public:
+    using CurrencyId = uint16_t;
+    using PairId = uint32_t;
+
+    /// @param maxCurrencies    upper bound on registered currencies (sizes the matrix)
+    /// @param maxCycleLength   3 (triangles only) or 4
+    /// @param minLogProfit     threshold a cycle's summed log-rate must exceed
+    /// @param maxOpportunities capacity of the ranked opportunity list
+    explicit CurrencyGraph(std::size_t maxCurrencies = 64, std::size_t maxCycleLength = 3,
+                           double minLogProfit = 0.0, std::size_t maxOpportunities = 64);
+
+    /// @brief Register (or look up) a currency code. Startup only.
+    /// @return kInvalidCurrency once maxCurrencies codes are registered.
+    CurrencyId addCurrency(const std::string& code);
+
+    /// @brief Register a pair written "BASE/QUOTE" (or "BASEQUOTE" for 3-letter codes) and
+    /// intern its symbol. Startup only.
+    /// @return kInvalidPair if the symbol cannot be parsed or the currency table is full.
+    PairId addPair(const std::string& symbol);
+
+    /// @brief Apply a top-of-book quote and recheck cycles through the pair's two edges.
+    /// Non-positive or crossed quotes are ignored.
+    /// @return number of live opportunities after the update.
+    std::size_t onQuote(PairId pair, double bid, double ask) noexcept;
+
+    /// @brief Live profitable cycles, best first.
+    [[nodiscard]] inline const std::vector<ArbitrageOpportunity>& opportunities() const noexcept { return live_; }
+
+    /// @brief Translate a cycle into executable legs for `notional` units of its start currency,
+    /// in the order ExecutionManager::setLegs expects them.
+    /// @return number of legs written to `out` (opp.length), or 0 for cycles longer than
+    /// kMaxExecutableLegs: ExecutionManager only runs triangles, so 4-cycles are reported
+    /// by opportunities() but cannot be traded yet.
+    std::size_t toTradeLegs(const ArbitrageOpportunity& opp, double notional,
+                            std::array<TradeLeg, ArbitrageOpportunity::kMaxLegs>& out) const;
+
+    [[nodiscard]] inline std::size_t currencyCount() const noexcept { return codes_.size(); }
+    [[nodiscard]] inline std::size_t pairCount() const noexcept { return pairs_.size(); }
+    [[nodiscard]] inline const std::string& currencyCode(CurrencyId id) const { return codes_.at(id); }
+    [[nodiscard]] inline const std::string& pairSymbol(PairId id) const { return pairs_.at(id).symbol; }
+    [[nodiscard]] inline SymbolId pairSymbolId(PairId id) const { return pairs_.at(id).id; }
+    [[nodiscard]] double logRate(CurrencyId from, CurrencyId to) const noexcept;
+    [[nodiscard]] inline uint64_t cyclesChecked() const noexcept { return cyclesChecked_; }
+
+    /// @brief Weight of a missing edge; any cycle through it is hopelessly unprofitable.
+    static constexpr double kNoEdge = -1e9;
+    static constexpr CurrencyId kInvalidCurrency = UINT16_MAX;
+    static constexpr std::size_t kMaxExecutableLegs = 3;
+    static constexpr PairId kInvalidPair = UINT32_MAX;
+
+private:
+    struct Pair {
+        std::string symbol;
+        SymbolId id;
+        CurrencyId base;
+        CurrencyId quote;
+    };
+
+    void recheckEdge(CurrencyId u, CurrencyId v) noexcept;
+    void consider(const CurrencyId* path, std::size_t length, double logProfit) noexcept;
+    void dropCyclesThrough(CurrencyId a, CurrencyId b) noexcept;
+    [[nodiscard]] inline std::size_t at(std::size_t from, std::size_t to) const noexcept { return from * stride_ + to; }
+
+    std::size_t stride_;
+    std::size_t maxCycleLength_;
+    double minLogProfit_;
+    std::size_t maxOpportunities_;
+
+    std::vector<std::string> codes_;
+    std::vector<Pair> pairs_;
+    std::vector<double> weight_;      // weight_[from * stride_ + to]
+    std::vector<double> transposed_;  // transposed_[to * stride_ + from]
+    std::vector<PairId> edgePair_;    // pair that realises each directed edge
+    std::vector<ArbitrageOpportunity> live_;
+    uint64_t cyclesChecked_ = 0;
+};
+
+} // namespace TradingSystem
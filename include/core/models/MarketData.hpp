@@ -5,6 +5,8 @@
 #include <chrono>
 #include <vector>
 
+#include "SymbolRegistry.hpp"
+
 namespace XAlgo::Data {
 
 struct PriceLevel {
@@ -12,13 +14,15 @@ struct PriceLevel {
     double volume = 0.0;
 };
 
+class OrderBook;
+
 struct OrderBookSnapshot {
     std::vector<PriceLevel> bids;
     std::vector<PriceLevel> asks;
 };
 
 struct MarketData {
-    std::string symbol; // e.g., "GBP/USD"
+    TradingSystem::SymbolId symbol_id = TradingSystem::kInvalidSymbol; // e.g. internSymbol("GBP/USD")
     double last_price = 0.0;
     double mid_price = 0.0;
     double bid_price = 0.0;
@@ -27,6 +31,9 @@ struct MarketData {
     double volume = 0.0;
 
     OrderBookSnapshot book;
+    // Non-owning pointer to the live incremental book (see OrderBook.hpp).
+    // Prefer live_book->topBids(n)/topAsks(n) over copying levels into `book`.
+    const OrderBook* live_book = nullptr;
     std::chrono::system_clock::time_point timestamp;
 };
 
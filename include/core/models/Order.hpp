@@ -3,16 +3,30 @@
 #include <string>
 #include <cstdint>
 #include <chrono>
+#include <type_traits>
+
+#include "SymbolRegistry.hpp"
+#include "utils/TraceContext.hpp"
 
 namespace TradingSystem {
 
 enum class OrderSide { BUY, SELL };
 enum class OrderType { MARKET, LIMIT };
 
+[[nodiscard]] constexpr OrderSide opposite(OrderSide side) noexcept {
+    return side == OrderSide::BUY ? OrderSide::SELL : OrderSide::BUY;
+}
+
+[[nodiscard]] constexpr const char* toString(OrderSide side) noexcept {
+    return side == OrderSide::BUY ? "buy" : "sell";
+}
+
+// Trivially copyable and assignable, so orders can be recycled in an ObjectPool
+// slot or copied through a ring without touching the heap.
 class Order final {
 public:
     Order(uint64_t id,
-          const std::string& symbol,
+          SymbolId symbol,
           double price,
           double quantity,
           OrderSide side,
@@ -26,7 +40,9 @@ public:
           timestamp_(std::chrono::high_resolution_clock::now()) {}
 
     [[nodiscard]] inline uint64_t getId() const noexcept { return id_; }
-    [[nodiscard]] inline const std::string& getSymbol() const noexcept { return symbol_; }
+    [[nodiscard]] inline SymbolId getSymbolId() const noexcept { return symbol_; }
+    // Registry lookup, for logging.
+    [[nodiscard]] inline const std::string& getSymbol() const noexcept { return symbolName(symbol_); }
     [[nodiscard]] inline double getPrice() const noexcept { return price_; }
     [[nodiscard]] inline double getQuantity() const noexcept { return quantity_; }
     [[nodiscard]] inline OrderSide getSide() const noexcept { return side_; }
@@ -35,14 +51,22 @@ public:
         return timestamp_;
     }
 
+    // Tick-to-trade stamps of the quote that triggered this order; inactive if untraced.
+    [[nodiscard]] inline const TraceContext& getTrace() const noexcept { return trace_; }
+    inline void setTrace(const TraceContext& trace) noexcept { trace_ = trace; }
+    inline void markTrace(TraceStage stage) noexcept { trace_.mark(stage); }
+
 private:
-    const uint64_t id_;
-    const std::string symbol_;
-    const double price_;
-    const double quantity_;
-    const OrderSide side_;
-    const OrderType type_;
-    const std::chrono::high_resolution_clock::time_point timestamp_;
+    uint64_t id_;
+    SymbolId symbol_;
+    double price_;
+    double quantity_;
+    OrderSide side_;
+    OrderType type_;
+    std::chrono::high_resolution_clock::time_point timestamp_;
+    TraceContext trace_{};
 };
 
+static_assert(std::is_trivially_copyable_v<Order>);
+
 } // namespace TradingSystem
@@ -0,0 +1,197 @@
+// OrderBook.hpp
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/models/MarketData.hpp"
+
+namespace XAlgo::Data {
+
+using PriceTicks = int64_t;
+
+enum class BookSide : uint8_t { BID, ASK };
+
+/// @brief L2 incremental update: set the aggregate volume at a price (0 removes the level).
+struct BookDelta {
+    BookSide side = BookSide::BID;
+    double price = 0.0;
+    double volume = 0.0;
+};
+
+class OrderBook;
+
+/// @brief Non-owning, allocation-free view over the best `depth` levels of one side.
+/// Iterating yields PriceLevel values computed on the fly from the live book, so
+/// consumers (e.g. MarketData::live_book) never copy the ladder.
+class BookView {
+public:
+    class Iterator {
+    public:
+        Iterator(const OrderBook* book, BookSide side, int32_t index, uint32_t remaining) noexcept
+            : book_(book), side_(side), index_(index), remaining_(remaining) {}
+
+        PriceLevel operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        bool operator==(const Iterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const noexcept { return !(*this == other); }
+
+    private:
+        const OrderBook* book_;
+        BookSide side_;
+        int32_t index_;
+        uint32_t remaining_;
+    };
+
+    BookView(const OrderBook* book, BookSide side, uint32_t depth) noexcept
+        : book_(book), side_(side), depth_(depth) {}
+
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept { return Iterator(book_, side_, -1, 0); }
+
+private:
+    const OrderBook* book_;
+    BookSide side_;
+    uint32_t depth_;
+};
+
+/// @brief Incremental L2/L3 limit order book for one symbol.
+///
+/// Prices are held as integer ticks in a fixed window [base, base + priceLevels)
+/// with one contiguous level array per side. An occupancy bitmap (plus a summary
+/// word per 64 words) finds the next populated level in a handful of bit scans,
+/// and the best bid/ask indices are cached so top-of-book reads are O(1).
+/// L3 orders live in a preallocated node pool, FIFO-linked per level and indexed
+/// by order id through an open-addressing table; nothing allocates after construction.
+///
+/// Updates outside the price window (or beyond the order pool) are rejected and
+/// counted; applySnapshot() re-centres the window on an empty book.
+/// A single book should be driven by either L2 deltas or L3 orders, not both.
+class OrderBook {
+public:
+    /// @param tickSize       minimum price increment (e.g. 1e-5 for EUR/USD)
+    /// @param referencePrice price the level window is centred on
+    /// @param priceLevels    number of ticks in the window (rounded up to a multiple of 4096)
+    /// @param maxOrders      capacity of the L3 order pool
+    OrderBook(double tickSize, double referencePrice,
+              uint32_t priceLevels = 1u << 16, uint32_t maxOrders = 1u << 18);
+
+    OrderBook(const OrderBook&) = delete;
+    OrderBook& operator=(const OrderBook&) = delete;
+
+    // —— L3 (order-by-order) ————————————————————————————————————————————
+    bool addOrder(uint64_t orderId, BookSide side, double price, double volume) noexcept;
+    /// @brief Reducing volume keeps queue priority; increasing it moves the order to the back.
+    bool modifyOrder(uint64_t orderId, double newVolume) noexcept;
+    bool deleteOrder(uint64_t orderId) noexcept;
+
+    // —— L2 (price-level) ——————————————————————————————————————————————
+    bool applyDelta(const BookDelta& delta) noexcept;
+    /// @brief Replace the whole book with a full snapshot.
+    void applySnapshot(const OrderBookSnapshot& snapshot) noexcept;
+    void clear() noexcept;
+
+    // —— Top of book (O(1)) ————————————————————————————————————————————
+    [[nodiscard]] inline bool hasBid() const noexcept { return bestBid_ >= 0; }
+    [[nodiscard]] inline bool hasAsk() const noexcept { return bestAsk_ >= 0; }
+    [[nodiscard]] inline PriceLevel bestBid() const noexcept { return levelAt(BookSide::BID, bestBid_); }
+    [[nodiscard]] inline PriceLevel bestAsk() const noexcept { return levelAt(BookSide::ASK, bestAsk_); }
+    [[nodiscard]] inline double midPrice() const noexcept {
+        return (hasBid() && hasAsk()) ? 0.5 * (bestBid().price + bestAsk().price) : 0.0;
+    }
+
+    // —— Depth ——————————————————————————————————————————————————————————
+    [[nodiscard]] inline BookView topBids(uint32_t depth) const noexcept { return BookView(this, BookSide::BID, depth); }
+    [[nodiscard]] inline BookView topAsks(uint32_t depth) const noexcept { return BookView(this, BookSide::ASK, depth); }
+    /// @brief Copy the best `depth` levels into `out`, reusing its capacity.
+    void copyTo(OrderBookSnapshot& out, uint32_t depth) const;
+
+    [[nodiscard]] inline PriceTicks toTicks(double price) const noexcept;
+    [[nodiscard]] inline double toPrice(PriceTicks ticks) const noexcept {
+        return static_cast<double>(ticks) * tickSize_;
+    }
+    [[nodiscard]] inline double tickSize() const noexcept { return tickSize_; }
+    [[nodiscard]] inline uint64_t rejectedUpdates() const noexcept { return rejected_; }
+    [[nodiscard]] inline uint32_t orderCount() const noexcept { return liveOrders_; }
+
+private:
+    friend class BookView;
+    friend class BookView::Iterator;
+
+    static constexpr uint32_t kNil = UINT32_MAX;
+    static constexpr uint64_t kEmptyKey = UINT64_MAX;
+
+    struct Level {
+        double volume = 0.0;
+        uint32_t orderCount = 0;
+        uint32_t head = kNil;  // oldest order (front of queue)
+        uint32_t tail = kNil;
+    };
+
+    struct Ladder {
+        std::vector<Level> levels;
+        std::vector<uint64_t> occupancy;  // bit per level
+        std::vector<uint64_t> summary;    // bit per non-zero occupancy word
+    };
+
+    struct OrderNode {
+        uint64_t id = kEmptyKey;
+        double volume = 0.0;
+        int32_t level = -1;
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        BookSide side = BookSide::BID;
+    };
+
+    struct IndexSlot {
+        uint64_t key = kEmptyKey;
+        uint32_t node = kNil;
+    };
+
+    [[nodiscard]] inline Ladder& ladder(BookSide side) noexcept { return side == BookSide::BID ? bids_ : asks_; }
+    [[nodiscard]] inline const Ladder& ladder(BookSide side) const noexcept { return side == BookSide::BID ? bids_ : asks_; }
+    [[nodiscard]] inline PriceLevel levelAt(BookSide side, int32_t index) const noexcept {
+        if (index < 0) return PriceLevel{};
+        return PriceLevel{toPrice(baseTick_ + index), ladder(side).levels[static_cast<uint32_t>(index)].volume};
+    }
+
+    int32_t indexFor(double price) const noexcept;
+    void markOccupied(BookSide side, int32_t index) noexcept;
+    void markEmpty(BookSide side, int32_t index) noexcept;
+    int32_t highestAtOrBelow(const Ladder& ladder, int32_t index) const noexcept;
+    int32_t lowestAtOrAbove(const Ladder& ladder, int32_t index) const noexcept;
+    int32_t nextLevel(BookSide side, int32_t index) const noexcept;
+
+    void unlinkOrder(uint32_t node) noexcept;
+    void appendOrder(uint32_t node) noexcept;
+
+    uint32_t* findIndex(uint64_t orderId) noexcept;
+    bool insertIndex(uint64_t orderId, uint32_t node) noexcept;
+    void eraseIndex(uint64_t orderId) noexcept;
+
+    double tickSize_;
+    double invTickSize_;
+    PriceTicks baseTick_;
+    uint32_t priceLevels_;
+
+    Ladder bids_;
+    Ladder asks_;
+    int32_t bestBid_ = -1;
+    int32_t bestAsk_ = -1;
+
+    std::vector<OrderNode> nodes_;
+    uint32_t freeHead_ = kNil;
+    uint32_t liveOrders_ = 0;
+    std::vector<IndexSlot> index_;
+    uint64_t indexMask_ = 0;
+
+    uint64_t rejected_ = 0;
+};
+
+inline PriceTicks OrderBook::toTicks(double price) const noexcept {
+    // Round half away from zero; avoids std::llround's errno handling on the hot path.
+    const double scaled = price * invTickSize_;
+    return static_cast<PriceTicks>(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+}
+
+} // namespace XAlgo::Data
@@ -1,52 +1,49 @@
 #pragma once
 
 #include <string>
-#include <mutex>
 
-class Position final {
+#include "SymbolRegistry.hpp"
+#include "core/concurrency/Seqlock.hpp"
+
+// Consistent view of one position: quantity and average price from the same update.
+struct PositionSnapshot {
+    double netQuantity = 0.0;
+    double avgPrice = 0.0;
+};
+
+// One writer (the thread booking fills for the symbol) updates quantity and average
+// price together under a seqlock; readers such as risk or the UI take consistent
+// snapshots without ever blocking it.
+class alignas(TradingSystem::kCacheLineSize) Position final {
 public:
-    inline explicit Position(const std::string& symbol) noexcept
-        : symbol_(symbol), netQuantity_(0.0), avgPrice_(0.0) {}
+    inline explicit Position(TradingSystem::SymbolId symbol = TradingSystem::kInvalidSymbol) noexcept
+        : symbol_(symbol) {}
 
-    // Update position: This multi‐variable update is protected by a mutex.
-    inline void update(double quantity, double price) noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        const double prevQty = netQuantity_;
-        const double newQty = netQuantity_ + quantity;
-        double totalCost = avgPrice_ * prevQty + price * quantity;
-        netQuantity_ = newQty;
-        avgPrice_ = (newQty != 0.0) ? totalCost / newQty : 0.0;
-    }
+    Position(const Position&) = delete;
+    Position& operator=(const Position&) = delete;
 
-    // Alternatively, if you accept some eventual consistency, you might explore:
-    /*
+    // Single writer. The writer keeps its own copy, so an update never re-reads the seqlock.
     inline void update(double quantity, double price) noexcept {
-        // This requires that std::atomic<double> is lock-free on your platform.
-        // NOTE: Such updates are not strictly atomic (combined update) and might result in minor inconsistencies.
-        double currentQty = netQuantity_.load(std::memory_order_relaxed);
-        double currentAvg = avgPrice_.load(std::memory_order_relaxed);
-        double newQty = currentQty + quantity;
-        double totalCost = currentAvg * currentQty + price * quantity;
-        netQuantity_.store(newQty, std::memory_order_relaxed);
-        avgPrice_.store((newQty != 0.0) ? totalCost / newQty : 0.0, std::memory_order_relaxed);
+        const double prevQty = current_.netQuantity;
+        const double newQty = prevQty + quantity;
+        const double totalCost = current_.avgPrice * prevQty + price * quantity;
+        current_.netQuantity = newQty;
+        current_.avgPrice = (newQty != 0.0) ? totalCost / newQty : 0.0;
+        state_.store(current_);
     }
-    */
 
-    [[nodiscard]] inline double getNetQuantity() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return netQuantity_;
-    }
-
-    [[nodiscard]] inline double getAveragePrice() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return avgPrice_;
-    }
+    [[nodiscard]] inline PositionSnapshot snapshot() const noexcept { return state_.load(); }
+    [[nodiscard]] inline double getNetQuantity() const noexcept { return snapshot().netQuantity; }
+    [[nodiscard]] inline double getAveragePrice() const noexcept { return snapshot().avgPrice; }
 
-    [[nodiscard]] inline const std::string& getSymbol() const noexcept { return symbol_; }
+    [[nodiscard]] inline TradingSystem::SymbolId getSymbolId() const noexcept { return symbol_; }
+    // Registry lookup, for logging.
+    [[nodiscard]] inline const std::string& getSymbol() const noexcept { return TradingSystem::symbolName(symbol_); }
 
 private:
-    const std::string symbol_;
-    mutable std::mutex mutex_;
-    double netQuantity_;
-    double avgPrice_;
+    friend class PositionBook;
+
+    TradingSystem::SymbolId symbol_;
+    PositionSnapshot current_;                        // writer's copy
+    TradingSystem::Seqlock<PositionSnapshot> state_;  // what readers see
 };
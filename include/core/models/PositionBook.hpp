@@ -0,0 +1,118 @@
+// PositionBook.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "Position.hpp"
+#include "SymbolRegistry.hpp"
+#include "TradeLeg.hpp"
+
+/// @brief Flat book of positions indexed by SymbolId, plus net exposure per currency.
+///
+/// Positions sit in one array, one cache line each, so the writer booking a fill and
+/// a reader scanning other symbols never share a line. Every symbol registered with
+/// addSymbol() is split into its two currencies; a fill of `quantity` at `price` moves
+/// +quantity into the base and -quantity * price into the quote, so once all legs of
+/// a triangle are booked the exposures show what the cycle actually left behind.
+///
+/// One thread books fills (onFill); any thread may read. A book-wide sequence wraps
+/// each fill, so exposures() returns every currency as of the same fill boundary.
+/// Register symbols at startup, before the writer starts.
+class PositionBook {
+public:
+    using CurrencyId = TradingSystem::NameRegistry::Id;
+    static constexpr CurrencyId kInvalidCurrency = TradingSystem::NameRegistry::kInvalid;
+
+    /// @param maxSymbols    ids at or above this are ignored (default: every internable symbol)
+    /// @param maxCurrencies upper bound on distinct currencies
+    explicit PositionBook(std::size_t maxSymbols = TradingSystem::symbolRegistry().capacity(),
+                          std::size_t maxCurrencies = 64);
+
+    PositionBook(const PositionBook&) = delete;
+    PositionBook& operator=(const PositionBook&) = delete;
+
+    /// @brief Map a "BASE/QUOTE" (or "BASEQUOTE") symbol onto its currencies. Startup only.
+    /// @return false if the name cannot be parsed, the id is out of range or the
+    /// currency table is full. The position is still tracked, just not aggregated.
+    bool addSymbol(TradingSystem::SymbolId symbol);
+
+    /// @brief Book a fill. Single writer. Positive quantity buys the base currency.
+    /// @return false for an out-of-range symbol.
+    inline bool onFill(TradingSystem::SymbolId symbol, double quantity, double price) noexcept {
+        if (symbol >= maxSymbols_) return false;
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        positions_[symbol].update(quantity, price);
+        const Currencies c = currencies_[symbol];
+        if (c.base != kInvalidCurrency) {
+            addExposure(c.base, quantity);
+            addExposure(c.quote, -quantity * price);
+        }
+
+        seq_.store(seq + 2, std::memory_order_release);
+        return true;
+    }
+
+    inline bool onFill(const TradeLeg& leg) noexcept {
+        return onFill(leg.symbol, leg.side == TradingSystem::OrderSide::SELL ? -leg.quantity : leg.quantity, leg.price);
+    }
+
+    /// @brief Consistent quantity and average price of one symbol.
+    [[nodiscard]] inline PositionSnapshot snapshot(TradingSystem::SymbolId symbol) const noexcept {
+        return symbol < maxSymbols_ ? positions_[symbol].snapshot() : PositionSnapshot{};
+    }
+
+    /// @brief Net exposure of one currency. May sit between two legs of a triangle.
+    [[nodiscard]] inline double exposure(CurrencyId currency) const noexcept {
+        return currency < currencyRegistry_.size() ? exposure_[currency].load(std::memory_order_relaxed) : 0.0;
+    }
+    [[nodiscard]] inline double exposure(std::string_view code) const noexcept {
+        return exposure(currencyRegistry_.find(code));
+    }
+
+    /// @brief Copy every currency's net exposure as of one fill boundary into `out`.
+    /// @return number of currencies written (at most `capacity`).
+    std::size_t exposures(double* out, std::size_t capacity) const noexcept;
+
+    /// @return the currencies of a registered symbol, or kInvalidCurrency.
+    [[nodiscard]] inline CurrencyId baseCurrency(TradingSystem::SymbolId symbol) const noexcept {
+        return symbol < maxSymbols_ ? currencies_[symbol].base : kInvalidCurrency;
+    }
+    [[nodiscard]] inline CurrencyId quoteCurrency(TradingSystem::SymbolId symbol) const noexcept {
+        return symbol < maxSymbols_ ? currencies_[symbol].quote : kInvalidCurrency;
+    }
+
+    [[nodiscard]] inline CurrencyId currencyId(std::string_view code) const noexcept { return currencyRegistry_.find(code); }
+    [[nodiscard]] inline const std::string& currencyCode(CurrencyId id) const noexcept { return currencyRegistry_.name(id); }
+    [[nodiscard]] inline std::size_t currencyCount() const noexcept { return currencyRegistry_.size(); }
+    [[nodiscard]] inline std::size_t maxCurrencies() const noexcept { return currencyRegistry_.capacity(); }
+    [[nodiscard]] inline std::size_t maxSymbols() const noexcept { return maxSymbols_; }
+    /// @brief Fills booked so far.
+    [[nodiscard]] inline uint64_t fills() const noexcept { return seq_.load(std::memory_order_acquire) / 2; }
+
+private:
+    struct Currencies {
+        CurrencyId base = kInvalidCurrency;
+        CurrencyId quote = kInvalidCurrency;
+    };
+
+    // Writer only: the load never races another store.
+    inline void addExposure(CurrencyId currency, double delta) noexcept {
+        auto& cell = exposure_[currency];
+        cell.store(cell.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    std::size_t maxSymbols_;
+    std::unique_ptr<Position[]> positions_;        // positions_[symbol], one cache line each
+    std::unique_ptr<Currencies[]> currencies_;     // currencies_[symbol]
+    TradingSystem::NameRegistry currencyRegistry_;
+    std::unique_ptr<std::atomic<double>[]> exposure_;  // exposure_[currency]
+    alignas(TradingSystem::kCacheLineSize) std::atomic<uint64_t> seq_{0};
+};
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <Eigen/Dense>
+
+namespace TradingSystem {
+
+/// @brief Output of a Johansen solve over the current window.
+template <int N>
+struct JohansenResult {
+    std::array<double, N> eigenvalues{};     // descending, in [0, 1)
+    std::array<double, N> traceStats{};      // H0: rank <= r, for r = 0..N-1
+    std::array<double, N> maxEigenStats{};   // H0: rank == r vs r + 1
+    int rank = 0;                            // cointegration rank at 95% (trace test)
+    int maxEigenRank = 0;                    // cointegration rank at 95% (max-eigenvalue test)
+    bool valid = false;                      // false until warm, or if the moment matrices are singular
+
+    [[nodiscard]] inline bool cointegrated() const noexcept { return valid && rank > 0; }
+};
+
+/// @brief Johansen cointegration test over a sliding window, updated in O(N^2) per tick.
+///
+/// Uses the VAR(1) / unrestricted-constant form: ΔX_t = Π X_{t-1} + c + ε_t. The engine
+/// keeps first and second moments of (ΔX_t, X_{t-1}) and adds/removes one rank-1 term
+/// as observations enter and leave the window, so the concentrated moment matrices
+/// S00, S11, S01 are available without touching the history. The N x N eigenproblem
+///   |λ S11 - S10 S00^-1 S01| = 0
+/// is re-solved only every `solveEvery` ticks (via a Cholesky whitening of S11).
+///
+/// All matrices are fixed-size and the window history is allocated once at construction.
+/// As with StreamingZScore, sliding removals drift, so an add-only shadow copy of the
+/// moments is rebuilt from incoming observations and swapped in every `window` ticks.
+/// Levels are stored relative to the first observation to keep the sums well conditioned.
+template <int N = 3>
+class RollingJohansenEngine {
+    static_assert(N >= 2 && N <= 5, "Critical values are tabulated for 2..5 series");
+
+public:
+    using Vector = Eigen::Matrix<double, N, 1>;
+    using Matrix = Eigen::Matrix<double, N, N>;
+
+    /// @param window     number of (ΔX_t, X_{t-1}) pairs in the window
+    /// @param solveEvery re-solve the eigenproblem every this many ticks once warm
+    explicit RollingJohansenEngine(std::size_t window, std::size_t solveEvery = 1)
+        : window_(std::max<std::size_t>(window, static_cast<std::size_t>(2 * N + 2))),
+          solveEvery_(std::max<std::size_t>(solveEvery, 1)),
+          diffs_(N, static_cast<Eigen::Index>(window_)),
+          lagged_(N, static_cast<Eigen::Index>(window_)) {
+        moments_.clear();
+        shadow_.clear();
+    }
+
+    /// @brief Add one observation of the N series.
+    /// @return true if this tick triggered a re-solve.
+    bool push(const Vector& x) noexcept {
+        if (!hasReference_) {
+            reference_ = x;
+            previous_ = Vector::Zero();
+            hasReference_ = true;
+            return false;
+        }
+
+        const Vector level = x - reference_;
+        const Vector diff = level - previous_;
+        const Vector lag = previous_;
+        previous_ = level;
+
+        const auto slot = static_cast<Eigen::Index>(head_);
+        if (moments_.count == window_) {
+            moments_.remove(diffs_.col(slot), lagged_.col(slot));
+        }
+        moments_.add(diff, lag);
+        diffs_.col(slot) = diff;
+        lagged_.col(slot) = lag;
+        if (++head_ == window_) head_ = 0;
+
+        if (filled_ < window_) {
+            ++filled_;
+        } else {
+            shadow_.add(diff, lag);
+            if (shadow_.count == window_) {
+                moments_ = shadow_;
+                shadow_.clear();
+            }
+        }
+
+        if (!isWarm()) return false;
+        if (++sinceSolve_ < solveEvery_) return false;
+        solve();
+        return true;
+    }
+
+    /// @brief Solve the eigenproblem for the current window now.
+    void solve() noexcept {
+        sinceSolve_ = 0;
+        result_.valid = false;
+        if (moments_.count < static_cast<std::size_t>(2 * N + 2)) return;
+
+        const double T = static_cast<double>(moments_.count);
+        const Vector meanD = moments_.sumD / T;
+        const Vector meanL = moments_.sumL / T;
+        const Matrix s00 = moments_.sumDD / T - meanD * meanD.transpose();
+        const Matrix s11 = moments_.sumLL / T - meanL * meanL.transpose();
+        const Matrix s01 = moments_.sumDL / T - meanD * meanL.transpose();
+
+        const Eigen::LLT<Matrix> llt00(s00);
+        const Eigen::LLT<Matrix> llt11(s11);
+        if (llt00.info() != Eigen::Success || llt11.info() != Eigen::Success) return;
+
+        // C = L11^-1 (S10 S00^-1 S01) L11^-T is symmetric with the same eigenvalues.
+        const Matrix m = s01.transpose() * llt00.solve(s01);
+        const Matrix b = llt11.matrixL().solve(m);
+        const Matrix c = llt11.matrixL().solve(b.transpose());
+
+        solver_.compute(c, Eigen::EigenvaluesOnly);
+        if (solver_.info() != Eigen::Success) return;
+
+        for (int i = 0; i < N; ++i) {
+            // Eigen returns ascending order; Johansen statistics want descending.
+            const double lambda = solver_.eigenvalues()(N - 1 - i);
+            result_.eigenvalues[i] = std::clamp(lambda, 0.0, 1.0 - 1e-12);
+        }
+
+        double tail = 0.0;
+        for (int r = N - 1; r >= 0; --r) {
+            const double term = -T * std::log(1.0 - result_.eigenvalues[r]);
+            tail += term;
+            result_.traceStats[r] = tail;
+            result_.maxEigenStats[r] = term;
+        }
+
+        result_.rank = 0;
+        while (result_.rank < N && result_.traceStats[result_.rank] > kTraceCritical95[N - result_.rank - 1]) {
+            ++result_.rank;
+        }
+        result_.maxEigenRank = 0;
+        while (result_.maxEigenRank < N
+               && result_.maxEigenStats[result_.maxEigenRank] > kMaxEigenCritical95[N - result_.maxEigenRank - 1]) {
+            ++result_.maxEigenRank;
+        }
+        result_.valid = true;
+    }
+
+    [[nodiscard]] inline const JohansenResult<N>& result() const noexcept { return result_; }
+    [[nodiscard]] inline bool isWarm() const noexcept { return moments_.count == window_; }
+    [[nodiscard]] inline std::size_t window() const noexcept { return window_; }
+
+    /// @brief 95% critical values (MacKinnon-Haug-Michelis, unrestricted constant), indexed by N - r - 1.
+    static constexpr std::array<double, 5> kTraceCritical95 = {3.8415, 15.4943, 29.7961, 47.8545, 69.8189};
+    static constexpr std::array<double, 5> kMaxEigenCritical95 = {3.8415, 14.2639, 21.1314, 27.5858, 33.8777};
+
+private:
+    struct Moments {
+        Vector sumD, sumL;
+        Matrix sumDD, sumLL, sumDL;
+        std::size_t count;
+
+        void clear() noexcept {
+            sumD.setZero();
+            sumL.setZero();
+            sumDD.setZero();
+            sumLL.setZero();
+            sumDL.setZero();
+            count = 0;
+        }
+        template <typename D, typename L>
+        void add(const D& d, const L& l) noexcept {
+            sumD += d;
+            sumL += l;
+            sumDD.noalias() += d * d.transpose();
+            sumLL.noalias() += l * l.transpose();
+            sumDL.noalias() += d * l.transpose();
+            ++count;
+        }
+        template <typename D, typename L>
+        void remove(const D& d, const L& l) noexcept {
+            sumD -= d;
+            sumL -= l;
+            sumDD.noalias() -= d * d.transpose();
+            sumLL.noalias() -= l * l.transpose();
+            sumDL.noalias() -= d * l.transpose();
+            --count;
+        }
+    };
+
+    std::size_t window_;
+    std::size_t solveEvery_;
+    Eigen::Matrix<double, N, Eigen::Dynamic> diffs_;   // ΔX_t per slot
+    Eigen::Matrix<double, N, Eigen::Dynamic> lagged_;  // X_{t-1} per slot
+    std::size_t head_ = 0;
+    std::size_t filled_ = 0;
+    std::size_t sinceSolve_ = 0;
+
+    Vector reference_ = Vector::Zero();
+    Vector previous_ = Vector::Zero();
+    bool hasReference_ = false;
+
+    Moments moments_;
+    Moments shadow_;
+    Eigen::SelfAdjointEigenSolver<Matrix> solver_;
+    JohansenResult<N> result_;
+};
+
+} // namespace TradingSystem
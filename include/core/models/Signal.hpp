@@ -4,9 +4,13 @@
 #include <chrono>
 #include <stdexcept>
 #include <cmath>
+#include <cstddef>
+#include <algorithm>
 #include <mutex>
 #include <Eigen/Dense> // Requires Eigen library for matrix operations
 
+#include "utils/TraceContext.hpp"
+
 namespace TradingSystem {
 
 /// @brief Container for tick data (bid/ask prices, volumes, etc.)
@@ -15,6 +19,7 @@ struct TickData {
     double gbpUsd;
     double eurGbp;
     std::chrono::steady_clock::time_point timestamp;
+    TraceContext trace{};   // of the quote that produced this update; inactive if untraced
 };
 
 /// @brief Encapsulates the Johansen cointegration test logic.
@@ -66,11 +71,120 @@ public:
     }
 };
 
+/// @brief How StreamingZScore estimates the mean/variance of the spread.
+enum class ZScoreMode {
+    ROLLING_WINDOW,  // exact statistics over the last N samples
+    EWMA             // exponentially weighted, alpha = 2 / (N + 1)
+};
+
+/// @brief O(1)-per-tick Z-score over a stream of spreads.
+///
+/// Rolling mode keeps the last N samples in a preallocated ring and slides Welford's
+/// mean/M2 as one sample enters and one leaves. Sliding removals accumulate rounding
+/// error, and Kahan-style compensation terms are algebraically zero, so -ffast-math
+/// (-fassociative-math) is free to delete them. Instead a shadow accumulator is
+/// rebuilt add-only (which is stable) from the samples entering the window, and after N
+/// ticks it holds exactly the current window and replaces the sliding estimate.
+class StreamingZScore {
+public:
+    explicit StreamingZScore(std::size_t window, ZScoreMode mode = ZScoreMode::ROLLING_WINDOW)
+        : mode_(mode),
+          window_(std::max<std::size_t>(window, 2)),
+          alpha_(2.0 / (static_cast<double>(window_) + 1.0)),
+          samples_(mode == ZScoreMode::ROLLING_WINDOW ? window_ : 0) {}
+
+    /// @brief Add one spread and return its Z-score against the updated statistics.
+    double update(double x) noexcept {
+        if (mode_ == ZScoreMode::EWMA) {
+            updateEwma(x);
+        } else {
+            updateWindow(x);
+        }
+        const double var = variance();
+        if (var <= kMinVariance) return 0.0;
+        return (x - mean_) / std::sqrt(var);
+    }
+
+    [[nodiscard]] inline double mean() const noexcept { return mean_; }
+    /// @brief Population variance (divides by the sample count, like computeAdaptiveZScore).
+    [[nodiscard]] inline double variance() const noexcept {
+        if (mode_ == ZScoreMode::EWMA) return m2_;
+        return count_ > 0 ? std::max(m2_, 0.0) / static_cast<double>(count_) : 0.0;
+    }
+    [[nodiscard]] inline std::size_t count() const noexcept { return count_; }
+    [[nodiscard]] inline bool isWarm() const noexcept { return count_ >= window_; }
+
+    void reset() noexcept {
+        count_ = head_ = shadowCount_ = 0;
+        mean_ = m2_ = shadowMean_ = shadowM2_ = 0.0;
+    }
+
+private:
+    static constexpr double kMinVariance = 1e-300;
+
+    void updateWindow(double x) noexcept {
+        if (count_ < window_) {
+            // Filling: plain add-only Welford.
+            ++count_;
+            const double delta = x - mean_;
+            mean_ += delta / static_cast<double>(count_);
+            m2_ += delta * (x - mean_);
+        } else {
+            // Full: replace the oldest sample.
+            const double old = samples_[head_];
+            const double oldMean = mean_;
+            const double delta = x - old;
+            mean_ += delta / static_cast<double>(window_);
+            m2_ += delta * ((x - mean_) + (old - oldMean));
+
+            ++shadowCount_;
+            const double shadowDelta = x - shadowMean_;
+            shadowMean_ += shadowDelta / static_cast<double>(shadowCount_);
+            shadowM2_ += shadowDelta * (x - shadowMean_);
+            if (shadowCount_ == window_) {
+                mean_ = shadowMean_;
+                m2_ = shadowM2_;
+                shadowCount_ = 0;
+                shadowMean_ = shadowM2_ = 0.0;
+            }
+        }
+        samples_[head_] = x;
+        if (++head_ == window_) head_ = 0;
+    }
+
+    void updateEwma(double x) noexcept {
+        // West's incremental EW mean/variance; m2_ holds the variance directly.
+        if (count_ == 0) {
+            mean_ = x;
+            m2_ = 0.0;
+        } else {
+            const double delta = x - mean_;
+            mean_ += alpha_ * delta;
+            m2_ = (1.0 - alpha_) * (m2_ + alpha_ * delta * delta);
+        }
+        if (count_ < window_) ++count_;
+    }
+
+    ZScoreMode mode_;
+    std::size_t window_;
+    double alpha_;
+    std::vector<double> samples_;
+    std::size_t count_ = 0;
+    std::size_t head_ = 0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+    std::size_t shadowCount_ = 0;
+    double shadowMean_ = 0.0;
+    double shadowM2_ = 0.0;
+};
+
 /// @brief SignalEngine responsible for computing the spread and Z-score.
 /// Spread formula: spread = EURUSD - (EURGBP * GBPUSD)
 class SignalEngine {
 public:
-    SignalEngine() = default;
+    /// @param zScoreWindow samples in the streaming Z-score window (or EWMA span)
+    explicit SignalEngine(std::size_t zScoreWindow = 1000, ZScoreMode mode = ZScoreMode::ROLLING_WINDOW)
+        : zScore_(zScoreWindow, mode) {}
     ~SignalEngine() = default;
 
     /// @brief Computes the spread from the current tick data.
@@ -78,7 +192,16 @@ public:
         return tick.eurUsd - (tick.eurGbp * tick.gbpUsd);
     }
 
+    /// @brief Streaming path: fold the tick's spread into the rolling statistics in O(1)
+    /// and return its Z-score. Use this per tick instead of computeAdaptiveZScore.
+    inline double updateZScore(const TickData &tick) noexcept {
+        return zScore_.update(computeSpread(tick));
+    }
+
+    [[nodiscard]] inline const StreamingZScore& zScoreState() const noexcept { return zScore_; }
+
     /// @brief Computes an adaptive Z-score given the spread series.
+    /// O(n) batch version; kept for offline analysis and as a reference for updateZScore.
     /// @param spreads A vector of spread values.
     /// @return Calculated Z-score.
     double computeAdaptiveZScore(const std::vector<double>& spreads) const noexcept {
@@ -102,6 +225,9 @@ public:
         double latest = spreads.back();
         return (latest - mean) / stddev;
     }
+
+private:
+    StreamingZScore zScore_;
 };
 
 } // namespace TradingSystem
@@ -0,0 +1,74 @@
+// SymbolRegistry.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace TradingSystem {
+
+using SymbolId = uint16_t;
+using VenueId = uint16_t;
+
+inline constexpr SymbolId kInvalidSymbol = UINT16_MAX;
+inline constexpr VenueId kInvalidVenue = UINT16_MAX;
+
+/// @brief Interns names into dense ids 0, 1, 2, ... so hot-path structs carry a
+/// 16-bit id instead of a std::string, and per-name tables become flat arrays
+/// indexed by id.
+///
+/// Register every name at startup, before the threads that look them up start:
+/// like CurrencyGraph::addPair, intern() is not synchronised with readers. After
+/// that, find() and name() are read-only and never allocate.
+class NameRegistry {
+public:
+    using Id = uint16_t;
+    static constexpr Id kInvalid = UINT16_MAX;
+
+    /// @param capacity maximum number of names (at most kInvalid)
+    explicit NameRegistry(std::size_t capacity);
+
+    NameRegistry(const NameRegistry&) = delete;
+    NameRegistry& operator=(const NameRegistry&) = delete;
+
+    /// @brief Register (or look up) a name. Startup only.
+    /// @return kInvalid for an empty name or once the registry is full.
+    Id intern(std::string_view name);
+
+    /// @return the id of a registered name, or kInvalid.
+    [[nodiscard]] Id find(std::string_view name) const noexcept;
+
+    /// @return the registered name, or an empty string for an unknown id. For logging.
+    [[nodiscard]] inline const std::string& name(Id id) const noexcept {
+        return id < size_ ? names_[id] : empty_;
+    }
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::size_t capacity_;
+    std::size_t size_ = 0;
+    std::unique_ptr<std::string[]> names_;  // fixed storage: references stay valid
+    std::unordered_map<std::string, Id, Hash, std::equal_to<>> ids_;
+    std::string empty_;
+};
+
+/// @brief Process-wide registries.
+NameRegistry& symbolRegistry();
+NameRegistry& venueRegistry();
+
+inline SymbolId internSymbol(std::string_view name) { return symbolRegistry().intern(name); }
+inline VenueId internVenue(std::string_view name) { return venueRegistry().intern(name); }
+[[nodiscard]] inline const std::string& symbolName(SymbolId id) noexcept { return symbolRegistry().name(id); }
+[[nodiscard]] inline const std::string& venueName(VenueId id) noexcept { return venueRegistry().name(id); }
+
+} // namespace TradingSystem
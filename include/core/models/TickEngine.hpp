@@ -0,0 +1,111 @@
+// TickEngine.hpp
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "core/models/Signal.hpp"
+#include "utils/Clock.hpp"
+
+namespace TradingSystem {
+
+/// @brief The three legs of the EUR/USD/GBP triangle.
+enum class FxLeg : uint8_t { EURUSD = 0, GBPUSD = 1, EURGBP = 2 };
+inline constexpr std::size_t kFxLegCount = 3;
+
+/// @brief A top-of-book quote as ingested, stamped with TscClock at receipt.
+struct Quote {
+    double bid = 0.0;
+    double ask = 0.0;
+    uint64_t sourceSeq = 0;    // venue sequence number, 0 if the feed has none
+    uint64_t receivedTsc = 0;  // TscClock::now() at ingest
+
+    [[nodiscard]] inline double mid() const noexcept { return 0.5 * (bid + ask); }
+};
+
+/// @brief Fixed-capacity history of quotes for one symbol; overwrites the oldest entry.
+/// Storage is allocated once at construction.
+class QuoteHistory {
+public:
+    explicit QuoteHistory(std::size_t capacity);
+
+    inline void push(const Quote& quote) noexcept {
+        buffer_[head_ & mask_] = quote;
+        ++head_;
+    }
+
+    /// @brief Quote by age: 0 is the newest, size() - 1 the oldest retained.
+    [[nodiscard]] inline const Quote& operator[](std::size_t age) const noexcept {
+        return buffer_[(head_ - 1 - age) & mask_];
+    }
+    [[nodiscard]] inline const Quote& latest() const noexcept { return (*this)[0]; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return head_ < buffer_.size() ? head_ : buffer_.size(); }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return buffer_.size(); }
+    [[nodiscard]] inline bool empty() const noexcept { return head_ == 0; }
+    [[nodiscard]] inline uint64_t totalPushed() const noexcept { return head_; }
+
+private:
+    std::vector<Quote> buffer_;
+    std::size_t mask_;
+    uint64_t head_ = 0;
+};
+
+/// @brief Outcome of TickEngine::onQuote.
+enum class IngestResult : uint8_t {
+    UPDATED,    // stored; triangle callback fired if the leg's mid moved
+    CONFLATED,  // identical to the last quote for this leg; dropped
+    STALE,      // sequence number not newer than the last one seen; dropped
+    REJECTED    // non-positive or crossed prices; dropped
+};
+
+/// @brief Ingests EUR/USD, GBP/USD and EUR/GBP quotes into preallocated per-symbol
+/// histories and fires the triangle callback only when a leg's mid changes.
+///
+/// The callback is installed at construction and never reassigned, so the steady
+/// state performs no heap allocation. Single-threaded: call onQuote from one feed thread.
+class TickEngine {
+public:
+    using TriangleCallback = std::function<void(const TickData& triangle, FxLeg changedLeg)>;
+
+    explicit TickEngine(TriangleCallback onTriangle, std::size_t historyCapacity = 4096);
+
+    TickEngine(const TickEngine&) = delete;
+    TickEngine& operator=(const TickEngine&) = delete;
+
+    /// @brief Ingest one quote for `leg`. An active `trace` (begun when the message was
+    /// received) is stamped TickEngine and handed to the callback in TickData::trace.
+    IngestResult onQuote(FxLeg leg, double bid, double ask, uint64_t sourceSeq = 0,
+                         const TraceContext& trace = {}) noexcept;
+
+    [[nodiscard]] inline const QuoteHistory& history(FxLeg leg) const noexcept {
+        return histories_[static_cast<std::size_t>(leg)];
+    }
+    /// @brief Latest triangle of mids; only meaningful once isPrimed().
+    [[nodiscard]] inline const TickData& triangle() const noexcept { return triangle_; }
+    [[nodiscard]] inline bool isPrimed() const noexcept { return primedMask_ == kAllLegs; }
+
+    [[nodiscard]] inline uint64_t updatedCount() const noexcept { return updated_; }
+    [[nodiscard]] inline uint64_t conflatedCount() const noexcept { return conflated_; }
+    [[nodiscard]] inline uint64_t staleCount() const noexcept { return stale_; }
+    [[nodiscard]] inline uint64_t rejectedCount() const noexcept { return rejected_; }
+    [[nodiscard]] inline uint64_t triangleUpdates() const noexcept { return triangleUpdates_; }
+
+private:
+    static constexpr uint8_t kAllLegs = (1u << kFxLegCount) - 1;
+
+    TriangleCallback onTriangle_;
+    std::array<QuoteHistory, kFxLegCount> histories_;
+    TickData triangle_{};
+    uint8_t primedMask_ = 0;
+
+    uint64_t updated_ = 0;
+    uint64_t conflated_ = 0;
+    uint64_t stale_ = 0;
+    uint64_t rejected_ = 0;
+    uint64_t triangleUpdates_ = 0;
+};
+
+} // namespace TradingSystem
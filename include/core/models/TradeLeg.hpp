@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Order.hpp"
+#include "SymbolRegistry.hpp"
+#include "utils/TraceContext.hpp"
+
+struct TradeLeg {
+    TradingSystem::SymbolId symbol;
+    double price;
+    double quantity;
+    TradingSystem::OrderSide side;
+    TradingSystem::TraceContext trace{}; // carried from the triggering quote; stamped at dispatch
+
+    TradeLeg(TradingSystem::SymbolId sym = TradingSystem::kInvalidSymbol, double p = 0.0, double qty = 0.0,
+             TradingSystem::OrderSide s = TradingSystem::OrderSide::BUY)
+        : symbol(sym), price(p), quantity(qty), side(s) {}
+};
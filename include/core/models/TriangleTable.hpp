@@ -0,0 +1,100 @@
+// TriangleTable.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SymbolRegistry.hpp"
+
+namespace TradingSystem {
+
+/// @brief Instruction set used by the batch spread kernel.
+enum class KernelIsa : uint8_t { SCALAR, AVX2, AVX512 };
+
+/// @brief Structure-of-arrays table of currency triangles, evaluated in one SIMD pass.
+///
+/// Each triangle is (direct, crossFirst, crossSecond) with
+///   spread = direct - crossFirst * crossSecond
+/// e.g. EUR/USD - EUR/GBP * GBP/USD, the same formula as SignalEngine::computeSpread.
+/// Leg prices are stored denormalised per triangle (three contiguous columns) so the
+/// kernel streams straight through memory with no gathers; a quote scatters its mid
+/// into every slot that references the symbol, then all spreads and Z-scores are
+/// recomputed. Only the triangles that reference the quoted symbol fold their new
+/// spread into the EWMA mean/variance, so alpha is per update of that triangle; the
+/// others are re-scored against unchanged statistics. Lanes with any unpriced leg
+/// (including the padding up to a multiple of 8) are inert: their Z-score is 0 and
+/// their statistics are left untouched.
+///
+/// The kernel is picked once at construction from CPUID (AVX-512F, AVX2+FMA, scalar).
+class TriangleTable {
+public:
+    /// @param symbolCount number of distinct quoted symbols (ids are 0..symbolCount-1)
+    /// @param ewmaAlpha   smoothing factor for the per-triangle spread mean/variance
+    explicit TriangleTable(std::size_t symbolCount, double ewmaAlpha = 2.0 / 1001.0);
+
+    /// @brief Register a triangle at startup. @return its index.
+    std::size_t addTriangle(SymbolId direct, SymbolId crossFirst, SymbolId crossSecond);
+
+    /// @brief Scatter a new mid for `symbol` and re-evaluate every triangle; with
+    /// `updateStatistics`, the triangles containing `symbol` also update their EWMA stats.
+    void onQuote(SymbolId symbol, double mid, bool updateStatistics = true) noexcept;
+
+    /// @brief Recompute all spreads and Z-scores; optionally fold every triangle's spread
+    /// into its EWMA stats.
+    void evaluateAll(bool updateStatistics = true) noexcept;
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] inline double spread(std::size_t i) const noexcept { return spread_[i]; }
+    [[nodiscard]] inline double zScore(std::size_t i) const noexcept { return zScore_[i]; }
+    [[nodiscard]] inline const double* spreads() const noexcept { return spread_.data(); }
+    [[nodiscard]] inline const double* zScores() const noexcept { return zScore_.data(); }
+
+    [[nodiscard]] inline KernelIsa activeKernel() const noexcept { return isa_; }
+    /// @brief Override the detected kernel (benchmarks/tests). Falls back to the best supported one.
+    void forceKernel(KernelIsa isa) noexcept;
+    [[nodiscard]] static KernelIsa detectKernel() noexcept;
+    [[nodiscard]] static const char* kernelName(KernelIsa isa) noexcept;
+
+    /// @brief Arguments for one kernel pass over `lanes` (a multiple of 8) triangles.
+    /// Lane i updates its statistics iff bit (i % 8) of updateMask[i / 8] is set;
+    /// a null mask updates none.
+    struct KernelArgs {
+        const double* direct;
+        const double* crossFirst;
+        const double* crossSecond;
+        double* mean;
+        double* variance;
+        double* spread;
+        double* zScore;
+        std::size_t lanes;
+        double alpha;
+        const uint8_t* updateMask;
+    };
+    using KernelFn = void (*)(const KernelArgs&) noexcept;
+
+private:
+    static constexpr std::size_t kLaneMultiple = 8;
+
+    struct LegRef {
+        uint32_t triangle;
+        uint8_t column;  // 0 = direct, 1 = crossFirst, 2 = crossSecond
+    };
+
+    void resizeColumns(std::size_t lanes);
+    void evaluate(const uint8_t* updateMask) noexcept;
+
+    std::size_t count_ = 0;
+    double alpha_;
+    std::vector<double> direct_, crossFirst_, crossSecond_;
+    std::vector<double> mean_, variance_, spread_, zScore_;
+    std::vector<uint8_t> primed_;  // bit per column that has a price, bit 3 once the EWMA is seeded
+    std::vector<uint8_t> dirty_;   // bit per lane: referenced by the quote being applied
+    std::vector<uint8_t> allLanes_;  // every bit set, for evaluateAll(true)
+    std::vector<std::vector<LegRef>> legsBySymbol_;
+
+    KernelIsa isa_;
+    KernelFn kernel_;
+};
+
+} // namespace TradingSystem
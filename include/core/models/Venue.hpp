@@ -3,16 +3,20 @@
 #include <string>
 #include <atomic>
 
+#include "SymbolRegistry.hpp"
+
 class Venue final {
 public:
-    inline explicit Venue(const std::string& name) noexcept
-        : name_(name), isActive_(true) {}
+    // Venues are set up at startup, so interning the name here is fine.
+    inline explicit Venue(const std::string& name)
+        : id_(TradingSystem::internVenue(name)), isActive_(true) {}
 
-    [[nodiscard]] inline const std::string& getName() const noexcept { return name_; }
+    [[nodiscard]] inline TradingSystem::VenueId getId() const noexcept { return id_; }
+    [[nodiscard]] inline const std::string& getName() const noexcept { return TradingSystem::venueName(id_); }
     [[nodiscard]] inline bool isActive() const noexcept { return isActive_.load(std::memory_order_relaxed); }
     inline void setActive(bool active) noexcept { isActive_.store(active, std::memory_order_relaxed); }
 
 private:
-    const std::string name_;
+    const TradingSystem::VenueId id_;
     std::atomic<bool> isActive_;
 };
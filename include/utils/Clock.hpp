@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace TradingSystem {
+
+/// @brief Cheap monotonic timestamps for the hot path.
+/// On x86 this reads the invariant TSC (~7ns); elsewhere it falls back to steady_clock nanoseconds.
+/// Raw values are only meaningful as differences; convert with toNanos()/toSteady().
+class TscClock {
+public:
+    [[nodiscard]] static inline uint64_t now() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(steadyNanos());
+#endif
+    }
+
+    /// @brief Convert a tick delta to nanoseconds.
+    [[nodiscard]] static inline double toNanos(uint64_t ticks) noexcept {
+        return static_cast<double>(ticks) * calibration().nanosPerTick;
+    }
+
+    /// @brief Map a raw timestamp onto the steady_clock timeline.
+    [[nodiscard]] static inline std::chrono::steady_clock::time_point toSteady(uint64_t ticks) noexcept {
+        const Calibration& c = calibration();
+        const double deltaNs = (static_cast<double>(ticks) - static_cast<double>(c.tscAnchor)) * c.nanosPerTick;
+        return std::chrono::steady_clock::time_point(
+            std::chrono::nanoseconds(c.steadyAnchorNs + static_cast<int64_t>(deltaNs)));
+    }
+
+    /// @brief Force calibration at startup so the first hot-path conversion does not pay for it.
+    static inline void calibrate() noexcept { (void)calibration(); }
+
+private:
+    struct Calibration {
+        uint64_t tscAnchor;
+        int64_t steadyAnchorNs;
+        double nanosPerTick;
+    };
+
+    static inline int64_t steadyNanos() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static const Calibration& calibration() noexcept {
+        static const Calibration c = [] {
+#if defined(__x86_64__) || defined(__i386__)
+            // Spin ~5ms against steady_clock to measure the TSC frequency.
+            const int64_t ns0 = steadyNanos();
+            const uint64_t t0 = __rdtsc();
+            int64_t ns1 = ns0;
+            while (ns1 - ns0 < 5'000'000) ns1 = steadyNanos();
+            const uint64_t t1 = __rdtsc();
+            return Calibration{t1, ns1, static_cast<double>(ns1 - ns0) / static_cast<double>(t1 - t0)};
+#else
+            return Calibration{0, 0, 1.0};
+#endif
+        }();
+        return c;
+    }
+};
+
+} // namespace TradingSystem
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/concurrency/RcuSnapshot.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
+
+namespace TradingSystem {
+
+/// @brief Every scalar in a config file under its dotted path ("shm_ring.slots",
+/// "venues.0.name" for array elements), sorted by key. Looked up by binary search;
+/// meant for startup and reload, not for the hot path.
+class ConfigValues {
+public:
+    ConfigValues() = default;
+    explicit ConfigValues(std::vector<std::pair<std::string, std::string>> entries);
+
+    [[nodiscard]] const std::string* find(std::string_view key) const noexcept;
+    [[nodiscard]] bool contains(std::string_view key) const noexcept { return find(key) != nullptr; }
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] const std::vector<std::pair<std::string, std::string>>& entries() const noexcept { return entries_; }
+
+    // A missing key, or one whose value does not parse as the type, gives the default.
+    [[nodiscard]] int64_t getInt(std::string_view key, int64_t defaultValue) const noexcept;
+    [[nodiscard]] double getDouble(std::string_view key, double defaultValue) const noexcept;
+    [[nodiscard]] bool getBool(std::string_view key, bool defaultValue) const noexcept;
+    [[nodiscard]] std::string getString(std::string_view key, std::string_view defaultValue) const;
+
+private:
+    std::vector<std::pair<std::string, std::string>> entries_;
+};
+
+struct MessagingConfig {
+    std::string pubEndpoint = "shm://xalgo_bus";
+    std::string subEndpoint = "shm://xalgo_bus";
+    uint32_t shmSlots = 65536;
+    uint32_t shmSlotSize = 512;
+    int lingerMs = 0;
+    int receiveTimeoutMs = 1000;
+    int reconnectIntervalMs = 1000;
+    int heartbeatIntervalMs = 5000;
+    int monitoringIntervalMs = 1000;
+};
+
+struct RiskConfig {
+    static constexpr double kUnlimited = std::numeric_limits<double>::max();
+
+    double capital = 100e6;
+    double maxDrawdown = 0.03;                 // fraction of capital
+    double maxOrderNotional = kUnlimited;
+    uint32_t maxOrdersPerSecond = 0;           // 0: no throttle
+};
+
+/// @brief Typed view of one version of the config file, resolved once at (re)load.
+/// Hot code reads these fields directly; `values` keeps every key for the rest.
+struct ConfigSnapshot {
+    MessagingConfig messaging;
+    RiskConfig risk;
+    ThreadTopology threads;                    // "threads.<name>.cpu", ".priority", ".numa_node", ".idle", ".sleep_us"
+    ConfigValues values;
+    std::string source;
+    uint64_t version = 0;                      // 1 for the first successful load
+
+    /// @brief Resolve the typed sections from `values`, defaulting what is missing.
+    static ConfigSnapshot fromValues(ConfigValues values);
+};
+
+/// @brief Loads a JSON (or indentation-nested "key: value" YAML) config file into an
+/// immutable ConfigSnapshot and keeps it current.
+///
+/// snapshot() is wait-free: it hands back an RCU guard over the current version, so a
+/// trading thread never takes a lock or parses a string to read its settings. reload()
+/// (or the watcher thread, which polls the file's modification time) parses the file
+/// off the hot path and publishes a whole new snapshot atomically; readers see either
+/// the old version or the new one, never a mix. A file that fails to parse is
+/// reported through lastError() and leaves the current snapshot in place.
+class ConfigLoader {
+public:
+    using Snapshot = RcuSnapshot<ConfigSnapshot>::ReadGuard;
+    using Listener = std::function<void(const ConfigSnapshot&)>;
+
+    /// @brief Load `path` now. On failure the snapshot holds the defaults and ok() is false.
+    explicit ConfigLoader(const std::string& path);
+    ~ConfigLoader();
+
+    ConfigLoader(const ConfigLoader&) = delete;
+    ConfigLoader& operator=(const ConfigLoader&) = delete;
+
+    [[nodiscard]] inline Snapshot snapshot() const noexcept { return current_.read(); }
+
+    /// @brief Lookup on the current snapshot, for cold paths.
+    [[nodiscard]] int getInt(std::string_view key, int defaultValue) const;
+    [[nodiscard]] double getDouble(std::string_view key, double defaultValue) const;
+    [[nodiscard]] bool getBool(std::string_view key, bool defaultValue) const;
+    [[nodiscard]] std::string getString(std::string_view key, std::string_view defaultValue) const;
+
+    /// @brief Re-read the file and publish it if it parses. Blocks for one RCU grace
+    /// period; never call it while holding a Snapshot.
+    bool reload();
+
+    /// @brief Called, on the reloading thread, with each snapshot published after this
+    /// call, e.g. to push new limits into a RiskManager. A listener must not reload().
+    void onReload(Listener listener);
+
+    /// @brief Poll the file every `interval` and reload when it changes.
+    /// @return false if a watcher is already running.
+    bool startWatcher(std::chrono::milliseconds interval);
+    void stopWatcher();
+
+    [[nodiscard]] bool ok() const;
+    [[nodiscard]] std::string lastError() const;
+    [[nodiscard]] const std::string& path() const noexcept { return path_; }
+
+    /// @brief Parse config text; the format follows the file extension (".yaml"/".yml"
+    /// or JSON otherwise). Returns nothing and fills `error` on a syntax error.
+    static std::optional<ConfigValues> parse(std::string_view text, std::string_view path, std::string* error);
+
+private:
+    struct FileStamp {
+        std::time_t modified = 0;
+        long modifiedNs = 0;
+        int64_t size = -1;
+        bool operator==(const FileStamp&) const = default;
+    };
+
+    std::unique_ptr<ConfigSnapshot> load(std::string* error) const;
+    [[nodiscard]] FileStamp stamp() const;
+    void watcherLoop(std::chrono::milliseconds interval);
+
+    const std::string path_;
+    RcuSnapshot<ConfigSnapshot> current_;
+
+    mutable std::mutex mutex_;                 // reloads, listeners, status
+    std::vector<Listener> listeners_;
+    std::string lastError_;
+    uint64_t version_ = 0;
+    FileStamp loadedStamp_;
+
+    std::mutex watcherMutex_;
+    std::condition_variable watcherWake_;
+    bool watcherStop_ = false;
+    std::thread watcher_;
+};
+
+} // namespace TradingSystem
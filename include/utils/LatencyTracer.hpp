@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "utils/Metrics.hpp"
+#include "utils/TraceContext.hpp"
+
+namespace TradingSystem {
+
+/// @brief Folds finished TraceContexts into per-stage latency histograms.
+///
+/// For each stage a trace reached, the histogram "<prefix>.<stage>" gets the time since
+/// the previous stage it reached (stages a path skips are simply absent), and
+/// "<prefix>.total" gets Receive to the last stage reached. The histograms are
+/// registered in the given Metrics, so they are exported with everything else.
+/// record() is lock-free and may be called from any thread, e.g. every venue worker.
+class LatencyTracer {
+public:
+    explicit LatencyTracer(Metrics& metrics, std::string_view prefix = "tick_to_trade");
+
+    LatencyTracer(const LatencyTracer&) = delete;
+    LatencyTracer& operator=(const LatencyTracer&) = delete;
+
+    inline void record(const TraceContext& trace) noexcept {
+        if (!trace.active()) return;
+        uint64_t previous = 0;
+        for (std::size_t i = 0; i < trace.offsets.size(); ++i) {
+            const uint64_t at = trace.offsets[i];
+            if (at == 0) continue;
+            stages_[i]->record(static_cast<uint64_t>(TscClock::toNanos(at - previous)));
+            previous = at;
+        }
+        if (previous != 0) total_->record(static_cast<uint64_t>(TscClock::toNanos(previous)));
+    }
+
+    /// @brief Time from the previous reached stage to `stage`. Receive starts every
+    /// trace and has no histogram of its own; stage(Receive) is total().
+    [[nodiscard]] const LatencyHistogram& stage(TraceStage stage) const noexcept {
+        return stage == TraceStage::Receive || stage == TraceStage::Count
+                   ? *total_
+                   : *stages_[static_cast<std::size_t>(stage) - 1];
+    }
+    [[nodiscard]] const LatencyHistogram& total() const noexcept { return *total_; }
+
+    /// @brief One line per stage: count, p50, p99, p99.9 and max, in ns.
+    [[nodiscard]] std::string report() const;
+
+private:
+    std::array<LatencyHistogram*, kTraceStageCount - 1> stages_{};   // TickEngine..VenueSend
+    LatencyHistogram* total_;
+};
+
+} // namespace TradingSystem
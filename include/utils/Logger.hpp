@@ -0,0 +1,281 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "utils/Clock.hpp"
+
+namespace TradingSystem {
+
+enum class LogLevel : uint8_t { Debug = 0, Info, Warn, Error };
+
+namespace log_detail {
+
+enum class ArgType : uint8_t { I64 = 1, U64, F64, Bool, Char, Str, Ptr };
+
+/// Longest string argument kept; longer ones are truncated.
+inline constexpr uint32_t kMaxStringArg = 1024;
+
+// Fixed 16-byte header in front of every record in a ring. Records are padded to
+// 16 bytes, so a padding record always fits before the wrap.
+struct RecordHeader {
+    uint32_t size;      // whole record, header included
+    uint8_t level;      // LogLevel, or kPadding
+    uint8_t argc;
+    uint16_t reserved;
+    uint64_t tsc;
+};
+static_assert(sizeof(RecordHeader) == 16);
+inline constexpr uint8_t kPadding = 0xFF;
+
+inline std::string_view asString(std::string_view v) noexcept { return v; }
+inline std::string_view asString(const char* v) noexcept { return v != nullptr ? std::string_view(v) : "(null)"; }
+
+template <typename T>
+inline constexpr bool kIsString = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+                                  || std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+template <typename Raw>
+inline std::size_t encodedSize(const Raw& v) noexcept {
+    using T = std::decay_t<Raw>;
+    if constexpr (kIsString<T>) {
+        const std::size_t n = asString(v).size();
+        return 1 + sizeof(uint32_t) + (n < kMaxStringArg ? n : kMaxStringArg);
+    } else {
+        return 1 + sizeof(uint64_t);
+    }
+}
+
+template <typename Raw>
+inline char* encode(char* p, const Raw& v) noexcept {
+    using T = std::decay_t<Raw>;
+    auto scalar = [&](ArgType type, auto value) {
+        *p++ = static_cast<char>(type);
+        std::memcpy(p, &value, sizeof(uint64_t));
+        return p + sizeof(uint64_t);
+    };
+    if constexpr (kIsString<T>) {
+        const std::string_view s = asString(v);
+        const uint32_t n = static_cast<uint32_t>(s.size() < kMaxStringArg ? s.size() : kMaxStringArg);
+        *p++ = static_cast<char>(ArgType::Str);
+        std::memcpy(p, &n, sizeof(n));
+        std::memcpy(p + sizeof(n), s.data(), n);
+        return p + sizeof(n) + n;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return scalar(ArgType::Bool, static_cast<uint64_t>(v));
+    } else if constexpr (std::is_same_v<T, char>) {
+        return scalar(ArgType::Char, static_cast<uint64_t>(static_cast<unsigned char>(v)));
+    } else if constexpr (std::is_enum_v<T>) {
+        return scalar(ArgType::I64, static_cast<int64_t>(v));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        return scalar(ArgType::I64, static_cast<int64_t>(v));
+    } else if constexpr (std::is_integral_v<T>) {
+        return scalar(ArgType::U64, static_cast<uint64_t>(v));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return scalar(ArgType::F64, static_cast<double>(v));
+    } else if constexpr (std::is_pointer_v<T>) {
+        return scalar(ArgType::Ptr, reinterpret_cast<uint64_t>(v));
+    } else {
+        static_assert(std::is_void_v<T>, "unsupported log argument type");
+        return p;
+    }
+}
+
+/// @brief Byte length of `argc` encoded arguments starting at `args`.
+std::size_t encodedArgsLength(const char* args, uint8_t argc) noexcept;
+
+/// @brief Substitute encoded arguments into the "{}" placeholders of `format`.
+void appendFormatted(std::string& out, std::string_view format, const char* args, uint8_t argc);
+
+/// @brief "2026-10-16 17:08:11.123456 INFO  [T1] message\n"
+void appendLine(std::string& out, int64_t wallNs, LogLevel level, uint32_t thread, std::string_view format,
+                const char* args, uint8_t argc);
+
+// Single-producer single-consumer byte ring of variable-length records.
+class LogRing {
+public:
+    LogRing(std::size_t capacity, uint32_t index);
+
+    /// @return where to write `size` bytes, or nullptr if the ring is full.
+    inline char* reserve(std::size_t size) noexcept {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t offset = head & mask_;
+        const std::size_t toEnd = capacity_ - offset;
+        const std::size_t wasted = toEnd < size ? toEnd : 0;
+        if (head + wasted + size - cachedTail_ > capacity_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head + wasted + size - cachedTail_ > capacity_) return nullptr;
+        }
+        if (wasted != 0) {
+            const RecordHeader pad{static_cast<uint32_t>(wasted), kPadding, 0, 0, 0};
+            std::memcpy(buffer_.get() + offset, &pad, sizeof(pad));
+            head += wasted;
+        }
+        reservedHead_ = head + size;
+        return buffer_.get() + (head & mask_);
+    }
+
+    inline void commit() noexcept { head_.store(reservedHead_, std::memory_order_release); }
+    inline void drop() noexcept { dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] inline uint32_t index() const noexcept { return index_; }
+    [[nodiscard]] inline uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    // Consumer side.
+    [[nodiscard]] inline uint64_t published() const noexcept { return head_.load(std::memory_order_acquire); }
+    [[nodiscard]] inline uint64_t consumed() const noexcept { return tail_.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline const char* at(uint64_t position) const noexcept { return buffer_.get() + (position & mask_); }
+    inline void release(uint64_t position) noexcept { tail_.store(position, std::memory_order_release); }
+
+private:
+    std::unique_ptr<char[]> buffer_;
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    const uint32_t index_;
+
+    alignas(kCacheLineSize) std::atomic<uint64_t> head_{0};   // producer
+    uint64_t reservedHead_ = 0;
+    uint64_t cachedTail_ = 0;
+    std::atomic<uint64_t> dropped_{0};
+    alignas(kCacheLineSize) std::atomic<uint64_t> tail_{0};   // consumer
+};
+
+} // namespace log_detail
+
+/// @brief Asynchronous logger: the calling thread only copies its arguments.
+///
+/// info("Order {} filled at {}", id, px) writes a 16-byte header, the format string's
+/// address and the raw arguments into the calling thread's SPSC ring, with no lock,
+/// no formatting and no syscall. A background thread drains every ring, substitutes
+/// the "{}" placeholders and writes the lines out (or, in binary mode, writes the raw
+/// records plus a one-off copy of each format string, for decode() to render offline).
+///
+/// Format strings must be string literals: only their address is recorded. Arguments
+/// may be integers, floating point, bool, char, enums, pointers and strings (copied,
+/// up to 1KB). A full ring drops the message and counts it rather than block the
+/// caller. Lines from different threads are ordered per thread, not globally; each
+/// carries its timestamp.
+class Logger {
+public:
+    struct Options {
+        std::string path;                      // empty: text to stderr
+        bool binary = false;                   // needs a path
+        LogLevel minLevel = LogLevel::Info;
+        std::size_t ringBytes = 1 << 20;       // per thread, rounded up to a power of two
+        std::chrono::microseconds idleSleep{500};
+    };
+
+    Logger();
+    explicit Logger(Options options);
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    template <std::size_t N, typename... Args>
+    inline void debug(const char (&format)[N], const Args&... args) noexcept { write(LogLevel::Debug, format, args...); }
+    template <std::size_t N, typename... Args>
+    inline void info(const char (&format)[N], const Args&... args) noexcept { write(LogLevel::Info, format, args...); }
+    template <std::size_t N, typename... Args>
+    inline void warn(const char (&format)[N], const Args&... args) noexcept { write(LogLevel::Warn, format, args...); }
+    template <std::size_t N, typename... Args>
+    inline void error(const char (&format)[N], const Args&... args) noexcept { write(LogLevel::Error, format, args...); }
+
+    inline void setLevel(LogLevel level) noexcept { minLevel_.store(level, std::memory_order_relaxed); }
+    [[nodiscard]] inline bool enabled(LogLevel level) const noexcept {
+        return level >= minLevel_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Block until everything logged before the call has been written.
+    void flush();
+
+    /// @brief Messages dropped on full rings, all threads.
+    [[nodiscard]] uint64_t dropped() const;
+
+    /// @brief Threads that have logged through this logger; each has exactly one ring.
+    [[nodiscard]] std::size_t ringCount() const noexcept { return ringCount_.load(std::memory_order_acquire); }
+
+    /// @brief Render a binary log as text lines. Offline; see src/tools/log_decode.cpp.
+    /// @return false if the file is missing, not a binary log, or truncated mid-record.
+    static bool decode(const std::string& binaryPath, std::FILE* out);
+
+private:
+    template <typename... Args>
+    inline void write(LogLevel level, const char* format, const Args&... args) noexcept {
+        if (!enabled(level)) return;
+        static_assert(sizeof...(Args) < 256, "too many log arguments");
+        const std::size_t body = sizeof(const char*) + (std::size_t{0} + ... + log_detail::encodedSize(args));
+        const std::size_t size = (sizeof(log_detail::RecordHeader) + body + 15) & ~std::size_t{15};
+
+        log_detail::LogRing& ring = localRing();
+        char* p = size <= ring.capacity() / 4 ? ring.reserve(size) : nullptr;
+        if (p == nullptr) {
+            ring.drop();
+            return;
+        }
+        const log_detail::RecordHeader header{static_cast<uint32_t>(size), static_cast<uint8_t>(level),
+                                              static_cast<uint8_t>(sizeof...(Args)), 0, TscClock::now()};
+        std::memcpy(p, &header, sizeof(header));
+        p += sizeof(header);
+        std::memcpy(p, &format, sizeof(format));
+        p += sizeof(format);
+        ((p = log_detail::encode(p, args)), ...);
+        ring.commit();
+    }
+
+    inline log_detail::LogRing& localRing() {
+        struct Cache {
+            uint64_t owner = 0;
+            log_detail::LogRing* ring = nullptr;
+        };
+        // Last logger used; a thread switching between loggers falls back to threadRing().
+        thread_local Cache cache;
+        if (cache.owner != id_) cache = Cache{id_, &threadRing()};
+        return *cache.ring;
+    }
+
+    // This thread's ring in this logger, created (under ringsMutex_) on first use only.
+    log_detail::LogRing& threadRing();
+    void run();
+    bool drain(std::vector<log_detail::LogRing*>& rings);
+    void emit(const log_detail::LogRing& ring, const char* record);
+    [[nodiscard]] int64_t wallNanos(uint64_t tsc) const noexcept;
+
+    const uint64_t id_;                 // never reused, so stale thread caches cannot match
+    Options options_;
+    std::atomic<LogLevel> minLevel_;
+    const uint64_t tscAnchor_;
+    const int64_t wallAnchorNs_;
+
+    mutable std::mutex ringsMutex_;
+    std::vector<std::unique_ptr<log_detail::LogRing>> rings_;
+    std::atomic<std::size_t> ringCount_{0};
+
+    // Writer thread only.
+    std::FILE* out_ = nullptr;
+    bool ownsOut_ = false;
+    std::string buffer_;
+    std::vector<std::pair<const char*, uint32_t>> formatIds_;   // binary mode
+
+    std::atomic<uint64_t> drainedPasses_{0};
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+};
+
+/// @brief Process-wide logger (text to stderr) for code without an injected one.
+Logger& defaultLogger();
+
+} // namespace TradingSystem
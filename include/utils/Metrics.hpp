@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "utils/Clock.hpp"
+
+namespace TradingSystem {
+
+class Metrics;
+
+/// @brief Lock-free log-linear latency histogram (HDR style), in nanoseconds.
+///
+/// Values below 32 get their own bucket; above that every power of two is split
+/// into 32 sub-buckets, so a reported percentile is within ~3% of the true value.
+/// Values above kMaxValue (~18 minutes) are clamped. record() is one relaxed atomic
+/// add on the bucket, plus a compare-exchange only when the maximum grows.
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr uint64_t kSubBuckets = uint64_t{1} << kSubBucketBits;
+    static constexpr unsigned kMaxValueBits = 40;
+    static constexpr uint64_t kMaxValue = (uint64_t{1} << kMaxValueBits) - 1;
+    static constexpr std::size_t kBucketCount = (kMaxValueBits - kSubBucketBits + 1) * kSubBuckets;
+
+    struct Summary {
+        uint64_t count = 0;
+        uint64_t p50 = 0;
+        uint64_t p99 = 0;
+        uint64_t p999 = 0;
+        uint64_t max = 0;
+    };
+
+    LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    inline void record(uint64_t nanos) noexcept {
+        const uint64_t v = nanos < kMaxValue ? nanos : kMaxValue;
+        buckets_[bucketOf(v)].fetch_add(1, std::memory_order_relaxed);
+        uint64_t seen = max_.load(std::memory_order_relaxed);
+        while (v > seen && !max_.compare_exchange_weak(seen, v, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// @brief Record the time elapsed since a TscClock::now() stamp.
+    inline void recordSince(uint64_t startTicks) noexcept {
+        record(static_cast<uint64_t>(TscClock::toNanos(TscClock::now() - startTicks)));
+    }
+
+    /// @brief Smallest recorded-bucket upper bound covering `quantile` of the samples.
+    [[nodiscard]] uint64_t percentile(double quantile) const noexcept;
+    [[nodiscard]] Summary summary() const noexcept;
+    [[nodiscard]] uint64_t count() const noexcept;
+
+    /// @brief Zero every bucket. Not atomic with respect to concurrent record().
+    void reset() noexcept;
+
+    [[nodiscard]] static constexpr std::size_t bucketOf(uint64_t v) noexcept {
+        if (v < kSubBuckets) return static_cast<std::size_t>(v);
+        const unsigned shift = static_cast<unsigned>(std::bit_width(v)) - 1 - kSubBucketBits;
+        return static_cast<std::size_t>((shift + 1) * kSubBuckets + ((v >> shift) - kSubBuckets));
+    }
+
+    /// @brief Largest value that lands in `bucket`.
+    [[nodiscard]] static constexpr uint64_t upperBoundOf(std::size_t bucket) noexcept {
+        if (bucket < 2 * kSubBuckets) return bucket;
+        const uint64_t shift = bucket / kSubBuckets - 1;
+        const uint64_t sub = bucket % kSubBuckets + kSubBuckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    alignas(kCacheLineSize) std::atomic<uint64_t> max_{0};
+};
+
+/// @brief Handle to a registered counter. Cheap to copy; add() touches only the
+/// calling thread's slot, so counting never contends across threads.
+class Counter {
+public:
+    Counter() noexcept = default;
+
+    inline void add(uint64_t delta = 1) const noexcept;
+
+    /// @brief Sum across threads. Off the hot path.
+    [[nodiscard]] uint64_t value() const noexcept;
+
+    [[nodiscard]] explicit operator bool() const noexcept { return metrics_ != nullptr; }
+
+private:
+    friend class Metrics;
+    Counter(Metrics* metrics, uint32_t index) noexcept : metrics_(metrics), index_(index) {}
+
+    Metrics* metrics_ = nullptr;
+    uint32_t index_ = 0;
+};
+
+/// @brief Handle to a registered gauge: the last value set from any thread.
+class Gauge {
+public:
+    Gauge() noexcept = default;
+
+    inline void set(double value) const noexcept {
+        if (cell_ != nullptr) cell_->store(value, std::memory_order_relaxed);
+    }
+    [[nodiscard]] inline double value() const noexcept {
+        return cell_ != nullptr ? cell_->load(std::memory_order_relaxed) : 0.0;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return cell_ != nullptr; }
+
+private:
+    friend class Metrics;
+    explicit Gauge(std::atomic<double>* cell) noexcept : cell_(cell) {}
+
+    std::atomic<double>* cell_ = nullptr;
+};
+
+/// @brief Point-in-time view of every registered metric.
+struct MetricsSnapshot {
+    std::chrono::system_clock::time_point taken;
+    std::vector<std::pair<std::string, uint64_t>> counters;
+    std::vector<std::pair<std::string, double>> gauges;
+    std::vector<std::pair<std::string, LatencyHistogram::Summary>> histograms;
+
+    /// @brief Prometheus text exposition; '.' in names becomes '_'.
+    [[nodiscard]] std::string toText() const;
+};
+
+/// @brief Process metrics: named counters, gauges and latency histograms.
+///
+/// Names resolve to handles once, at registration (which takes a lock); recording
+/// through a handle never locks or allocates. Each thread that counts gets its own
+/// cache-line-aligned block of counter slots and bumps them with plain relaxed
+/// stores; snapshot() sums the blocks. A background exporter can write the snapshot
+/// to a file periodically for a scraper or sidecar to pick up.
+///
+/// increment(name)/gauge(name) remain for cold paths; they look the name up each call.
+class Metrics {
+public:
+    /// @param maxCounters counters registrable; further registrations return a handle
+    ///        whose adds are discarded
+    explicit Metrics(std::size_t maxCounters = 1024, std::size_t maxGauges = 1024);
+    ~Metrics();
+
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+
+    /// @brief Register (or look up) a metric. Returns the same handle for the same name.
+    Counter counter(std::string_view name);
+    Gauge gaugeHandle(std::string_view name);
+    LatencyHistogram& histogram(std::string_view name);
+
+    /// @brief Convenience forms for cold paths: one name lookup per call.
+    void increment(std::string_view name, uint64_t delta = 1);
+    void gauge(std::string_view name, double value);
+
+    [[nodiscard]] MetricsSnapshot snapshot() const;
+
+    /// @brief Write snapshot().toText() to `path` every `interval` (via a temporary
+    /// file and rename, so readers never see a partial file).
+    /// @return false if an exporter is already running.
+    bool startExporter(std::string path, std::chrono::milliseconds interval);
+    void stopExporter();
+
+    /// @brief Write one snapshot to `path` now.
+    bool exportTo(const std::string& path) const;
+
+private:
+    friend class Counter;
+
+    static constexpr std::size_t kSlotsPerLine = kCacheLineSize / sizeof(uint64_t);
+    struct alignas(kCacheLineSize) SlotLine {
+        std::array<std::atomic<uint64_t>, kSlotsPerLine> slots{};
+    };
+    using ThreadBlock = std::unique_ptr<SlotLine[]>;
+
+    inline std::atomic<uint64_t>& slot(uint32_t index) noexcept {
+        struct Cache {
+            uint64_t owner = 0;
+            SlotLine* block = nullptr;
+        };
+        thread_local Cache cache;
+        if (cache.owner != id_) cache = Cache{id_, localBlock()};
+        return cache.block[index / kSlotsPerLine].slots[index % kSlotsPerLine];
+    }
+
+    SlotLine* localBlock();
+    [[nodiscard]] uint64_t sum(uint32_t index) const noexcept;
+    void exporterLoop(std::string path, std::chrono::milliseconds interval);
+
+    const uint64_t id_;                // never reused, so stale thread caches cannot match
+    const std::size_t maxCounters_;    // slot maxCounters_ is the overflow sink
+    const std::size_t maxGauges_;
+    const std::size_t linesPerBlock_;
+
+    mutable std::mutex mutex_;         // registration, block list, snapshot
+    std::vector<std::string> counterNames_;
+    std::vector<std::string> gaugeNames_;
+    std::unique_ptr<std::atomic<double>[]> gauges_;
+    std::vector<std::pair<std::string, std::unique_ptr<LatencyHistogram>>> histograms_;
+    std::vector<ThreadBlock> blocks_;
+
+    std::mutex exporterMutex_;
+    std::condition_variable exporterWake_;
+    bool exporterStop_ = false;
+    std::thread exporter_;
+};
+
+inline void Counter::add(uint64_t delta) const noexcept {
+    if (metrics_ == nullptr) return;
+    // Only this thread writes its slot: no read-modify-write instruction needed.
+    std::atomic<uint64_t>& s = metrics_->slot(index_);
+    s.store(s.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+} // namespace TradingSystem
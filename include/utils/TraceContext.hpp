@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "utils/Clock.hpp"
+
+namespace TradingSystem {
+
+/// @brief Points on the tick-to-trade path, in pipeline order. Each is stamped when
+/// that stage has finished with the message.
+enum class TraceStage : uint8_t {
+    Receive = 0,   // read off the wire (ZMQ or shared memory)
+    TickEngine,    // quote ingested, triangle updated
+    Signal,        // Z-score computed
+    RiskCheck,     // pre-trade checks passed
+    Router,        // venues chosen, order queued to their workers
+    VenueSend,     // handed to the venue transport
+    Count
+};
+
+inline constexpr std::size_t kTraceStageCount = static_cast<std::size_t>(TraceStage::Count);
+
+[[nodiscard]] constexpr std::string_view toString(TraceStage stage) noexcept {
+    switch (stage) {
+    case TraceStage::Receive: return "receive";
+    case TraceStage::TickEngine: return "tick_engine";
+    case TraceStage::Signal: return "signal";
+    case TraceStage::RiskCheck: return "risk_check";
+    case TraceStage::Router: return "router";
+    case TraceStage::VenueSend: return "venue_send";
+    case TraceStage::Count: break;
+    }
+    return "unknown";
+}
+
+/// @brief Per-message stage timestamps, carried by value from the received message to
+/// the venue send: through TickData, Order, the router's VenueOrder and TradeLeg.
+///
+/// 32 bytes: the receive TSC plus each later stage as a 32-bit tick offset from it
+/// (saturating after ~1s at 3GHz, far beyond any live order). A default-constructed
+/// context is inactive, and mark(stage) on it returns before reading the clock, so
+/// untraced messages cost one branch per stage.
+struct TraceContext {
+    uint64_t origin = 0;                                        // TSC at Receive; 0: not traced
+    std::array<uint32_t, kTraceStageCount - 1> offsets{};       // ticks after origin; 0: not reached
+
+    [[nodiscard]] static inline TraceContext begin(uint64_t receiveTsc = TscClock::now()) noexcept {
+        TraceContext trace;
+        trace.origin = receiveTsc != 0 ? receiveTsc : 1;
+        return trace;
+    }
+
+    [[nodiscard]] inline bool active() const noexcept { return origin != 0; }
+
+    /// @brief Stamp `stage` now. The clock is read only if the context is active.
+    inline void mark(TraceStage stage) noexcept {
+        if (origin != 0) mark(stage, TscClock::now());
+    }
+
+    inline void mark(TraceStage stage, uint64_t now) noexcept {
+        if (origin == 0 || stage == TraceStage::Receive || stage == TraceStage::Count) return;
+        const uint64_t delta = now > origin ? now - origin : 1;   // 0 is reserved for "not reached"
+        offsets[static_cast<std::size_t>(stage) - 1] = delta < UINT32_MAX ? static_cast<uint32_t>(delta) : UINT32_MAX;
+    }
+
+    [[nodiscard]] inline bool reached(TraceStage stage) const noexcept {
+        if (stage == TraceStage::Receive) return active();
+        return stage != TraceStage::Count && offsets[static_cast<std::size_t>(stage) - 1] != 0;
+    }
+
+    /// @brief Ticks from Receive to `stage`; 0 if it was not reached.
+    [[nodiscard]] inline uint64_t sinceReceive(TraceStage stage) const noexcept {
+        return stage == TraceStage::Receive || stage == TraceStage::Count
+                   ? 0
+                   : offsets[static_cast<std::size_t>(stage) - 1];
+    }
+};
+
+static_assert(sizeof(TraceContext) == 32);
+static_assert(std::is_trivially_copyable_v<TraceContext>);
+
+} // namespace TradingSystem
@@ -0,0 +1,551 @@
+// ConfigLoader.cpp
+#include "utils/ConfigLoader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+#include <sys/stat.h>
+
+namespace TradingSystem {
+
+namespace {
+
+using Entries = std::vector<std::pair<std::string, std::string>>;
+
+std::string joinKey(const std::string& prefix, std::string_view key) {
+    return prefix.empty() ? std::string(key) : prefix + "." + std::string(key);
+}
+
+template <typename T>
+bool parseWhole(std::string_view text, T& out) noexcept {
+    const char* end = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+    return ec == std::errc() && ptr == end;
+}
+
+// ---------------------------------------------------------------- JSON
+
+class JsonParser {
+public:
+    JsonParser(std::string_view text, Entries& out) : text_(text), out_(out) {}
+
+    bool run(std::string* error) {
+        skipSpace();
+        const bool parsed = value(std::string(), 0) && (skipSpace(), pos_ == text_.size() || fail("trailing characters"));
+        if (!parsed && error != nullptr) *error = describe();
+        return parsed;
+    }
+
+private:
+    static constexpr int kMaxDepth = 64;
+
+    bool value(const std::string& key, int depth) {
+        if (depth > kMaxDepth) return fail("nesting too deep");
+        if (pos_ == text_.size()) return fail("unexpected end of input");
+        switch (text_[pos_]) {
+        case '{': return object(key, depth);
+        case '[': return array(key, depth);
+        case '"': {
+            std::string s;
+            if (!string(s)) return false;
+            out_.emplace_back(key, std::move(s));
+            return true;
+        }
+        default: return scalar(key);
+        }
+    }
+
+    bool object(const std::string& prefix, int depth) {
+        ++pos_;
+        skipSpace();
+        if (consume('}')) return true;
+        for (;;) {
+            std::string name;
+            if (pos_ == text_.size() || text_[pos_] != '"') return fail("expected a quoted key");
+            if (!string(name)) return false;
+            skipSpace();
+            if (!consume(':')) return fail("expected ':'");
+            skipSpace();
+            if (!value(joinKey(prefix, name), depth + 1)) return false;
+            skipSpace();
+            if (consume('}')) return true;
+            if (!consume(',')) return fail("expected ',' or '}'");
+            skipSpace();
+        }
+    }
+
+    bool array(const std::string& prefix, int depth) {
+        ++pos_;
+        skipSpace();
+        if (consume(']')) return true;
+        for (std::size_t index = 0;; ++index) {
+            if (!value(joinKey(prefix, std::to_string(index)), depth + 1)) return false;
+            skipSpace();
+            if (consume(']')) return true;
+            if (!consume(',')) return fail("expected ',' or ']'");
+            skipSpace();
+        }
+    }
+
+    // Numbers, true, false and null; kept as text and typed on lookup. null is dropped.
+    bool scalar(const std::string& key) {
+        const std::size_t start = pos_;
+        while (pos_ < text_.size() && !isSpace(text_[pos_]) && text_[pos_] != ',' && text_[pos_] != '}'
+               && text_[pos_] != ']') {
+            ++pos_;
+        }
+        const std::string_view token = text_.substr(start, pos_ - start);
+        double number = 0.0;
+        if (token == "true" || token == "false" || parseWhole(token, number)) {
+            out_.emplace_back(key, std::string(token));
+            return true;
+        }
+        if (token == "null") return true;
+        pos_ = start;
+        return fail("invalid value");
+    }
+
+    bool string(std::string& out) {
+        ++pos_;   // opening quote
+        while (pos_ < text_.size()) {
+            const char c = text_[pos_++];
+            if (c == '"') return true;
+            if (static_cast<unsigned char>(c) < 0x20) return fail("control character in string");
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ == text_.size()) break;
+            switch (const char e = text_[pos_++]) {
+            case '"': case '\\': case '/': out += e; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                uint32_t cp = 0;
+                if (pos_ + 4 > text_.size()
+                    || std::from_chars(text_.data() + pos_, text_.data() + pos_ + 4, cp, 16).ptr != text_.data() + pos_ + 4) {
+                    return fail("bad \\u escape");
+                }
+                pos_ += 4;
+                appendUtf8(out, cp);
+                break;
+            }
+            default: return fail("bad escape");
+            }
+        }
+        return fail("unterminated string");
+    }
+
+    static void appendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    static bool isSpace(char c) noexcept { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    void skipSpace() noexcept {
+        while (pos_ < text_.size() && isSpace(text_[pos_])) ++pos_;
+    }
+
+    bool consume(char c) noexcept {
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool fail(const char* reason) {
+        if (reason_ == nullptr) {
+            reason_ = reason;
+            failedAt_ = pos_;
+        }
+        return false;
+    }
+
+    std::string describe() const {
+        std::size_t line = 1;
+        for (std::size_t i = 0; i < failedAt_ && i < text_.size(); ++i) line += text_[i] == '\n';
+        return "line " + std::to_string(line) + ": " + (reason_ != nullptr ? reason_ : "syntax error");
+    }
+
+    std::string_view text_;
+    Entries& out_;
+    std::size_t pos_ = 0;
+    const char* reason_ = nullptr;
+    std::size_t failedAt_ = 0;
+};
+
+// ---------------------------------------------------------------- YAML subset
+//
+// Block mappings nested by indentation, "- scalar" sequences, '#' comments and
+// quoted or plain scalars. Flow collections, anchors and multi-line strings are not
+// supported and are reported as errors rather than misread.
+
+std::string_view trim(std::string_view s) noexcept {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+    return s;
+}
+
+std::string_view stripComment(std::string_view line) noexcept {
+    char quote = 0;
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if (quote != 0) {
+            if (c == quote) quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t')) {
+            return line.substr(0, i);
+        }
+    }
+    return line;
+}
+
+bool yamlScalar(std::string_view raw, std::string& out) {
+    raw = trim(raw);
+    if (raw.size() >= 2 && (raw.front() == '"' || raw.front() == '\'') && raw.back() == raw.front()) {
+        out.assign(raw.substr(1, raw.size() - 2));
+        return true;
+    }
+    if (!raw.empty() && std::string_view("[{&*|>").find(raw.front()) != std::string_view::npos) return false;
+    out.assign(raw);
+    return true;
+}
+
+bool parseYaml(std::string_view text, Entries& out, std::string* error) {
+    struct Level {
+        std::size_t indent;
+        std::string prefix;
+        std::size_t nextIndex = 0;
+        bool inlineSequence = false;   // "key:\n- a" with the items at the key's indent
+    };
+    std::vector<Level> stack{{0, std::string()}};
+    bool rootIndentKnown = false;
+    std::string pendingKey;            // "key:" with nothing after it opens a block
+    bool pending = false;
+    std::size_t lineNo = 0;
+
+    auto fail = [&](const char* reason) {
+        if (error != nullptr) *error = "line " + std::to_string(lineNo) + ": " + reason;
+        return false;
+    };
+
+    while (!text.empty()) {
+        const std::size_t eol = text.find('\n');
+        std::string_view line = stripComment(text.substr(0, eol));
+        text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+        ++lineNo;
+
+        std::string_view content = trim(line);
+        if (content.empty() || content == "---") continue;
+        const std::size_t indent = line.find_first_not_of(' ');
+        if (line[indent] == '\t') return fail("tab indentation");
+        const bool item = content.front() == '-' && (content.size() == 1 || content[1] == ' ');
+        if (!rootIndentKnown) {
+            stack[0].indent = indent;
+            rootIndentKnown = true;
+        }
+
+        if (pending) {
+            pending = false;
+            if (indent > stack.back().indent || (indent == stack.back().indent && item)) {
+                stack.push_back({indent, pendingKey, 0, indent == stack.back().indent});
+            } else {
+                out.emplace_back(pendingKey, std::string());   // "key:" with an empty value
+            }
+        }
+        while (stack.size() > 1
+               && (indent < stack.back().indent || (stack.back().inlineSequence && !item && indent == stack.back().indent))) {
+            stack.pop_back();
+        }
+        if (indent != stack.back().indent) return fail("inconsistent indentation");
+        Level& level = stack.back();
+
+        std::string value;
+        if (item) {
+            content.remove_prefix(1);
+            if (!yamlScalar(content, value) || value.empty() || content.find(": ") != std::string_view::npos) {
+                return fail("only scalar sequence items are supported");
+            }
+            out.emplace_back(joinKey(level.prefix, std::to_string(level.nextIndex++)), std::move(value));
+            continue;
+        }
+
+        const std::size_t colon = content.find(':');
+        if (colon == std::string_view::npos || colon == 0
+            || (colon + 1 < content.size() && content[colon + 1] != ' ')) {
+            return fail("expected 'key: value'");
+        }
+        std::string key;
+        if (!yamlScalar(content.substr(0, colon), key)) return fail("unsupported key");
+        const std::string_view rest = trim(content.substr(colon + 1));
+        if (rest.empty()) {
+            pendingKey = joinKey(level.prefix, key);
+            pending = true;
+            continue;
+        }
+        if (!yamlScalar(rest, value)) return fail("flow collections, anchors and block scalars are not supported");
+        if (value != "~" && value != "null") out.emplace_back(joinKey(level.prefix, key), std::move(value));
+    }
+    if (pending) out.emplace_back(pendingKey, std::string());
+    return true;
+}
+
+bool readFile(const std::string& path, std::string& out, std::string* error) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        if (error != nullptr) *error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    char buf[4096];
+    std::size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    const bool failed = std::ferror(f) != 0;
+    std::fclose(f);
+    if (failed && error != nullptr) *error = path + ": read error";
+    return !failed;
+}
+
+template <typename Int>
+Int boundedInt(const ConfigValues& values, std::string_view key, Int defaultValue, int64_t min) noexcept {
+    const int64_t v = values.getInt(key, defaultValue);
+    return v >= min && v <= static_cast<int64_t>(std::numeric_limits<Int>::max()) ? static_cast<Int>(v) : defaultValue;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------- ConfigValues
+
+ConfigValues::ConfigValues(std::vector<std::pair<std::string, std::string>> entries) : entries_(std::move(entries)) {
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    // A repeated key keeps its last value, as a reader walking the file would expect.
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        if (i + 1 < entries_.size() && entries_[i + 1].first == entries_[i].first) continue;
+        if (kept != i) entries_[kept] = std::move(entries_[i]);
+        ++kept;
+    }
+    entries_.resize(kept);
+}
+
+const std::string* ConfigValues::find(std::string_view key) const noexcept {
+    const auto it = std::lower_bound(entries_.begin(), entries_.end(), key,
+                                     [](const auto& e, std::string_view k) { return e.first < k; });
+    return it != entries_.end() && it->first == key ? &it->second : nullptr;
+}
+
+int64_t ConfigValues::getInt(std::string_view key, int64_t defaultValue) const noexcept {
+    const std::string* v = find(key);
+    if (v == nullptr) return defaultValue;
+    int64_t i = 0;
+    if (parseWhole(*v, i)) return i;
+    // 1e6 or 5000.0 are fine as long as they are whole and in range.
+    double d = 0.0;
+    if (parseWhole(*v, d) && d == static_cast<double>(static_cast<int64_t>(d)) && d > -9.2e18 && d < 9.2e18) {
+        return static_cast<int64_t>(d);
+    }
+    return defaultValue;
+}
+
+double ConfigValues::getDouble(std::string_view key, double defaultValue) const noexcept {
+    const std::string* v = find(key);
+    double d = 0.0;
+    return v != nullptr && parseWhole(*v, d) ? d : defaultValue;
+}
+
+bool ConfigValues::getBool(std::string_view key, bool defaultValue) const noexcept {
+    const std::string* v = find(key);
+    if (v == nullptr) return defaultValue;
+    if (*v == "true" || *v == "yes" || *v == "on" || *v == "1") return true;
+    if (*v == "false" || *v == "no" || *v == "off" || *v == "0") return false;
+    return defaultValue;
+}
+
+std::string ConfigValues::getString(std::string_view key, std::string_view defaultValue) const {
+    const std::string* v = find(key);
+    return v != nullptr ? *v : std::string(defaultValue);
+}
+
+// ---------------------------------------------------------------- ConfigSnapshot
+
+ConfigSnapshot ConfigSnapshot::fromValues(ConfigValues values) {
+    ConfigSnapshot s;
+    MessagingConfig& m = s.messaging;
+    m.pubEndpoint = values.getString("pub_endpoint", m.pubEndpoint);
+    m.subEndpoint = values.getString("sub_endpoint", m.subEndpoint);
+    m.shmSlots = boundedInt(values, "shm_ring.slots", m.shmSlots, 1);
+    m.shmSlotSize = boundedInt(values, "shm_ring.slot_size", m.shmSlotSize, 1);
+    m.lingerMs = boundedInt(values, "socket_options.linger", m.lingerMs, -1);
+    m.receiveTimeoutMs = boundedInt(values, "socket_options.rcvtimeo", m.receiveTimeoutMs, -1);
+    m.reconnectIntervalMs = boundedInt(values, "reconnectIntervalMs", m.reconnectIntervalMs, 1);
+    m.heartbeatIntervalMs = boundedInt(values, "heartbeatIntervalMs", m.heartbeatIntervalMs, 1);
+    m.monitoringIntervalMs = boundedInt(values, "monitoringIntervalMs", m.monitoringIntervalMs, 1);
+
+    RiskConfig& r = s.risk;
+    r.capital = values.getDouble("risk.capital", r.capital);
+    r.maxDrawdown = values.getDouble("risk.max_drawdown", r.maxDrawdown);
+    r.maxOrderNotional = values.getDouble("risk.max_order_notional", r.maxOrderNotional);
+    r.maxOrdersPerSecond = boundedInt(values, "risk.max_orders_per_second", r.maxOrdersPerSecond, 0);
+
+    // Thread names may contain dots ("router.LMAX"); the setting is the last component.
+    constexpr std::string_view kThreads = "threads.";
+    for (const auto& [key, value] : values.entries()) {
+        if (!key.starts_with(kThreads) || key.rfind('.') <= kThreads.size()) continue;
+        const std::string name = key.substr(kThreads.size(), key.rfind('.') - kThreads.size());
+        if (s.threads.find(name) != nullptr) continue;
+        ThreadSpec spec;
+        spec.name = name;
+        const std::string prefix = std::string(kThreads) + name + ".";
+        spec.cpu = boundedInt(values, prefix + "cpu", spec.cpu, -1);
+        spec.priority = boundedInt(values, prefix + "priority", spec.priority, 0);
+        spec.numaNode = boundedInt(values, prefix + "numa_node", spec.numaNode, -1);
+        (void)parseIdlePolicy(values.getString(prefix + "idle", toString(spec.idle)), spec.idle);
+        spec.sleep = std::chrono::microseconds(boundedInt(values, prefix + "sleep_us", static_cast<int>(spec.sleep.count()), 1));
+        s.threads.threads.push_back(std::move(spec));
+    }
+
+    s.values = std::move(values);
+    return s;
+}
+
+// ---------------------------------------------------------------- ConfigLoader
+
+ConfigLoader::ConfigLoader(const std::string& path)
+    : path_(path), current_(std::make_unique<const ConfigSnapshot>()) {
+    (void)reload();
+}
+
+ConfigLoader::~ConfigLoader() {
+    stopWatcher();
+}
+
+std::optional<ConfigValues> ConfigLoader::parse(std::string_view text, std::string_view path, std::string* error) {
+    Entries entries;
+    const bool yaml = path.ends_with(".yaml") || path.ends_with(".yml");
+    const bool parsed = yaml ? parseYaml(text, entries, error) : JsonParser(text, entries).run(error);
+    if (!parsed) return std::nullopt;
+    return ConfigValues(std::move(entries));
+}
+
+std::unique_ptr<ConfigSnapshot> ConfigLoader::load(std::string* error) const {
+    std::string text;
+    if (!readFile(path_, text, error)) return nullptr;
+    std::string parseError;
+    std::optional<ConfigValues> values = parse(text, path_, &parseError);
+    if (!values) {
+        if (error != nullptr) *error = path_ + ": " + parseError;
+        return nullptr;
+    }
+    auto snap = std::make_unique<ConfigSnapshot>(ConfigSnapshot::fromValues(std::move(*values)));
+    snap->source = path_;
+    return snap;
+}
+
+bool ConfigLoader::reload() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Stamp before reading, so a write that lands mid-read is picked up by the next poll.
+    loadedStamp_ = stamp();
+    std::string error;
+    std::unique_ptr<ConfigSnapshot> next = load(&error);
+    if (next == nullptr) {
+        lastError_ = std::move(error);
+        return false;
+    }
+    next->version = ++version_;
+    lastError_.clear();
+
+    // Stays alive until the next publish, which needs mutex_.
+    const ConfigSnapshot& published = *next;
+    current_.publish(std::move(next));
+    for (const Listener& listener : listeners_) listener(published);
+    return true;
+}
+
+void ConfigLoader::onReload(Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    listeners_.push_back(std::move(listener));
+}
+
+int ConfigLoader::getInt(std::string_view key, int defaultValue) const {
+    const int64_t v = snapshot()->values.getInt(key, defaultValue);
+    return v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max() ? static_cast<int>(v)
+                                                                                        : defaultValue;
+}
+
+double ConfigLoader::getDouble(std::string_view key, double defaultValue) const {
+    return snapshot()->values.getDouble(key, defaultValue);
+}
+
+bool ConfigLoader::getBool(std::string_view key, bool defaultValue) const {
+    return snapshot()->values.getBool(key, defaultValue);
+}
+
+std::string ConfigLoader::getString(std::string_view key, std::string_view defaultValue) const {
+    return snapshot()->values.getString(key, defaultValue);
+}
+
+bool ConfigLoader::ok() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_.empty() && version_ != 0;
+}
+
+std::string ConfigLoader::lastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_;
+}
+
+ConfigLoader::FileStamp ConfigLoader::stamp() const {
+    struct stat st{};
+    if (::stat(path_.c_str(), &st) != 0) return FileStamp{};
+    return FileStamp{st.st_mtim.tv_sec, st.st_mtim.tv_nsec, static_cast<int64_t>(st.st_size)};
+}
+
+bool ConfigLoader::startWatcher(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(watcherMutex_);
+    if (watcher_.joinable()) return false;
+    watcherStop_ = false;
+    watcher_ = std::thread(&ConfigLoader::watcherLoop, this, interval);
+    return true;
+}
+
+void ConfigLoader::stopWatcher() {
+    {
+        std::lock_guard<std::mutex> lock(watcherMutex_);
+        watcherStop_ = true;
+    }
+    watcherWake_.notify_all();
+    if (watcher_.joinable()) watcher_.join();
+}
+
+void ConfigLoader::watcherLoop(std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(watcherMutex_);
+    while (!watcherWake_.wait_for(lock, interval, [this] { return watcherStop_; })) {
+        lock.unlock();
+        FileStamp seen;
+        {
+            std::lock_guard<std::mutex> status(mutex_);
+            seen = loadedStamp_;
+        }
+        if (stamp() != seen) (void)reload();
+        lock.lock();
+    }
+}
+
+} // namespace TradingSystem
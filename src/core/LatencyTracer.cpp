@@ -0,0 +1,39 @@
+// LatencyTracer.cpp
+#include "utils/LatencyTracer.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace TradingSystem {
+
+LatencyTracer::LatencyTracer(Metrics& metrics, std::string_view prefix) {
+    std::string name(prefix);
+    name += '.';
+    const std::size_t base = name.size();
+    for (std::size_t i = 0; i < stages_.size(); ++i) {
+        name.resize(base);
+        name += toString(static_cast<TraceStage>(i + 1));
+        stages_[i] = &metrics.histogram(name);
+    }
+    name.resize(base);
+    name += "total";
+    total_ = &metrics.histogram(name);
+}
+
+std::string LatencyTracer::report() const {
+    std::string out;
+    auto line = [&out](std::string_view label, const LatencyHistogram& h) {
+        const LatencyHistogram::Summary s = h.summary();
+        char buf[160];
+        const int n = std::snprintf(buf, sizeof(buf),
+                                    "%-12.*s count=%" PRIu64 " p50=%" PRIu64 "ns p99=%" PRIu64 "ns p99.9=%" PRIu64
+                                    "ns max=%" PRIu64 "ns\n",
+                                    static_cast<int>(label.size()), label.data(), s.count, s.p50, s.p99, s.p999, s.max);
+        if (n > 0) out.append(buf, static_cast<std::size_t>(n) < sizeof(buf) ? static_cast<std::size_t>(n) : sizeof(buf) - 1);
+    };
+    for (std::size_t i = 0; i < stages_.size(); ++i) line(toString(static_cast<TraceStage>(i + 1)), *stages_[i]);
+    line("total", *total_);
+    return out;
+}
+
+} // namespace TradingSystem
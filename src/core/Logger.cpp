@@ -0,0 +1,351 @@
+// Logger.cpp
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <ctime>
+
+#include "core/concurrency/ThreadRuntime.hpp"
+
+namespace TradingSystem {
+
+namespace {
+
+std::atomic<uint64_t> nextLoggerId{1};
+
+constexpr char kBinaryMagic[8] = {'X', 'A', 'L', 'G', 'O', 'L', 'G', '1'};
+constexpr uint8_t kFormatEntry = 1;
+constexpr uint8_t kRecordEntry = 2;
+
+const char* levelName(LogLevel level) noexcept {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info:  return "INFO ";
+        case LogLevel::Warn:  return "WARN ";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "?????";
+}
+
+template <typename T>
+void appendNumber(std::string& out, T value) {
+    char buf[32];
+    const auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+}
+
+template <typename T>
+void appendRaw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readRaw(const std::string& in, std::size_t& pos, T& value) {
+    if (in.size() - pos < sizeof(T)) return false;
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+// Bounds-checked walk over encoded arguments read back from a file.
+bool argsSpan(const char* p, std::size_t length, uint8_t argc) noexcept {
+    std::size_t pos = 0;
+    for (uint8_t i = 0; i < argc; ++i) {
+        if (pos >= length) return false;
+        if (static_cast<log_detail::ArgType>(p[pos++]) == log_detail::ArgType::Str) {
+            uint32_t n;
+            if (length - pos < sizeof(n)) return false;
+            std::memcpy(&n, p + pos, sizeof(n));
+            pos += sizeof(n);
+            if (length - pos < n) return false;
+            pos += n;
+        } else {
+            if (length - pos < sizeof(uint64_t)) return false;
+            pos += sizeof(uint64_t);
+        }
+    }
+    return pos == length;
+}
+
+int64_t systemNowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+// ---------------------------------------------------------------- encoding
+
+namespace log_detail {
+
+std::size_t encodedArgsLength(const char* args, uint8_t argc) noexcept {
+    const char* p = args;
+    for (uint8_t i = 0; i < argc; ++i) {
+        if (static_cast<ArgType>(*p++) == ArgType::Str) {
+            uint32_t n;
+            std::memcpy(&n, p, sizeof(n));
+            p += sizeof(n) + n;
+        } else {
+            p += sizeof(uint64_t);
+        }
+    }
+    return static_cast<std::size_t>(p - args);
+}
+
+void appendFormatted(std::string& out, std::string_view format, const char* args, uint8_t argc) {
+    const char* p = args;
+    uint8_t used = 0;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        if (format[i] != '{' || i + 1 >= format.size() || format[i + 1] != '}' || used == argc) {
+            out.push_back(format[i]);
+            continue;
+        }
+        ++i;
+        ++used;
+        const auto type = static_cast<ArgType>(*p++);
+        if (type == ArgType::Str) {
+            uint32_t n;
+            std::memcpy(&n, p, sizeof(n));
+            out.append(p + sizeof(n), n);
+            p += sizeof(n) + n;
+            continue;
+        }
+        uint64_t bits;
+        std::memcpy(&bits, p, sizeof(bits));
+        p += sizeof(bits);
+        switch (type) {
+            case ArgType::I64: appendNumber(out, static_cast<int64_t>(bits)); break;
+            case ArgType::U64: appendNumber(out, bits); break;
+            case ArgType::F64: appendNumber(out, std::bit_cast<double>(bits)); break;
+            case ArgType::Bool: out += bits != 0 ? "true" : "false"; break;
+            case ArgType::Char: out.push_back(static_cast<char>(bits)); break;
+            case ArgType::Ptr: {
+                char buf[24];
+                const auto result = std::to_chars(buf, buf + sizeof(buf), bits, 16);
+                out += "0x";
+                out.append(buf, result.ptr);
+                break;
+            }
+            case ArgType::Str: break;
+        }
+    }
+}
+
+void appendLine(std::string& out, int64_t wallNs, LogLevel level, uint32_t thread, std::string_view format,
+                const char* args, uint8_t argc) {
+    const std::time_t seconds = static_cast<std::time_t>(wallNs / 1'000'000'000);
+    std::tm utc{};
+    gmtime_r(&seconds, &utc);
+    char stamp[48];
+    const std::size_t n = std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &utc);
+    out.append(stamp, n);
+    char frac[16];
+    std::snprintf(frac, sizeof(frac), ".%06lld ", static_cast<long long>(wallNs % 1'000'000'000 / 1'000));
+    out += frac;
+    out += levelName(level);
+    out += " [T";
+    appendNumber(out, thread);
+    out += "] ";
+    appendFormatted(out, format, args, argc);
+    out.push_back('\n');
+}
+
+LogRing::LogRing(std::size_t capacity, uint32_t index)
+    : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 4096))),
+      mask_(capacity_ - 1),
+      index_(index) {
+    buffer_ = std::make_unique<char[]>(capacity_);
+}
+
+} // namespace log_detail
+
+// ---------------------------------------------------------------- Logger
+
+Logger::Logger() : Logger(Options{}) {}
+
+Logger::Logger(Options options)
+    : id_(nextLoggerId.fetch_add(1, std::memory_order_relaxed)),
+      options_(std::move(options)),
+      minLevel_(options_.minLevel),
+      tscAnchor_((TscClock::calibrate(), TscClock::now())),
+      wallAnchorNs_(systemNowNs()) {
+    if (!options_.path.empty()) {
+        out_ = std::fopen(options_.path.c_str(), options_.binary ? "wb" : "a");
+        ownsOut_ = out_ != nullptr;
+    }
+    if (out_ == nullptr) {
+        out_ = stderr;
+        options_.binary = false;
+    }
+    if (options_.binary) std::fwrite(kBinaryMagic, 1, sizeof(kBinaryMagic), out_);
+    buffer_.reserve(64 * 1024);
+    writer_ = threadRuntime().start("logger", [this] { run(); });
+}
+
+Logger::~Logger() {
+    stop_.store(true, std::memory_order_release);
+    if (writer_.joinable()) writer_.join();
+    if (ownsOut_) std::fclose(out_);
+}
+
+log_detail::LogRing& Logger::threadRing() {
+    // Every logger this thread has written to. Ids are never reused, so entries left by
+    // destroyed loggers cannot match.
+    thread_local std::vector<std::pair<uint64_t, log_detail::LogRing*>> known;
+    for (const auto& [owner, ring] : known) {
+        if (owner == id_) return *ring;
+    }
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    rings_.push_back(std::make_unique<log_detail::LogRing>(options_.ringBytes, static_cast<uint32_t>(rings_.size() + 1)));
+    ringCount_.store(rings_.size(), std::memory_order_release);
+    known.emplace_back(id_, rings_.back().get());
+    return *rings_.back();
+}
+
+void Logger::flush() {
+    // Two full passes: the one in progress may have missed records written before this call.
+    const uint64_t target = drainedPasses_.load(std::memory_order_acquire) + 2;
+    while (drainedPasses_.load(std::memory_order_acquire) < target && writer_.joinable()) {
+        std::this_thread::sleep_for(options_.idleSleep);
+    }
+}
+
+uint64_t Logger::dropped() const {
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    uint64_t total = 0;
+    for (const auto& ring : rings_) total += ring->dropped();
+    return total;
+}
+
+int64_t Logger::wallNanos(uint64_t tsc) const noexcept {
+    const double delta = static_cast<double>(static_cast<int64_t>(tsc - tscAnchor_));
+    return wallAnchorNs_ + static_cast<int64_t>(TscClock::toNanos(1) * delta);
+}
+
+void Logger::run() {
+    std::vector<log_detail::LogRing*> rings;
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (!drain(rings)) std::this_thread::sleep_for(options_.idleSleep);
+        drainedPasses_.fetch_add(1, std::memory_order_release);
+    }
+    drain(rings);   // whatever was logged before shutdown
+    drainedPasses_.fetch_add(1, std::memory_order_release);
+}
+
+bool Logger::drain(std::vector<log_detail::LogRing*>& rings) {
+    if (ringCount_.load(std::memory_order_acquire) != rings.size()) {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings.clear();
+        for (const auto& ring : rings_) rings.push_back(ring.get());
+    }
+
+    bool any = false;
+    for (log_detail::LogRing* ring : rings) {
+        uint64_t position = ring->consumed();
+        const uint64_t head = ring->published();
+        if (position == head) continue;
+        while (position != head) {
+            log_detail::RecordHeader header;
+            std::memcpy(&header, ring->at(position), sizeof(header));
+            if (header.level != log_detail::kPadding) emit(*ring, ring->at(position));
+            position += header.size;
+        }
+        ring->release(position);
+        any = true;
+    }
+    if (any) {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), out_);
+        std::fflush(out_);
+        buffer_.clear();
+    }
+    return any;
+}
+
+void Logger::emit(const log_detail::LogRing& ring, const char* record) {
+    log_detail::RecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+    const char* format;
+    std::memcpy(&format, record + sizeof(header), sizeof(format));
+    const char* args = record + sizeof(header) + sizeof(format);
+    const int64_t wallNs = wallNanos(header.tsc);
+
+    if (!options_.binary) {
+        log_detail::appendLine(buffer_, wallNs, static_cast<LogLevel>(header.level), ring.index(), format, args,
+                               header.argc);
+        return;
+    }
+
+    // Binary: each format string once, then records that refer to it by id.
+    auto it = std::find_if(formatIds_.begin(), formatIds_.end(), [&](const auto& f) { return f.first == format; });
+    uint32_t formatId;
+    if (it != formatIds_.end()) {
+        formatId = it->second;
+    } else {
+        formatId = static_cast<uint32_t>(formatIds_.size());
+        formatIds_.emplace_back(format, formatId);
+        const uint32_t length = static_cast<uint32_t>(std::strlen(format));
+        appendRaw(buffer_, kFormatEntry);
+        appendRaw(buffer_, formatId);
+        appendRaw(buffer_, length);
+        buffer_.append(format, length);
+    }
+    const uint32_t argBytes = static_cast<uint32_t>(log_detail::encodedArgsLength(args, header.argc));
+    appendRaw(buffer_, kRecordEntry);
+    appendRaw(buffer_, header.level);
+    appendRaw(buffer_, header.argc);
+    appendRaw(buffer_, ring.index());
+    appendRaw(buffer_, wallNs);
+    appendRaw(buffer_, formatId);
+    appendRaw(buffer_, argBytes);
+    buffer_.append(args, argBytes);
+}
+
+bool Logger::decode(const std::string& binaryPath, std::FILE* out) {
+    std::FILE* in = std::fopen(binaryPath.c_str(), "rb");
+    if (in == nullptr) return false;
+    std::string data;
+    char chunk[64 * 1024];
+    for (std::size_t n; (n = std::fread(chunk, 1, sizeof(chunk), in)) != 0;) data.append(chunk, n);
+    std::fclose(in);
+
+    if (data.size() < sizeof(kBinaryMagic) || std::memcmp(data.data(), kBinaryMagic, sizeof(kBinaryMagic)) != 0) {
+        return false;
+    }
+    std::vector<std::string> formats;
+    std::string line;
+    std::size_t pos = sizeof(kBinaryMagic);
+    while (pos < data.size()) {
+        uint8_t kind;
+        readRaw(data, pos, kind);
+        uint32_t id, length;
+        if (kind == kFormatEntry) {
+            if (!readRaw(data, pos, id) || !readRaw(data, pos, length) || data.size() - pos < length) return false;
+            if (formats.size() <= id) formats.resize(id + 1);
+            formats[id].assign(data, pos, length);
+            pos += length;
+            continue;
+        }
+        uint8_t level, argc;
+        uint32_t thread;
+        int64_t wallNs;
+        if (kind != kRecordEntry || !readRaw(data, pos, level) || !readRaw(data, pos, argc)
+            || !readRaw(data, pos, thread) || !readRaw(data, pos, wallNs) || !readRaw(data, pos, id)
+            || !readRaw(data, pos, length) || data.size() - pos < length || id >= formats.size()
+            || !argsSpan(data.data() + pos, length, argc)) {
+            return false;
+        }
+        line.clear();
+        log_detail::appendLine(line, wallNs, static_cast<LogLevel>(level), thread, formats[id], data.data() + pos, argc);
+        std::fwrite(line.data(), 1, line.size(), out);
+        pos += length;
+    }
+    return true;
+}
+
+Logger& defaultLogger() {
+    static Logger logger;
+    return logger;
+}
+
+} // namespace TradingSystem
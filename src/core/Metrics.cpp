@@ -0,0 +1,230 @@
+// Metrics.cpp
+#include "utils/Metrics.hpp"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+
+namespace TradingSystem {
+
+namespace {
+
+std::atomic<uint64_t> nextMetricsId{1};
+
+std::string exportName(std::string_view name) {
+    std::string out(name);
+    for (char& c : out) {
+        if (c == '.' || c == '-' || c == '/') c = '_';
+    }
+    return out;
+}
+
+void appendLine(std::string& out, const char* format, const std::string& name, auto value) {
+    char buf[256];
+    const int n = std::snprintf(buf, sizeof(buf), format, name.c_str(), value);
+    if (n > 0) out.append(buf, static_cast<std::size_t>(n) < sizeof(buf) ? static_cast<std::size_t>(n) : sizeof(buf) - 1);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------- LatencyHistogram
+
+uint64_t LatencyHistogram::count() const noexcept {
+    uint64_t total = 0;
+    for (const auto& b : buckets_) total += b.load(std::memory_order_relaxed);
+    return total;
+}
+
+uint64_t LatencyHistogram::percentile(double quantile) const noexcept {
+    std::array<uint64_t, kBucketCount> counts;
+    uint64_t total = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) total += counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    if (total == 0) return 0;
+
+    const auto rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(total)));
+    const uint64_t target = rank == 0 ? 1 : rank;
+    const uint64_t max = max_.load(std::memory_order_relaxed);
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        seen += counts[i];
+        if (seen >= target) return upperBoundOf(i) < max ? upperBoundOf(i) : max;
+    }
+    return max;
+}
+
+LatencyHistogram::Summary LatencyHistogram::summary() const noexcept {
+    return Summary{count(), percentile(0.50), percentile(0.99), percentile(0.999), max_.load(std::memory_order_relaxed)};
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& b : buckets_) b.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------- Counter
+
+uint64_t Counter::value() const noexcept {
+    return metrics_ != nullptr ? metrics_->sum(index_) : 0;
+}
+
+// ---------------------------------------------------------------- Metrics
+
+Metrics::Metrics(std::size_t maxCounters, std::size_t maxGauges)
+    : id_(nextMetricsId.fetch_add(1, std::memory_order_relaxed)),
+      maxCounters_(maxCounters),
+      maxGauges_(maxGauges),
+      linesPerBlock_((maxCounters + 1 + kSlotsPerLine - 1) / kSlotsPerLine),
+      gauges_(std::make_unique<std::atomic<double>[]>(maxGauges)) {
+    counterNames_.reserve(maxCounters);
+    gaugeNames_.reserve(maxGauges);
+}
+
+Metrics::~Metrics() {
+    stopExporter();
+}
+
+Counter Metrics::counter(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < counterNames_.size(); ++i) {
+        if (counterNames_[i] == name) return Counter(this, static_cast<uint32_t>(i));
+    }
+    if (counterNames_.size() == maxCounters_) return Counter(this, static_cast<uint32_t>(maxCounters_));
+    counterNames_.emplace_back(name);
+    return Counter(this, static_cast<uint32_t>(counterNames_.size() - 1));
+}
+
+Gauge Metrics::gaugeHandle(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < gaugeNames_.size(); ++i) {
+        if (gaugeNames_[i] == name) return Gauge(&gauges_[i]);
+    }
+    if (gaugeNames_.size() == maxGauges_) return Gauge();
+    gaugeNames_.emplace_back(name);
+    return Gauge(&gauges_[gaugeNames_.size() - 1]);
+}
+
+LatencyHistogram& Metrics::histogram(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [existing, h] : histograms_) {
+        if (existing == name) return *h;
+    }
+    histograms_.emplace_back(std::string(name), std::make_unique<LatencyHistogram>());
+    return *histograms_.back().second;
+}
+
+void Metrics::increment(std::string_view name, uint64_t delta) {
+    counter(name).add(delta);
+}
+
+void Metrics::gauge(std::string_view name, double value) {
+    gaugeHandle(name).set(value);
+}
+
+Metrics::SlotLine* Metrics::localBlock() {
+    // Every Metrics instance this thread has counted into.
+    thread_local std::vector<std::pair<uint64_t, SlotLine*>> known;
+    for (const auto& [owner, block] : known) {
+        if (owner == id_) return block;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    blocks_.push_back(std::make_unique<SlotLine[]>(linesPerBlock_));
+    SlotLine* block = blocks_.back().get();
+    known.emplace_back(id_, block);
+    return block;
+}
+
+uint64_t Metrics::sum(uint32_t index) const noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t total = 0;
+    for (const auto& block : blocks_) {
+        total += block[index / kSlotsPerLine].slots[index % kSlotsPerLine].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+MetricsSnapshot Metrics::snapshot() const {
+    MetricsSnapshot snap;
+    snap.taken = std::chrono::system_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    snap.counters.reserve(counterNames_.size());
+    for (std::size_t i = 0; i < counterNames_.size(); ++i) {
+        uint64_t total = 0;
+        for (const auto& block : blocks_) {
+            total += block[i / kSlotsPerLine].slots[i % kSlotsPerLine].load(std::memory_order_relaxed);
+        }
+        snap.counters.emplace_back(counterNames_[i], total);
+    }
+    snap.gauges.reserve(gaugeNames_.size());
+    for (std::size_t i = 0; i < gaugeNames_.size(); ++i) {
+        snap.gauges.emplace_back(gaugeNames_[i], gauges_[i].load(std::memory_order_relaxed));
+    }
+    snap.histograms.reserve(histograms_.size());
+    for (const auto& [name, h] : histograms_) snap.histograms.emplace_back(name, h->summary());
+    return snap;
+}
+
+std::string MetricsSnapshot::toText() const {
+    std::string out;
+    for (const auto& [name, value] : counters) {
+        const std::string n = exportName(name);
+        out += "# TYPE " + n + " counter\n";
+        appendLine(out, "%s %" PRIu64 "\n", n, value);
+    }
+    for (const auto& [name, value] : gauges) {
+        const std::string n = exportName(name);
+        out += "# TYPE " + n + " gauge\n";
+        appendLine(out, "%s %.17g\n", n, value);
+    }
+    for (const auto& [name, s] : histograms) {
+        const std::string n = exportName(name);
+        out += "# TYPE " + n + " summary\n";
+        appendLine(out, "%s{quantile=\"0.5\"} %" PRIu64 "\n", n, s.p50);
+        appendLine(out, "%s{quantile=\"0.99\"} %" PRIu64 "\n", n, s.p99);
+        appendLine(out, "%s{quantile=\"0.999\"} %" PRIu64 "\n", n, s.p999);
+        appendLine(out, "%s_max %" PRIu64 "\n", n, s.max);
+        appendLine(out, "%s_count %" PRIu64 "\n", n, s.count);
+    }
+    return out;
+}
+
+bool Metrics::exportTo(const std::string& path) const {
+    const std::string text = snapshot().toText();
+    const std::string tmp = path + ".tmp";
+    std::FILE* f = std::fopen(tmp.c_str(), "w");
+    if (f == nullptr) return false;
+    const bool written = std::fwrite(text.data(), 1, text.size(), f) == text.size();
+    if (std::fclose(f) != 0 || !written) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+    return std::rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+bool Metrics::startExporter(std::string path, std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(exporterMutex_);
+    if (exporter_.joinable()) return false;
+    exporterStop_ = false;
+    exporter_ = std::thread(&Metrics::exporterLoop, this, std::move(path), interval);
+    return true;
+}
+
+void Metrics::stopExporter() {
+    {
+        std::lock_guard<std::mutex> lock(exporterMutex_);
+        exporterStop_ = true;
+    }
+    exporterWake_.notify_all();
+    if (exporter_.joinable()) exporter_.join();
+}
+
+void Metrics::exporterLoop(std::string path, std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(exporterMutex_);
+    while (!exporterWake_.wait_for(lock, interval, [this] { return exporterStop_; })) {
+        lock.unlock();
+        (void)exportTo(path);
+        lock.lock();
+    }
+    (void)exportTo(path);   // final state on shutdown
+}
+
+} // namespace TradingSystem
@@ -0,0 +1,93 @@
+// RiskManager.cpp
+#include "core/Risk/RiskManager.hpp"
+
+#include <string>
+
+namespace TradingSystem {
+
+namespace {
+
+uint64_t ticksPerSecond() noexcept {
+    TscClock::calibrate();
+    return static_cast<uint64_t>(1e15 / TscClock::toNanos(1'000'000));   // ticks in 1e9 ns
+}
+
+} // namespace
+
+const char* toString(RiskCheck check) noexcept {
+    switch (check) {
+        case RiskCheck::Accepted:         return "accepted";
+        case RiskCheck::StrategyHalted:   return "strategy_halted";
+        case RiskCheck::InvalidOrder:     return "invalid_order";
+        case RiskCheck::OrderSize:        return "order_size";
+        case RiskCheck::PriceBand:        return "price_band";
+        case RiskCheck::SymbolNotional:   return "symbol_notional";
+        case RiskCheck::CurrencyNotional: return "currency_notional";
+        case RiskCheck::OrderRate:        return "order_rate";
+        case RiskCheck::Count:            break;
+    }
+    return "unknown";
+}
+
+RiskManager::RiskManager(double capital, const PositionBook* positions, std::size_t maxSymbols)
+    : positions_(positions),
+      maxSymbols_(maxSymbols),
+      maxCurrencies_(positions != nullptr ? positions->maxCurrencies() : 0),
+      ticksPerSecond_(ticksPerSecond()),
+      symbols_(std::make_unique<SymbolState[]>(maxSymbols)),
+      currencyLimits_(std::make_unique<std::atomic<double>[]>(maxCurrencies_)),
+      allocatedCapital_(capital) {
+    for (std::size_t i = 0; i < maxCurrencies_; ++i) currencyLimits_[i].store(kUnlimited, std::memory_order_relaxed);
+}
+
+void RiskManager::updatePosition(double pnlChange) noexcept {
+    const double pnl = pnl_.fetch_add(pnlChange, std::memory_order_relaxed) + pnlChange;
+    double low = minPnL_.load(std::memory_order_relaxed);
+    while (pnl < low && !minPnL_.compare_exchange_weak(low, pnl, std::memory_order_relaxed)) {
+    }
+    const double limit = allocatedCapital_.load(std::memory_order_relaxed)
+                         * maxDrawdownFraction_.load(std::memory_order_relaxed);
+    if (currentDrawdown() > limit) halted_.store(true, std::memory_order_release);
+}
+
+void RiskManager::setSymbolLimits(SymbolId symbol, const SymbolRiskLimits& limits) noexcept {
+    if (symbol >= maxSymbols_) return;
+    SymbolState& s = symbols_[symbol];
+    s.maxOrderNotional.store(limits.maxOrderNotional, std::memory_order_relaxed);
+    s.maxPositionNotional.store(limits.maxPositionNotional, std::memory_order_relaxed);
+    s.priceBandBps.store(limits.priceBandBps, std::memory_order_relaxed);
+    s.rate.limit.store(limits.maxOrdersPerSecond, std::memory_order_relaxed);
+}
+
+bool RiskManager::setCurrencyLimit(std::string_view currency, double maxAbsExposure) noexcept {
+    if (positions_ == nullptr) return false;
+    const PositionBook::CurrencyId id = positions_->currencyId(currency);
+    if (id >= maxCurrencies_) return false;
+    currencyLimits_[id].store(maxAbsExposure, std::memory_order_relaxed);
+    return true;
+}
+
+void RiskManager::attachMetrics(Metrics& metrics, std::string_view prefix) {
+    for (std::size_t i = 1; i < rejectCounters_.size(); ++i) {
+        std::string name(prefix);
+        name += '.';
+        name += toString(static_cast<RiskCheck>(i));
+        rejectCounters_[i] = metrics.counter(name);
+    }
+}
+
+void RiskManager::publishMetrics() noexcept {
+    for (std::size_t i = 1; i < rejectCounters_.size(); ++i) {
+        const uint64_t now = rejections_[i].load(std::memory_order_relaxed);
+        rejectCounters_[i].add(now - published_[i]);
+        published_[i] = now;
+    }
+}
+
+uint64_t RiskManager::totalRejections() const noexcept {
+    uint64_t total = 0;
+    for (const auto& count : rejections_) total += count.load(std::memory_order_relaxed);
+    return total;
+}
+
+} // namespace TradingSystem
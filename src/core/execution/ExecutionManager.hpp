@@ -0,0 +1,365 @@
+// ExecutionManager.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+#include "ExecutionState.hpp"
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
+#include "core/models/TradeLeg.hpp"
+#include "utils/Clock.hpp"
+#include "utils/LatencyTracer.hpp"
+#include "utils/Logger.hpp"
+
+// Receives execution reports from venue sessions (called on the session's thread).
+class ILegReportSink {
+public:
+    virtual ~ILegReportSink() = default;
+    virtual void onLegReport(const LegReport& report) noexcept = 0;
+};
+
+// A connected venue session. submit() must not block: it copies what it needs from the
+// leg, hands it to the venue, and the outcome arrives later through sink.onLegReport(),
+// with `legIndex` and `execution` echoed in the report.
+//
+// Every submit() that returns true must be answered by exactly one report, however late:
+// a session that loses its venue, or is shut down with legs queued, reports them
+// REJECTED. ExecutionManager relies on this to outlive the reports it is owed; its
+// destructor waits for them without a time limit.
+class ILegSession {
+public:
+    virtual ~ILegSession() = default;
+    [[nodiscard]] virtual bool submit(const TradeLeg& leg, uint8_t legIndex, uint32_t execution,
+                                      ILegReportSink& sink) noexcept = 0;
+};
+
+// Scripted outcome for SimulatedVenueSession.
+struct SimulatedVenueBehaviour {
+    std::chrono::nanoseconds latency{10'000};
+    double fillRatio = 1.0;   // < 1.0 reports PARTIAL fills
+    bool rejectAll = false;
+};
+
+// In-process venue stand-in. The worker thread is started (and its queue and stack
+// touched) at construction, so the first leg sent pays no thread start-up cost; it
+// polls its order queue, waits out the configured venue latency, then reports.
+class SimulatedVenueSession final : public ILegSession {
+public:
+    using Behaviour = SimulatedVenueBehaviour;
+
+    explicit SimulatedVenueSession(Behaviour behaviour = Behaviour())
+        : behaviour_(behaviour),
+          latencyTicks_(static_cast<uint64_t>(static_cast<double>(behaviour.latency.count())
+                                              / TradingSystem::TscClock::toNanos(1))),
+          worker_(TradingSystem::threadRuntime().start("venue.sim", [this] { run(); })) {}
+
+    // Legs still queued are reported REJECTED, so no sink is left waiting on them.
+    ~SimulatedVenueSession() override {
+        stop_.store(true, std::memory_order_relaxed);
+        queue_.wakeConsumer();
+        worker_.join();
+        Request request{};
+        while (queue_.pop(request)) {
+            request.sink->onLegReport(LegReport{request.index, LegOutcome::REJECTED, 0.0, request.price,
+                                                request.execution});
+        }
+    }
+
+    SimulatedVenueSession(const SimulatedVenueSession&) = delete;
+    SimulatedVenueSession& operator=(const SimulatedVenueSession&) = delete;
+
+    bool submit(const TradeLeg& leg, uint8_t legIndex, uint32_t execution, ILegReportSink& sink) noexcept override {
+        return queue_.tryPush(Request{leg.price, leg.quantity, &sink, TradingSystem::TscClock::now(), execution, legIndex});
+    }
+
+private:
+    struct Request {
+        double price;
+        double quantity;
+        ILegReportSink* sink;
+        uint64_t sentTsc;
+        uint32_t execution;
+        uint8_t index;
+    };
+
+    void run() noexcept {
+        Request request{};
+        while (queue_.waitAndPop(request, stop_)) {
+            // Latency is measured from submit(), so queued requests do not pay it twice.
+            while (TradingSystem::TscClock::now() - request.sentTsc < latencyTicks_) {
+                TradingSystem::cpuRelax();
+            }
+
+            LegReport report;
+            report.leg = request.index;
+            report.price = request.price;
+            report.execution = request.execution;
+            if (behaviour_.rejectAll || request.quantity <= 0.0 || request.price <= 0.0) {
+                report.outcome = LegOutcome::REJECTED;
+            } else if (behaviour_.fillRatio < 1.0) {
+                report.outcome = LegOutcome::PARTIAL;
+                report.filledQuantity = request.quantity * behaviour_.fillRatio;
+            } else {
+                report.outcome = LegOutcome::FILLED;
+                report.filledQuantity = request.quantity;
+            }
+            request.sink->onLegReport(report);
+        }
+    }
+
+    Behaviour behaviour_;
+    uint64_t latencyTicks_;
+    TradingSystem::ConcurrentQueue<TradingSystem::SpscRing<Request, 64>, TradingSystem::SpinYieldWait> queue_;
+    std::atomic<bool> stop_{false};
+    std::thread worker_;
+};
+
+// How execute() sends the three legs once venue sessions are attached.
+enum class DispatchMode : uint8_t {
+    SEQUENTIAL,  // send a leg, wait for its fill, then send the next
+    PARALLEL     // fire all three legs at once and collect the acks
+};
+
+class ExecutionManager final : public ILegReportSink {
+public:
+    // Constructor: state initialized to INIT and legs are default-initialized.
+    explicit ExecutionManager(DispatchMode mode = DispatchMode::SEQUENTIAL,
+                              std::chrono::nanoseconds reportTimeout = std::chrono::seconds(1))
+        : mode_(mode),
+          reportTimeoutNs_(static_cast<double>(reportTimeout.count())),
+          state_(TradeState::INIT) {}
+
+    // Sessions still hold *this for legs they have not reported (e.g. after a timeout).
+    // Wait, without a time limit, until every accepted leg has been reported and no report
+    // is still being stored: a session that never reports breaks the ILegSession contract
+    // and blocks this destructor rather than writing into freed memory later.
+    ~ExecutionManager() {
+        while (outstanding_.load(std::memory_order_acquire) != 0 || reporting_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Disable copy and move semantics for thread safety
+    ExecutionManager(const ExecutionManager&) = delete;
+    ExecutionManager& operator=(const ExecutionManager&) = delete;
+
+    // Set the three legs of the triangular trade. Must be called prior to execution.
+    void setLegs(const TradeLeg& leg1, const TradeLeg& leg2, const TradeLeg& leg3) {
+        // Since legs are only written once and then read-only, no lock is required.
+        legs_[0] = leg1;
+        legs_[1] = leg2;
+        legs_[2] = leg3;
+    }
+
+    // Attach one pre-connected venue session per leg (the same session may serve several
+    // legs). Without sessions execute() falls back to the simulated sequential path.
+    void setSessions(ILegSession* leg1, ILegSession* leg2, ILegSession* leg3) noexcept {
+        sessions_ = {leg1, leg2, leg3};
+    }
+
+    // Legs carrying an active trace are stamped VenueSend as they are handed to their
+    // session and recorded here. Set before execute(); nullptr records nothing.
+    void setTracer(TradingSystem::LatencyTracer* tracer) noexcept { tracer_ = tracer; }
+
+    // Execute the trade using an atomic state machine. Blocks until a terminal state
+    // (COMPLETE, UNWOUND or ERROR) is reached. Reports arriving after it returns, such
+    // as a fill for a leg that timed out, are dropped rather than applied to the next trade.
+    void execute() noexcept {
+        if (sessions_[0] == nullptr || sessions_[1] == nullptr || sessions_[2] == nullptr) {
+            executeSimulated();
+            return;
+        }
+
+        const uint32_t execution = execution_.load(std::memory_order_relaxed);
+        reported_.store(0, std::memory_order_relaxed);
+        for (uint8_t i = 0; i < kReportSlots; ++i) reports_[i] = LegReport{i, LegOutcome::PENDING, 0.0, 0.0, execution};
+        executeLegs();
+        retireExecution();
+    }
+
+    // Retrieve the current state for monitoring
+    TradeState getState() const noexcept {
+        return state_.load(std::memory_order_acquire);
+    }
+
+    // Report for leg 0..2, or for the unwind of leg (i - 3) when i is 3..5.
+    // Only meaningful once execute() has returned.
+    const LegReport& report(std::size_t i) const noexcept { return reports_[i]; }
+
+    void onLegReport(const LegReport& report) noexcept override {
+        // Pairs with retireExecution(): either it sees this call in progress and waits,
+        // or this call sees the new execution number and drops a stale report.
+        reporting_.fetch_add(1, std::memory_order_seq_cst);
+        if (report.execution == execution_.load(std::memory_order_seq_cst)) store(report);
+        // Release: whoever sees the count reach 0 also sees this call in reporting_.
+        outstanding_.fetch_sub(1, std::memory_order_release);
+        reporting_.fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint8_t kReportSlots = 6;
+
+    void executeLegs() noexcept {
+        if (mode_ == DispatchMode::PARALLEL) {
+            updateState(TradeState::LEGS_SENT);
+            for (uint8_t i = 0; i < 3; ++i) dispatch(i, legs_[i]);
+            if (!awaitReports(0b111)) {
+                updateState(TradeState::ERROR);
+                return;
+            }
+        } else {
+            for (uint8_t i = 0; i < 3; ++i) {
+                updateState(static_cast<TradeState>(static_cast<uint8_t>(TradeState::LEG1_SENT) + i));
+                dispatch(i, legs_[i]);
+                if (!awaitReports(1u << i)) {
+                    updateState(TradeState::ERROR);
+                    return;
+                }
+                if (reports_[i].outcome != LegOutcome::FILLED) break;
+            }
+        }
+
+        bool allFilled = true;
+        for (uint8_t i = 0; i < 3; ++i) allFilled = allFilled && reports_[i].outcome == LegOutcome::FILLED;
+        if (allFilled) {
+            updateState(TradeState::COMPLETE);
+            return;
+        }
+        unwind();
+    }
+
+    void store(const LegReport& report) noexcept {
+        if (report.leg >= kReportSlots) return;
+        reports_[report.leg] = report;
+        reported_.fetch_or(1u << report.leg, std::memory_order_release);
+    }
+
+    // Stop accepting reports for the execution just finished, and wait out any report
+    // already being stored, so nothing writes reports_ once execute() has returned.
+    void retireExecution() noexcept {
+        if (execution_.fetch_add(1, std::memory_order_seq_cst) + 1 == 0) execution_.fetch_add(1, std::memory_order_seq_cst);
+        while (reporting_.load(std::memory_order_seq_cst) != 0) TradingSystem::cpuRelax();
+    }
+
+    // Use an std::array for fixed-size, contiguous storage of legs.
+    std::array<TradeLeg, 3> legs_;
+    std::array<TradeLeg, 3> unwindLegs_;
+    std::array<ILegSession*, 3> sessions_{};
+    DispatchMode mode_;
+    double reportTimeoutNs_;
+    TradingSystem::LatencyTracer* tracer_ = nullptr;
+
+    // Written by session threads; a slot is published by setting its bit in reported_.
+    std::array<LegReport, kReportSlots> reports_{};
+    alignas(TradingSystem::kCacheLineSize) std::atomic<uint32_t> reported_{0};
+    std::atomic<uint32_t> execution_{1};     // tags dispatched legs; LegReport's default 0 never matches
+    std::atomic<uint32_t> reporting_{0};     // onLegReport calls in progress
+    std::atomic<uint32_t> outstanding_{0};   // legs submitted to a session and not yet reported
+
+    // Atomic trade state for low-latency, lock-free state transitions.
+    std::atomic<TradeState> state_;
+
+    // Update the state atomically with relaxed ordering where applicable.
+    void updateState(TradeState newState) noexcept {
+        state_.store(newState, std::memory_order_release);
+    }
+
+    // Hand a leg to its session; a session that refuses it counts as an immediate reject.
+    void dispatch(uint8_t slot, const TradeLeg& leg) noexcept {
+        TradingSystem::TraceContext trace = leg.trace;
+        trace.mark(TradingSystem::TraceStage::VenueSend);
+        const uint32_t execution = execution_.load(std::memory_order_relaxed);
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        if (!sessions_[slot % 3]->submit(leg, slot, execution, *this)) {
+            outstanding_.fetch_sub(1, std::memory_order_relaxed);
+            store(LegReport{slot, LegOutcome::REJECTED, 0.0, leg.price, execution});
+        }
+        // Recorded after the hand-off so the histogram update stays off the send path.
+        if (tracer_ != nullptr) tracer_->record(trace);
+    }
+
+    // Spin until every bit in `mask` has reported, or the report timeout expires.
+    // Yields occasionally so a session sharing this core can still make progress.
+    bool awaitReports(uint32_t mask) const noexcept {
+        const uint64_t start = TradingSystem::TscClock::now();
+        for (uint32_t spins = 1; (reported_.load(std::memory_order_acquire) & mask) != mask; ++spins) {
+            if ((spins & 1023) != 0) {
+                TradingSystem::cpuRelax();
+                continue;
+            }
+            if (TradingSystem::TscClock::toNanos(TradingSystem::TscClock::now() - start) > reportTimeoutNs_) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // Offset whatever was filled, all at once, on the legs' own sessions.
+    void unwind() noexcept {
+        updateState(TradeState::UNWINDING);
+        uint32_t pending = 0;
+        for (uint8_t i = 0; i < 3; ++i) {
+            const LegReport& fill = reports_[i];
+            if (fill.filledQuantity <= 0.0) continue;
+            unwindLegs_[i] = TradeLeg(legs_[i].symbol, fill.price, fill.filledQuantity,
+                                      TradingSystem::opposite(legs_[i].side));
+            const auto slot = static_cast<uint8_t>(3 + i);
+            pending |= 1u << slot;
+            dispatch(slot, unwindLegs_[i]);
+        }
+        if (!awaitReports(pending)) {
+            updateState(TradeState::ERROR);
+            return;
+        }
+        for (uint8_t i = 3; i < kReportSlots; ++i) {
+            if ((pending & (1u << i)) && reports_[i].outcome != LegOutcome::FILLED) {
+                updateState(TradeState::ERROR);
+                return;
+            }
+        }
+        updateState(TradeState::UNWOUND);
+    }
+
+    // Original simulated path: legs sent one after another with a fixed 10us latency.
+    void executeSimulated() noexcept {
+        for (uint8_t i = 0; i < 3; ++i) {
+            updateState(static_cast<TradeState>(static_cast<uint8_t>(TradeState::LEG1_SENT) + i));
+            if (!sendLeg(legs_[i])) {
+                updateState(TradeState::ERROR);
+                TradingSystem::defaultLogger().error("Execution error: invalid trade leg parameters");
+                return;
+            }
+        }
+        updateState(TradeState::COMPLETE);
+        TradingSystem::defaultLogger().info("Triangular arbitrage complete.");
+    }
+
+    // Simulated trade execution function. For production, attach venue sessions instead.
+    inline bool sendLeg(const TradeLeg& leg) {
+        // Simulate execution latency of 10 microseconds; use steady_clock for low overhead.
+        auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+
+        if (leg.quantity <= 0.0 || leg.price <= 0.0) {
+            return false;
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::micro> execTime = end - start;
+        if (execTime.count() > 100.0) {
+            // Log a warning if latency exceeds the 100μs target.
+            TradingSystem::defaultLogger().warn("Leg execution latency {}μs exceeds threshold.", execTime.count());
+        }
+
+        // Only the arguments are copied here; the logger thread formats and writes them.
+        TradingSystem::defaultLogger().info("Executed {} on {} at {} for {} (Latency: {}μs)",
+                                            TradingSystem::toString(leg.side),
+                                            TradingSystem::symbolName(leg.symbol), leg.price, leg.quantity,
+                                            execTime.count());
+        return true;
+    }
+};
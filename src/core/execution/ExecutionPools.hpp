@@ -0,0 +1,18 @@
+// ExecutionPools.hpp
+#pragma once
+
+#include "ExecutionState.hpp"
+#include "core/memory/ObjectPool.hpp"
+#include "core/models/Order.hpp"
+#include "core/models/Trade.hpp"
+
+// Per-thread pools for the objects the execution path creates per order. Reserve each
+// thread's working set at startup (e.g. OrderPool::local().reserve(4096)); after that
+// acquiring and releasing orders, fills and reports never reaches malloc.
+using OrderPool = TradingSystem::ObjectPool<TradingSystem::Order>;
+using TradePool = TradingSystem::ObjectPool<Trade>;
+using ReportPool = TradingSystem::ObjectPool<LegReport>;
+
+using OrderHandle = OrderPool::Handle;
+using TradeHandle = TradePool::Handle;
+using ReportHandle = ReportPool::Handle;
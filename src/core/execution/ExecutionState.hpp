@@ -0,0 +1,34 @@
+// ExecutionState.hpp
+#pragma once
+
+#include <cstdint>
+
+// Define the possible states for the triangular arbitrage trade
+enum class TradeState : uint8_t {
+    INIT,
+    LEG1_SENT,   // sequential dispatch: leg N in flight
+    LEG2_SENT,
+    LEG3_SENT,
+    LEGS_SENT,   // parallel dispatch: all three legs in flight
+    UNWINDING,   // a leg was rejected or partly filled; offsetting the filled legs
+    COMPLETE,
+    UNWOUND,     // every filled quantity was offset; flat again
+    ERROR
+};
+
+// Venue outcome for one leg (or one unwind order).
+enum class LegOutcome : uint8_t {
+    PENDING,
+    FILLED,
+    PARTIAL,
+    REJECTED
+};
+
+// Execution report delivered by a venue session.
+struct LegReport {
+    uint8_t leg = 0;            // 0..2 for the triangle legs, 3..5 for their unwind orders
+    LegOutcome outcome = LegOutcome::PENDING;
+    double filledQuantity = 0.0;
+    double price = 0.0;
+    uint32_t execution = 0;     // echoed from submit(); reports for a finished execution are dropped
+};
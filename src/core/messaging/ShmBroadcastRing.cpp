@@ -0,0 +1,155 @@
+// ShmBroadcastRing.cpp
+#include "ShmBroadcastRing.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace hft::core::messaging;
+
+namespace {
+
+constexpr uint64_t kMagic = 0x58414c474f524e47ULL;   // "XALGORNG"
+constexpr uint32_t kLayoutVersion = 1;
+constexpr auto kAttachTimeout = std::chrono::seconds(1);
+
+#if defined(MAP_POPULATE)
+constexpr int kMapFlags = MAP_SHARED | MAP_POPULATE;   // fault the ring in up front, not on the hot path
+#else
+constexpr int kMapFlags = MAP_SHARED;
+#endif
+
+// Wait (bounded) for another process to finish creating the object.
+template <typename Ready>
+bool waitFor(Ready&& ready) {
+    const auto deadline = std::chrono::steady_clock::now() + kAttachTimeout;
+    while (!ready()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<ShmBroadcastRing> ShmBroadcastRing::attach(const std::string& name, const ShmRingOptions& options) {
+    const uint32_t slotCount = std::bit_ceil(std::max<uint32_t>(options.slots, 2));
+    const uint32_t slotSize = (std::max<uint32_t>(options.slotSize, 64) + 63) & ~63u;
+    const std::size_t bytes = sizeof(RingHeader) + std::size_t{slotCount} * slotSize;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    const bool creator = fd >= 0;
+    if (!creator) {
+        if (errno != EEXIST) return nullptr;
+        fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) return nullptr;
+    }
+
+    bool sized = false;
+    if (creator) {
+        sized = ftruncate(fd, static_cast<off_t>(bytes)) == 0;
+    } else {
+        struct stat st {};
+        sized = waitFor([&] { return fstat(fd, &st) == 0 && st.st_size != 0; })
+                && static_cast<std::size_t>(st.st_size) == bytes;
+    }
+    void* base = sized ? mmap(nullptr, bytes, PROT_READ | PROT_WRITE, kMapFlags, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (base == MAP_FAILED) {
+        if (creator) shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    auto* header = static_cast<RingHeader*>(base);
+    if (creator) {
+        // ftruncate zero-filled the object: every slot sequence starts at 0, which no
+        // reader ever expects. Publish the geometry last.
+        new (base) RingHeader{kMagic, kLayoutVersion, slotCount, slotSize, {0}, {0}};
+        header->ready.store(1, std::memory_order_release);
+    } else if (!waitFor([&] { return header->ready.load(std::memory_order_acquire) == 1; })
+               || header->magic != kMagic || header->version != kLayoutVersion
+               || header->slotCount != slotCount || header->slotSize != slotSize) {
+        munmap(base, bytes);
+        return nullptr;
+    }
+    return std::unique_ptr<ShmBroadcastRing>(new ShmBroadcastRing(base, bytes));
+}
+
+void ShmBroadcastRing::unlink(const std::string& name) noexcept {
+    shm_unlink(name.c_str());
+}
+
+ShmBroadcastRing::ShmBroadcastRing(void* base, std::size_t mappedBytes) noexcept
+    : base_(base),
+      mappedBytes_(mappedBytes),
+      header_(static_cast<RingHeader*>(base)),
+      slots_(static_cast<char*>(base) + sizeof(RingHeader)),
+      mask_(header_->slotCount - 1),
+      slotSize_(header_->slotSize) {}
+
+ShmBroadcastRing::~ShmBroadcastRing() {
+    munmap(base_, mappedBytes_);
+}
+
+bool ShmBroadcastRing::publish(std::string_view topic, std::string_view payload) noexcept {
+    if (topic.size() + payload.size() > maxMessageSize()) return false;
+
+    const uint64_t index = header_->writeSeq.load(std::memory_order_relaxed);   // single writer
+    SlotHeader* s = slot(index);
+    s->seq.store(2 * index + 1, std::memory_order_relaxed);
+    // Keep the odd marker ahead of the data stores, so a reader that sees new data
+    // also sees the slot as changed.
+    std::atomic_thread_fence(std::memory_order_release);
+    s->topicLength = static_cast<uint32_t>(topic.size());
+    s->payloadLength = static_cast<uint32_t>(payload.size());
+    char* data = reinterpret_cast<char*>(s + 1);
+    std::memcpy(data, topic.data(), topic.size());
+    std::memcpy(data + topic.size(), payload.data(), payload.size());
+    s->seq.store(2 * index + 2, std::memory_order_release);
+    header_->writeSeq.store(index + 1, std::memory_order_release);
+    return true;
+}
+
+bool ShmBroadcastRing::Reader::tryRead(char* out, uint32_t& topicLength, uint32_t& payloadLength) noexcept {
+    const uint64_t capacity = ring_->mask_ + 1;
+    const std::size_t maxMessage = ring_->maxMessageSize();
+    for (;;) {
+        const uint64_t head = ring_->header_->writeSeq.load(std::memory_order_acquire);
+        if (head < next_) next_ = head;   // writer restarted on a fresh object
+        if (next_ == head) return false;
+        if (head - next_ > capacity) {
+            // Lapped: everything older than one ring behind the writer is gone.
+            dropped_ += head - next_ - capacity;
+            next_ = head - capacity;
+        }
+
+        const SlotHeader* s = ring_->slot(next_);
+        const uint64_t expected = 2 * next_ + 2;
+        if (s->seq.load(std::memory_order_acquire) == expected) {
+            const uint32_t t = s->topicLength;
+            const uint32_t p = s->payloadLength;
+            // Lengths may be torn; bound the copy and let the sequence check reject it.
+            const std::size_t n = std::min<std::size_t>(std::size_t{t} + p, maxMessage);
+            std::memcpy(out, reinterpret_cast<const char*>(s + 1), n);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s->seq.load(std::memory_order_relaxed) == expected && std::size_t{t} + p <= maxMessage) {
+                topicLength = t;
+                payloadLength = p;
+                ++next_;
+                return true;
+            }
+        }
+        // The writer reused the slot before (or while) we read it.
+        ++dropped_;
+        ++next_;
+    }
+}
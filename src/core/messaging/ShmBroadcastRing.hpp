@@ -0,0 +1,128 @@
+// ShmBroadcastRing.hpp
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace hft {
+namespace core {
+namespace messaging {
+
+/**
+ * @brief Geometry of a shared-memory ring. Every process attaching to the same
+ *        ring must agree on it.
+ */
+struct ShmRingOptions {
+    uint32_t slots = 65536;     // rounded up to a power of two
+    uint32_t slotSize = 512;    // bytes per slot, including a 16-byte slot header
+};
+
+/**
+ * @brief Single-writer, many-reader broadcast ring in a POSIX shared-memory object
+ *        (a memory-mapped file under /dev/shm).
+ *
+ * Every slot is a seqlock: the writer marks it odd, copies topic and payload in, then
+ * stores the even sequence 2 * (index + 1) and advances the shared write cursor.
+ * Readers keep a private cursor, copy the slot out and re-check the sequence; a
+ * changed sequence means the writer lapped them and the message is counted as dropped.
+ * Nothing is shared between readers, so adding readers never slows the writer, and
+ * a stalled reader only loses messages (like a ZMQ PUB past its high-water mark).
+ *
+ * publish() must be called from one thread at a time, as with a ZMQ socket.
+ */
+class ShmBroadcastRing {
+public:
+    /**
+     * @brief Create the ring, or attach to an existing one with the same geometry.
+     * @param name shared-memory object name, e.g. "/xalgo_bus"
+     * @return nullptr if the object cannot be created or mapped, or its geometry differs.
+     */
+    static std::unique_ptr<ShmBroadcastRing> attach(const std::string& name, const ShmRingOptions& options = {});
+
+    /**
+     * @brief Remove the shared-memory object; attached mappings stay valid until closed.
+     */
+    static void unlink(const std::string& name) noexcept;
+
+    ~ShmBroadcastRing();
+
+    ShmBroadcastRing(const ShmBroadcastRing&) = delete;
+    ShmBroadcastRing& operator=(const ShmBroadcastRing&) = delete;
+
+    /**
+     * @return false if topic + payload do not fit in one slot.
+     */
+    bool publish(std::string_view topic, std::string_view payload) noexcept;
+
+    /**
+     * @brief Largest topic + payload a slot can carry.
+     */
+    std::size_t maxMessageSize() const noexcept { return slotSize_ - sizeof(SlotHeader); }
+    uint64_t published() const noexcept { return header_->writeSeq.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Private read cursor. Starts at the current write position, so a late
+     *        subscriber sees new messages only, as with ZMQ SUB.
+     */
+    class Reader {
+    public:
+        explicit Reader(const ShmBroadcastRing& ring) noexcept
+            : ring_(&ring), next_(ring.published()) {}
+
+        /**
+         * @brief Copy the next message into `out` (at least maxMessageSize() bytes).
+         * @return false if there is nothing new.
+         */
+        bool tryRead(char* out, uint32_t& topicLength, uint32_t& payloadLength) noexcept;
+
+        /**
+         * @brief Messages overwritten before this reader got to them.
+         */
+        uint64_t dropped() const noexcept { return dropped_; }
+
+    private:
+        const ShmBroadcastRing* ring_;
+        uint64_t next_;
+        uint64_t dropped_ = 0;
+    };
+
+private:
+    struct alignas(64) RingHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t slotCount;
+        uint32_t slotSize;
+        std::atomic<uint32_t> ready;
+        alignas(64) std::atomic<uint64_t> writeSeq;
+    };
+
+    struct SlotHeader {
+        std::atomic<uint64_t> seq;
+        uint32_t topicLength;
+        uint32_t payloadLength;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared-memory atomics must be address-free");
+    static_assert(sizeof(SlotHeader) == 16);
+
+    ShmBroadcastRing(void* base, std::size_t mappedBytes) noexcept;
+
+    SlotHeader* slot(uint64_t index) const noexcept {
+        return reinterpret_cast<SlotHeader*>(slots_ + (index & mask_) * slotSize_);
+    }
+
+    void* base_;
+    std::size_t mappedBytes_;
+    RingHeader* header_;
+    char* slots_;
+    uint64_t mask_;
+    std::size_t slotSize_;
+};
+
+} // namespace messaging
+} // namespace core
+} // namespace hft
@@ -0,0 +1,494 @@
+// WireFormat.hpp
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "core/execution/ExecutionState.hpp"
+#include "core/models/MarketData.hpp"
+#include "core/models/Order.hpp"
+#include "core/models/Signal.hpp"
+
+namespace hft {
+namespace core {
+namespace messaging {
+namespace wire {
+
+/**
+ * @brief Fixed-layout binary schema for bus payloads (SBE-style).
+ *
+ * Every message is an 8-byte header followed by a fixed-size root block at fixed
+ * offsets, then any repeating groups. Fields are little-endian and unaligned, and are
+ * read and written in place with memcpy, so neither side allocates or parses.
+ *
+ * Schema evolution follows SBE: new fields are only ever appended to a root block, and
+ * the header carries the writer's block length. A decoder accepts any version whose
+ * block is at least as long as the one it knows, and skips the rest to reach the groups.
+ * A field appended after a template was first published is read only when the writer's
+ * block reaches it, and is 0 for older writers.
+ *
+ * Encoders and decoders are flyweights: wrap() a buffer, then read or write fields.
+ * The layout comment above each pair is the schema; published offsets never move.
+ */
+
+static_assert(std::endian::native == std::endian::little, "wire format is little-endian; add byte swaps");
+
+constexpr uint16_t kSchemaId = 1;
+constexpr uint16_t kSchemaVersion = 2;   // 2: ExecutionReport.execution
+constexpr std::size_t kSymbolLength = 16;   // NUL-padded, truncated if longer
+
+enum class TemplateId : uint16_t {
+    MARKET_DATA = 1,
+    TICK = 2,
+    ORDER = 3,
+    EXECUTION_REPORT = 4
+};
+
+struct MessageHeader {
+    static constexpr std::size_t kSize = 8;
+
+    uint16_t blockLength = 0;
+    uint16_t templateId = 0;
+    uint16_t schemaId = 0;
+    uint16_t version = 0;
+};
+
+namespace detail {
+
+template <typename T>
+inline T load(const char* p) noexcept {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template <typename T>
+inline void store(char* p, T value) noexcept {
+    std::memcpy(p, &value, sizeof(T));
+}
+
+inline int64_t toNanos(auto timePoint) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+}
+
+template <typename Clock>
+inline typename Clock::time_point fromNanos(int64_t ns) noexcept {
+    return typename Clock::time_point(std::chrono::duration_cast<typename Clock::duration>(std::chrono::nanoseconds(ns)));
+}
+
+} // namespace detail
+
+/**
+ * @brief Read the header of an encoded message without decoding the body.
+ * @return false if `length` cannot hold a header or the schema id does not match.
+ */
+inline bool peekHeader(const char* buffer, std::size_t length, MessageHeader& out) noexcept {
+    if (length < MessageHeader::kSize) return false;
+    out.blockLength = detail::load<uint16_t>(buffer);
+    out.templateId = detail::load<uint16_t>(buffer + 2);
+    out.schemaId = detail::load<uint16_t>(buffer + 4);
+    out.version = detail::load<uint16_t>(buffer + 6);
+    return out.schemaId == kSchemaId;
+}
+
+/**
+ * @brief Common encoder flyweight: header plus a root block of BlockLength bytes.
+ */
+template <TemplateId Id, std::size_t BlockLength>
+class EncoderBase {
+public:
+    static constexpr std::size_t kBlockLength = BlockLength;
+
+    /**
+     * @brief Point the encoder at `buffer` and write the header.
+     * @return false (and leave the encoder unusable) if the root block does not fit.
+     */
+    bool wrap(char* buffer, std::size_t capacity) noexcept {
+        if (capacity < MessageHeader::kSize + BlockLength) {
+            buffer_ = nullptr;
+            return false;
+        }
+        buffer_ = buffer;
+        capacity_ = capacity;
+        length_ = MessageHeader::kSize + BlockLength;
+        detail::store<uint16_t>(buffer, static_cast<uint16_t>(BlockLength));
+        detail::store<uint16_t>(buffer + 2, static_cast<uint16_t>(Id));
+        detail::store<uint16_t>(buffer + 4, kSchemaId);
+        detail::store<uint16_t>(buffer + 6, kSchemaVersion);
+        return true;
+    }
+
+    /**
+     * @brief Bytes written so far (header, root block and any groups).
+     */
+    std::size_t encodedLength() const noexcept { return length_; }
+
+protected:
+    template <typename T>
+    void put(std::size_t offset, T value) noexcept {
+        detail::store<T>(buffer_ + MessageHeader::kSize + offset, value);
+    }
+
+    void putSymbol(std::size_t offset, std::string_view symbol) noexcept {
+        char* out = buffer_ + MessageHeader::kSize + offset;
+        const std::size_t n = std::min(symbol.size(), kSymbolLength);
+        std::memcpy(out, symbol.data(), n);
+        std::memset(out + n, 0, kSymbolLength - n);
+    }
+
+    char* buffer_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t length_ = 0;
+};
+
+/**
+ * @brief Common decoder flyweight; reads fields straight out of the wrapped buffer.
+ */
+template <TemplateId Id, std::size_t BlockLength>
+class DecoderBase {
+public:
+    static constexpr std::size_t kBlockLength = BlockLength;
+
+    /**
+     * @return false if the buffer is truncated, belongs to another schema or template,
+     *         or carries a root block shorter than this decoder's version of it.
+     */
+    bool wrap(const char* buffer, std::size_t length) noexcept {
+        MessageHeader header;
+        if (!peekHeader(buffer, length, header)
+            || header.templateId != static_cast<uint16_t>(Id)
+            || header.blockLength < BlockLength
+            || length < MessageHeader::kSize + header.blockLength) {
+            buffer_ = nullptr;
+            return false;
+        }
+        buffer_ = buffer;
+        length_ = length;
+        actingBlockLength_ = header.blockLength;
+        actingVersion_ = header.version;
+        return true;
+    }
+
+    uint16_t actingVersion() const noexcept { return actingVersion_; }
+
+protected:
+    template <typename T>
+    T get(std::size_t offset) const noexcept {
+        return detail::load<T>(buffer_ + MessageHeader::kSize + offset);
+    }
+
+    std::string_view getSymbol(std::size_t offset) const noexcept {
+        const char* in = buffer_ + MessageHeader::kSize + offset;
+        const void* nul = std::memchr(in, 0, kSymbolLength);
+        return {in, nul ? static_cast<std::size_t>(static_cast<const char*>(nul) - in) : kSymbolLength};
+    }
+
+    // Whether the writer's root block covers [offset, offset + size): false for fields
+    // appended after the writer's version.
+    bool present(std::size_t offset, std::size_t size) const noexcept { return offset + size <= actingBlockLength_; }
+
+    // First byte after the writer's root block, where repeating groups start.
+    std::size_t groupsOffset() const noexcept { return MessageHeader::kSize + actingBlockLength_; }
+
+    const char* buffer_ = nullptr;
+    std::size_t length_ = 0;
+    uint16_t actingBlockLength_ = 0;
+    uint16_t actingVersion_ = 0;
+};
+
+// —— Tick (template 2) ————————————————————————————————————————————————————————
+//   0 eurUsd f64 | 8 gbpUsd f64 | 16 eurGbp f64 | 24 timestampNs i64 (steady clock)
+
+class TickEncoder : public EncoderBase<TemplateId::TICK, 32> {
+public:
+    TickEncoder& eurUsd(double v) noexcept { put(0, v); return *this; }
+    TickEncoder& gbpUsd(double v) noexcept { put(8, v); return *this; }
+    TickEncoder& eurGbp(double v) noexcept { put(16, v); return *this; }
+    TickEncoder& timestampNs(int64_t v) noexcept { put(24, v); return *this; }
+};
+
+class TickDecoder : public DecoderBase<TemplateId::TICK, 32> {
+public:
+    double eurUsd() const noexcept { return get<double>(0); }
+    double gbpUsd() const noexcept { return get<double>(8); }
+    double eurGbp() const noexcept { return get<double>(16); }
+    int64_t timestampNs() const noexcept { return get<int64_t>(24); }
+};
+
+// —— Order (template 3) ———————————————————————————————————————————————————————
+//   0 orderId u64 | 8 symbol char[16] | 24 price f64 | 32 quantity f64
+//   40 timestampNs i64 | 48 side u8 | 49 type u8 | 50..55 reserved
+
+class OrderEncoder : public EncoderBase<TemplateId::ORDER, 56> {
+public:
+    OrderEncoder& orderId(uint64_t v) noexcept { put(0, v); return *this; }
+    OrderEncoder& symbol(std::string_view v) noexcept { putSymbol(8, v); return *this; }
+    OrderEncoder& price(double v) noexcept { put(24, v); return *this; }
+    OrderEncoder& quantity(double v) noexcept { put(32, v); return *this; }
+    OrderEncoder& timestampNs(int64_t v) noexcept { put(40, v); return *this; }
+    OrderEncoder& side(TradingSystem::OrderSide v) noexcept { put(48, static_cast<uint8_t>(v)); return *this; }
+    OrderEncoder& type(TradingSystem::OrderType v) noexcept {
+        put(49, static_cast<uint8_t>(v));
+        put<uint16_t>(50, 0);
+        put<uint32_t>(52, 0);
+        return *this;
+    }
+};
+
+class OrderDecoder : public DecoderBase<TemplateId::ORDER, 56> {
+public:
+    uint64_t orderId() const noexcept { return get<uint64_t>(0); }
+    std::string_view symbol() const noexcept { return getSymbol(8); }
+    double price() const noexcept { return get<double>(24); }
+    double quantity() const noexcept { return get<double>(32); }
+    int64_t timestampNs() const noexcept { return get<int64_t>(40); }
+    TradingSystem::OrderSide side() const noexcept { return static_cast<TradingSystem::OrderSide>(get<uint8_t>(48)); }
+    TradingSystem::OrderType type() const noexcept { return static_cast<TradingSystem::OrderType>(get<uint8_t>(49)); }
+};
+
+// —— Execution report (template 4) ————————————————————————————————————————————
+//   0 orderId u64 | 8 filledQuantity f64 | 16 price f64 | 24 timestampNs i64
+//   32 leg u8 | 33 outcome u8 (LegOutcome) | 34..39 reserved
+//   40 execution u32 (since version 2) | 44..47 reserved
+
+class ExecutionReportEncoder : public EncoderBase<TemplateId::EXECUTION_REPORT, 48> {
+public:
+    ExecutionReportEncoder& orderId(uint64_t v) noexcept { put(0, v); return *this; }
+    ExecutionReportEncoder& filledQuantity(double v) noexcept { put(8, v); return *this; }
+    ExecutionReportEncoder& price(double v) noexcept { put(16, v); return *this; }
+    ExecutionReportEncoder& timestampNs(int64_t v) noexcept { put(24, v); return *this; }
+    ExecutionReportEncoder& leg(uint8_t v) noexcept { put(32, v); return *this; }
+    ExecutionReportEncoder& outcome(LegOutcome v) noexcept {
+        put(33, static_cast<uint8_t>(v));
+        put<uint16_t>(34, 0);
+        put<uint32_t>(36, 0);
+        return *this;
+    }
+    ExecutionReportEncoder& execution(uint32_t v) noexcept {
+        put(40, v);
+        put<uint32_t>(44, 0);
+        return *this;
+    }
+};
+
+class ExecutionReportDecoder : public DecoderBase<TemplateId::EXECUTION_REPORT, 40> {
+public:
+    uint64_t orderId() const noexcept { return get<uint64_t>(0); }
+    double filledQuantity() const noexcept { return get<double>(8); }
+    double price() const noexcept { return get<double>(16); }
+    int64_t timestampNs() const noexcept { return get<int64_t>(24); }
+    uint8_t leg() const noexcept { return get<uint8_t>(32); }
+    LegOutcome outcome() const noexcept { return static_cast<LegOutcome>(get<uint8_t>(33)); }
+    uint32_t execution() const noexcept { return present(40, 4) ? get<uint32_t>(40) : 0; }
+};
+
+// —— Market data (template 1) —————————————————————————————————————————————————
+//   0 symbol char[16] | 16 lastPrice | 24 midPrice | 32 bidPrice | 40 askPrice
+//   48 spread | 56 volume (all f64) | 64 timestampNs i64 (system clock)
+// followed by two repeating groups, bids then asks, each:
+//   group header { entryLength u16, count u16 } + count x { price f64, volume f64 }
+
+constexpr std::size_t kGroupHeaderSize = 4;
+constexpr std::size_t kLevelEntryLength = 16;
+
+class MarketDataEncoder : public EncoderBase<TemplateId::MARKET_DATA, 72> {
+public:
+    MarketDataEncoder& symbol(std::string_view v) noexcept { putSymbol(0, v); return *this; }
+    MarketDataEncoder& lastPrice(double v) noexcept { put(16, v); return *this; }
+    MarketDataEncoder& midPrice(double v) noexcept { put(24, v); return *this; }
+    MarketDataEncoder& bidPrice(double v) noexcept { put(32, v); return *this; }
+    MarketDataEncoder& askPrice(double v) noexcept { put(40, v); return *this; }
+    MarketDataEncoder& spread(double v) noexcept { put(48, v); return *this; }
+    MarketDataEncoder& volume(double v) noexcept { put(56, v); return *this; }
+    MarketDataEncoder& timestampNs(int64_t v) noexcept { put(64, v); return *this; }
+
+    /**
+     * @brief Append the bid and ask groups (call once, after the root fields).
+     * @return false if they do not fit; the message is then incomplete.
+     */
+    bool levels(const XAlgo::Data::PriceLevel* bids, uint16_t bidCount,
+                const XAlgo::Data::PriceLevel* asks, uint16_t askCount) noexcept {
+        const std::size_t needed = 2 * kGroupHeaderSize + (std::size_t{bidCount} + askCount) * kLevelEntryLength;
+        if (length_ + needed > capacity_) return false;
+        appendGroup(bids, bidCount);
+        appendGroup(asks, askCount);
+        return true;
+    }
+
+private:
+    void appendGroup(const XAlgo::Data::PriceLevel* levels, uint16_t count) noexcept {
+        char* out = buffer_ + length_;
+        detail::store<uint16_t>(out, static_cast<uint16_t>(kLevelEntryLength));
+        detail::store<uint16_t>(out + 2, count);
+        out += kGroupHeaderSize;
+        for (uint16_t i = 0; i < count; ++i, out += kLevelEntryLength) {
+            detail::store<double>(out, levels[i].price);
+            detail::store<double>(out + 8, levels[i].volume);
+        }
+        length_ += kGroupHeaderSize + std::size_t{count} * kLevelEntryLength;
+    }
+};
+
+class MarketDataDecoder : public DecoderBase<TemplateId::MARKET_DATA, 72> {
+public:
+    /**
+     * @brief As DecoderBase::wrap(), and also checks that both groups are complete.
+     */
+    bool wrap(const char* buffer, std::size_t length) noexcept {
+        if (!DecoderBase::wrap(buffer, length)) return false;
+        std::size_t offset = groupsOffset();
+        if (!readGroup(offset, bidsOffset_, bidCount_, bidEntryLength_)
+            || !readGroup(offset, asksOffset_, askCount_, askEntryLength_)) {
+            buffer_ = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    std::string_view symbol() const noexcept { return getSymbol(0); }
+    double lastPrice() const noexcept { return get<double>(16); }
+    double midPrice() const noexcept { return get<double>(24); }
+    double bidPrice() const noexcept { return get<double>(32); }
+    double askPrice() const noexcept { return get<double>(40); }
+    double spread() const noexcept { return get<double>(48); }
+    double volume() const noexcept { return get<double>(56); }
+    int64_t timestampNs() const noexcept { return get<int64_t>(64); }
+
+    uint16_t bidCount() const noexcept { return bidCount_; }
+    uint16_t askCount() const noexcept { return askCount_; }
+    XAlgo::Data::PriceLevel bid(std::size_t i) const noexcept { return level(bidsOffset_ + i * bidEntryLength_); }
+    XAlgo::Data::PriceLevel ask(std::size_t i) const noexcept { return level(asksOffset_ + i * askEntryLength_); }
+
+private:
+    bool readGroup(std::size_t& offset, std::size_t& entries, uint16_t& count, uint16_t& entryLength) const noexcept {
+        if (offset + kGroupHeaderSize > length_) return false;
+        entryLength = detail::load<uint16_t>(buffer_ + offset);
+        count = detail::load<uint16_t>(buffer_ + offset + 2);
+        entries = offset + kGroupHeaderSize;
+        offset = entries + std::size_t{count} * entryLength;
+        return entryLength >= kLevelEntryLength && offset <= length_;
+    }
+
+    XAlgo::Data::PriceLevel level(std::size_t offset) const noexcept {
+        return XAlgo::Data::PriceLevel{detail::load<double>(buffer_ + offset), detail::load<double>(buffer_ + offset + 8)};
+    }
+
+    std::size_t bidsOffset_ = 0, asksOffset_ = 0;
+    uint16_t bidCount_ = 0, askCount_ = 0;
+    uint16_t bidEntryLength_ = 0, askEntryLength_ = 0;
+};
+
+// —— Model conversions ————————————————————————————————————————————————————————
+// encode() returns the encoded length, or 0 if the message does not fit `capacity`.
+// decode() returns false if the buffer is not a valid message of that type.
+
+inline std::size_t encode(const TradingSystem::TickData& tick, char* buffer, std::size_t capacity) noexcept {
+    TickEncoder enc;
+    if (!enc.wrap(buffer, capacity)) return 0;
+    enc.eurUsd(tick.eurUsd).gbpUsd(tick.gbpUsd).eurGbp(tick.eurGbp).timestampNs(detail::toNanos(tick.timestamp));
+    return enc.encodedLength();
+}
+
+inline bool decode(const char* buffer, std::size_t length, TradingSystem::TickData& out) noexcept {
+    TickDecoder dec;
+    if (!dec.wrap(buffer, length)) return false;
+    out.eurUsd = dec.eurUsd();
+    out.gbpUsd = dec.gbpUsd();
+    out.eurGbp = dec.eurGbp();
+    out.timestamp = detail::fromNanos<std::chrono::steady_clock>(dec.timestampNs());
+    return true;
+}
+
+inline std::size_t encode(const TradingSystem::Order& order, char* buffer, std::size_t capacity) noexcept {
+    OrderEncoder enc;
+    if (!enc.wrap(buffer, capacity)) return 0;
+    enc.orderId(order.getId())
+        .symbol(order.getSymbol())
+        .price(order.getPrice())
+        .quantity(order.getQuantity())
+        .timestampNs(detail::toNanos(order.getTimestamp()))
+        .side(order.getSide())
+        .type(order.getType());
+    return enc.encodedLength();
+}
+// No decode(Order&): Order is assignable, but its constructor stamps the local clock
+// and it has no setter for the sender's timestamp, so a decoded Order would silently
+// lose it. Read the fields through OrderDecoder (intern symbol() for the SymbolId).
+
+inline std::size_t encode(uint64_t orderId, const LegReport& report, int64_t timestampNs,
+                          char* buffer, std::size_t capacity) noexcept {
+    ExecutionReportEncoder enc;
+    if (!enc.wrap(buffer, capacity)) return 0;
+    enc.orderId(orderId)
+        .filledQuantity(report.filledQuantity)
+        .price(report.price)
+        .timestampNs(timestampNs)
+        .leg(report.leg)
+        .outcome(report.outcome)
+        .execution(report.execution);
+    return enc.encodedLength();
+}
+
+inline bool decode(const char* buffer, std::size_t length, LegReport& out) noexcept {
+    ExecutionReportDecoder dec;
+    if (!dec.wrap(buffer, length)) return false;
+    out.leg = dec.leg();
+    out.outcome = dec.outcome();
+    out.filledQuantity = dec.filledQuantity();
+    out.price = dec.price();
+    // 0 from a version 1 writer: ExecutionManager drops such a report as stale, so
+    // remote sessions must echo the execution number they were given.
+    out.execution = dec.execution();
+    return true;
+}
+
+inline std::size_t encode(const XAlgo::Data::MarketData& md, char* buffer, std::size_t capacity) noexcept {
+    MarketDataEncoder enc;
+    if (!enc.wrap(buffer, capacity)) return 0;
+    // Ids are per process; the wire carries the name.
+    enc.symbol(TradingSystem::symbolName(md.symbol_id))
+        .lastPrice(md.last_price)
+        .midPrice(md.mid_price)
+        .bidPrice(md.bid_price)
+        .askPrice(md.ask_price)
+        .spread(md.spread)
+        .volume(md.volume)
+        .timestampNs(detail::toNanos(md.timestamp));
+    const auto bids = static_cast<uint16_t>(std::min<std::size_t>(md.book.bids.size(), UINT16_MAX));
+    const auto asks = static_cast<uint16_t>(std::min<std::size_t>(md.book.asks.size(), UINT16_MAX));
+    if (!enc.levels(md.book.bids.data(), bids, md.book.asks.data(), asks)) return 0;
+    return enc.encodedLength();
+}
+
+/**
+ * @brief Decode into `out`, reusing its level capacity; allocation-free once `out` has
+ *        seen a message at least as deep. The symbol is resolved against the registry
+ *        (kInvalidSymbol if this process never registered it). live_book is left untouched.
+ */
+inline bool decode(const char* buffer, std::size_t length, XAlgo::Data::MarketData& out) {
+    MarketDataDecoder dec;
+    if (!dec.wrap(buffer, length)) return false;
+    out.symbol_id = TradingSystem::symbolRegistry().find(dec.symbol());
+    out.last_price = dec.lastPrice();
+    out.mid_price = dec.midPrice();
+    out.bid_price = dec.bidPrice();
+    out.ask_price = dec.askPrice();
+    out.spread = dec.spread();
+    out.volume = dec.volume();
+    out.timestamp = detail::fromNanos<std::chrono::system_clock>(dec.timestampNs());
+    out.book.bids.resize(dec.bidCount());
+    for (std::size_t i = 0; i < dec.bidCount(); ++i) out.book.bids[i] = dec.bid(i);
+    out.book.asks.resize(dec.askCount());
+    for (std::size_t i = 0; i < dec.askCount(); ++i) out.book.asks[i] = dec.ask(i);
+    return true;
+}
+
+} // namespace wire
+} // namespace messaging
+} // namespace core
+} // namespace hft
@@ -1,28 +1,67 @@
 // ZMQPubSubHandler.cpp
 #include "messaging/ZMQPubSubHandler.hpp"
-#include <iostream>
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
+#include "utils/Clock.hpp"
+#include <thread>
 
 using namespace hft::core::messaging;
 
+namespace {
+constexpr std::string_view kMessagesReceivedMetric = "zmq.sub.messages_received";
+constexpr std::string_view kMessagesSentMetric = "zmq.pub.messages_sent";
+constexpr std::string_view kShmDroppedMetric = "shm.sub.messages_dropped";
+
+constexpr std::string_view kShmScheme = "shm://";
+
+bool isShmEndpoint(const std::string& endpoint) {
+    return endpoint.compare(0, kShmScheme.size(), kShmScheme) == 0;
+}
+
+// "shm://xalgo_bus" -> "/xalgo_bus"
+std::string shmObjectName(const std::string& endpoint) {
+    return "/" + endpoint.substr(kShmScheme.size());
+}
+}
+
 ZMQPubSubHandler::ZMQPubSubHandler(
     std::shared_ptr<ZeroMQConnectionManager> connectionManager,
-    std::shared_ptr<Logger>                logger,
-    std::shared_ptr<Metrics>               metrics,
+    std::shared_ptr<TradingSystem::Logger>  logger,
+    std::shared_ptr<TradingSystem::Metrics> metrics,
     const std::string&                     pubName,
     const std::string&                     pubEndpoint,
     const std::string&                     subName,
     const std::string&                     subEndpoint,
-    const std::vector<std::string>&        topics
+    const std::vector<std::string>&        topics,
+    const ShmRingOptions&                  shmOptions
 )
     : manager_(std::move(connectionManager))
     , logger_(std::move(logger))
     , metrics_(std::move(metrics))
-    , pubHealth_(manager_->getConnectionHealth(pubName))
-    , subHealth_(manager_->getConnectionHealth(subName))
+    , messagesSent_(metrics_->counter(kMessagesSentMetric))
+    , messagesReceived_(metrics_->counter(kMessagesReceivedMetric))
+    , shmDropped_(metrics_->counter(kShmDroppedMetric))
+    , pubHealth_(isShmEndpoint(pubEndpoint) ? shmPubHealth_ : manager_->getConnectionHealth(pubName))
+    , subHealth_(isShmEndpoint(subEndpoint) ? shmSubHealth_ : manager_->getConnectionHealth(subName))
+    , pubIsShm_(isShmEndpoint(pubEndpoint))
+    , subIsShm_(isShmEndpoint(subEndpoint))
+    , shmTopics_(std::make_unique<const std::vector<std::string>>(topics))
 {
-    // Create the two sockets
-    pubSocket_ = manager_->createPublisher(pubName, pubEndpoint);
-    subSocket_ = manager_->createSubscriber(subName, subEndpoint, topics);
+    // Create the two sockets (or attach the shared-memory rings)
+    if (pubIsShm_) {
+        shmPub_ = ShmBroadcastRing::attach(shmObjectName(pubEndpoint), shmOptions);
+        pubHealth_.isConnected = shmPub_ != nullptr;
+        if (!shmPub_) logger_->error("Cannot attach shared-memory ring for publisher '{}' at {}", pubName, pubEndpoint);
+    } else {
+        pubSocket_ = manager_->createPublisher(pubName, pubEndpoint);
+    }
+    if (subIsShm_) {
+        shmSub_ = ShmBroadcastRing::attach(shmObjectName(subEndpoint), shmOptions);
+        subHealth_.isConnected = shmSub_ != nullptr;
+        if (!shmSub_) logger_->error("Cannot attach shared-memory ring for subscriber '{}' at {}", subName, subEndpoint);
+    } else {
+        subSocket_ = manager_->createSubscriber(subName, subEndpoint, topics);
+    }
 
     // Ensure health monitoring is running
     manager_->startHealthMonitoring();
@@ -37,6 +76,16 @@ ZMQPubSubHandler::~ZMQPubSubHandler() {
 }
 
 bool ZMQPubSubHandler::publish(const std::string& topic, const std::string& message) {
+    if (pubIsShm_) {
+        if (!shmPub_ || !shmPub_->publish(topic, message)) {
+            ++pubHealth_.errorCount;
+            logger_->error("Shared-memory publish failed on topic '{}' ({} bytes)", topic, message.size());
+            return false;
+        }
+        ++pubHealth_.messagesSent;
+        messagesSent_.add();
+        return true;
+    }
     try {
         zmq::message_t t(topic.data(), topic.size());
         zmq::message_t p(message.data(), message.size());
@@ -45,7 +94,7 @@ bool ZMQPubSubHandler::publish(const std::string& topic, const std::string& mess
         pubSocket_->send(p, zmq::send_flags::none);
 
         ++pubHealth_.messagesSent;
-        metrics_->increment("zmq.pub.messages_sent");
+        messagesSent_.add();
         return true;
     } catch (const zmq::error_t& e) {
         ++pubHealth_.errorCount;
@@ -55,7 +104,45 @@ bool ZMQPubSubHandler::publish(const std::string& topic, const std::string& mess
     }
 }
 
+std::size_t ZMQPubSubHandler::publishBatch(const std::vector<OutboundMessage>& messages) {
+    std::size_t sent = 0;
+    if (pubIsShm_) {
+        // Ring slots are overwritten, never full; stop only on an oversized message.
+        while (shmPub_ && sent < messages.size() && shmPub_->publish(messages[sent].topic, messages[sent].payload)) {
+            ++sent;
+        }
+    } else try {
+        for (const OutboundMessage& m : messages) {
+            // Once the first frame of a message is accepted, the rest of it always is.
+            if (!pubSocket_->send(zmq::buffer(m.topic.data(), m.topic.size()),
+                                  zmq::send_flags::sndmore | zmq::send_flags::dontwait)) {
+                break;
+            }
+            pubSocket_->send(zmq::buffer(m.payload.data(), m.payload.size()), zmq::send_flags::dontwait);
+            ++sent;
+        }
+    } catch (const zmq::error_t& e) {
+        ++pubHealth_.errorCount;
+        pubHealth_.lastError = e.what();
+        logger_->error("Batch publish error after {} of {} messages: {}", sent, messages.size(), e.what());
+    }
+
+    if (sent != 0) {
+        pubHealth_.messagesSent += sent;
+        messagesSent_.add(sent);
+    }
+    return sent;
+}
+
 bool ZMQPubSubHandler::subscribe(const std::string& topic) {
+    if (subIsShm_) {
+        std::lock_guard<std::mutex> lk(shmTopicsMutex_);
+        auto topics = std::make_unique<std::vector<std::string>>(*shmTopics_.read());
+        topics->push_back(topic);
+        shmTopics_.publish(std::move(topics));
+        logger_->info("Subscribed to topic '{}'", topic);
+        return true;
+    }
     try {
         subSocket_->setsockopt(ZMQ_SUBSCRIBE, topic.data(), topic.size());
         logger_->info("Subscribed to topic '{}'", topic);
@@ -68,16 +155,29 @@ bool ZMQPubSubHandler::subscribe(const std::string& topic) {
     }
 }
 
+void ZMQPubSubHandler::setZeroCopyHandler(ZeroCopyHandler handler) {
+    dispatcher_.setHandler(std::move(handler));
+}
+
+void ZMQPubSubHandler::setBatchHandler(BatchHandler handler) {
+    dispatcher_.setBatchHandler(std::move(handler));
+}
+
 void ZMQPubSubHandler::setMessageHandler(
     std::function<void(const std::string&, const std::string&)> handler
 ) {
-    std::lock_guard<std::mutex> lk(handlerMutex_);
-    messageHandler_ = std::move(handler);
+    if (!handler) {
+        dispatcher_.setHandler(nullptr);
+        return;
+    }
+    dispatcher_.setHandler([handler = std::move(handler)](ZmqMessage& message) {
+        handler(std::string(message.topic()), std::string(message.payload()));
+    });
 }
 
 void ZMQPubSubHandler::start() {
     if (running_.exchange(true)) return;  // already running
-    listenThread_ = std::thread(&ZMQPubSubHandler::listenLoop, this);
+    listenThread_ = TradingSystem::threadRuntime().start("zmq_listener", [this] { listenLoop(); });
     logger_->info("Listener thread started");
 }
 
@@ -90,29 +190,97 @@ void ZMQPubSubHandler::stop() {
 }
 
 void ZMQPubSubHandler::listenLoop() {
+    if (subIsShm_) {
+        shmListenLoop();
+        return;
+    }
+
+    // Frames are reused across messages: recv() rebuilds them in place, and a handler
+    // that moved them out leaves valid empty frames behind.
+    std::vector<ZmqMessage> batch(kMaxReceiveBatch);
     while (running_) {
+        std::size_t count = 0;
         try {
-            zmq::message_t t, p;
-            // blocking recv
-            if (!subSocket_->recv(t, zmq::recv_flags::none)) continue;
-            subSocket_->recv(p, zmq::recv_flags::none);
-
-            std::string topic(static_cast<char*>(t.data()), t.size());
-            std::string payload(static_cast<char*>(p.data()), p.size());
-
-            ++subHealth_.messagesReceived;
-            metrics_->increment("zmq.sub.messages_received");
-
-            std::lock_guard<std::mutex> lk(handlerMutex_);
-            if (messageHandler_) {
-                messageHandler_(topic, payload);
-            } else {
-                std::cout << "[ZMQSub] " << topic << " -> " << payload << std::endl;
+            // Block for the first message, then drain whatever is already queued.
+            if (!subSocket_->recv(batch[0].topicFrame, zmq::recv_flags::none)) continue;
+            subSocket_->recv(batch[0].payloadFrame, zmq::recv_flags::none);
+            count = 1;
+            while (count < batch.size() && subSocket_->recv(batch[count].topicFrame, zmq::recv_flags::dontwait)) {
+                // Multipart messages are delivered atomically, so the payload is already here.
+                subSocket_->recv(batch[count].payloadFrame, zmq::recv_flags::none);
+                ++count;
             }
         } catch (const zmq::error_t& e) {
             ++subHealth_.errorCount;
             subHealth_.lastError = e.what();
             logger_->error("Error in listenLoop: {}", e.what());
         }
+        if (count == 0) continue;
+
+        // Complete messages received before an error are still delivered.
+        deliver(MessageBatch(batch.data(), count));
+    }
+}
+
+void ZMQPubSubHandler::shmListenLoop() {
+    if (!shmSub_) return;
+    ShmBroadcastRing::Reader reader(*shmSub_);
+    const std::size_t maxMessage = shmSub_->maxMessageSize();
+    std::vector<ZmqMessage> batch(kMaxReceiveBatch);
+    for (ZmqMessage& m : batch) {
+        m.local.resize(maxMessage);
+        m.isLocal = true;
+    }
+
+    uint64_t reportedDrops = 0;
+    TradingSystem::IdleStrategy idle = TradingSystem::IdleStrategy::forCurrentThread();
+    while (running_) {
+        std::size_t count = 0;
+        {
+            const auto topics = shmTopics_.read();
+            while (count < batch.size()) {
+                ZmqMessage& m = batch[count];
+                // Only a handler that moved a message out leaves it without storage.
+                if (m.local.size() < maxMessage) {
+                    m.local.resize(maxMessage);
+                    m.isLocal = true;
+                }
+                if (!reader.tryRead(m.local.data(), m.localTopicLength, m.localPayloadLength)) break;
+                const std::string_view topic = m.topic();
+                for (const std::string& prefix : *topics) {
+                    if (topic.compare(0, prefix.size(), prefix) == 0) {
+                        ++count;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (reader.dropped() != reportedDrops) {
+            shmDropped_.add(reader.dropped() - reportedDrops);
+            subHealth_.errorCount += reader.dropped() - reportedDrops;
+            reportedDrops = reader.dropped();
+        }
+        if (count == 0) {
+            // Nothing to block on across processes: poll per the thread's idle policy
+            // (busy-poll on an isolated core, or spin and then give the core away).
+            idle.idle();
+            continue;
+        }
+        idle.reset();
+        deliver(MessageBatch(batch.data(), count));
+    }
+}
+
+void ZMQPubSubHandler::deliver(const MessageBatch& messages) {
+    const uint64_t receivedTsc = TradingSystem::TscClock::now();
+    for (ZmqMessage& message : messages) message.receivedTsc = receivedTsc;
+    subHealth_.messagesReceived += messages.size();
+    messagesReceived_.add(messages.size());
+
+    if (!dispatcher_.dispatch(messages)) {
+        for (const ZmqMessage& message : messages) {
+            logger_->info("[ZMQSub] {} -> {}", message.topic(), message.payload());
+        }
     }
 }
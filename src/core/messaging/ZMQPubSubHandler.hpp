@@ -10,9 +10,11 @@
 #include <memory>
 #include <zmq.hpp>
 
+#include "core/messaging/ShmBroadcastRing.hpp"
 #include "core/messaging/ZeroMQConnectionManager.hpp"
-#include "core/Logger.hpp"
-#include "core/Metrics.hpp"
+#include "core/messaging/ZmqMessage.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Metrics.hpp"
 
 namespace hft {
 namespace core {
@@ -20,6 +22,11 @@ namespace messaging {
 
 /**
  * @brief Simple pub/sub handler on top of ZeroMQConnectionManager
+ *
+ * An endpoint of the form "shm://<name>" selects the shared-memory transport for that
+ * side instead of a ZMQ socket: a ShmBroadcastRing in /dev/shm/<name>, for processes
+ * on the same host. Publish, subscribe and the handlers behave the same; topic
+ * filtering is by prefix, as with ZMQ SUB.
  */
 class ZMQPubSubHandler {
 public:
@@ -33,20 +40,22 @@ public:
      * @param logger            shared logger
      * @param metrics           shared metrics collector
      * @param pubName           identifier for this publisher
-     * @param pubEndpoint       ZMQ endpoint to bind/connect publisher
+     * @param pubEndpoint       ZMQ endpoint to bind/connect publisher, or shm://<name>
      * @param subName           identifier for this subscriber
-     * @param subEndpoint       ZMQ endpoint to bind/connect subscriber
+     * @param subEndpoint       ZMQ endpoint to bind/connect subscriber, or shm://<name>
      * @param topics            list of topics to SUBSCRIBE to
+     * @param shmOptions        ring geometry for shm:// endpoints (must match the peer's)
      */
     ZMQPubSubHandler(
         std::shared_ptr<ZeroMQConnectionManager> connectionManager,
-        std::shared_ptr<Logger>                logger,
-        std::shared_ptr<Metrics>               metrics,
+        std::shared_ptr<TradingSystem::Logger>  logger,
+        std::shared_ptr<TradingSystem::Metrics> metrics,
         const std::string&                     pubName,
         const std::string&                     pubEndpoint,
         const std::string&                     subName,
         const std::string&                     subEndpoint,
-        const std::vector<std::string>&        topics
+        const std::vector<std::string>&        topics,
+        const ShmRingOptions&                  shmOptions = {}
     );
 
     ~ZMQPubSubHandler();
@@ -57,14 +66,45 @@ public:
      */
     bool publish(const std::string& topic, const std::string& message);
 
+    /**
+     * @brief Publish several messages in one call without blocking.
+     *
+     * Frames are queued with ZMQ_DONTWAIT and flushed by the I/O thread together;
+     * metrics are updated once for the whole batch. Stops at the first message the
+     * socket will not take (high-water mark).
+     * @return number of messages queued, from the front of `messages`.
+     */
+    std::size_t publishBatch(const std::vector<OutboundMessage>& messages);
+
     /**
      * @brief Dynamically subscribe to an additional topic.
      * @return true on success, false on ZMQ error.
      */
     bool subscribe(const std::string& topic);
 
+    /**
+     * @brief Install a zero-copy handler for inbound messages.
+     *
+     * The handler sees views over the received frames; nothing is copied or
+     * allocated per message. Move the frames out of the message to keep them past
+     * the call. Safe to call while the receive loop is running, but not from
+     * inside a handler.
+     */
+    void setZeroCopyHandler(ZeroCopyHandler handler);
+
+    /**
+     * @brief Install a handler that receives everything already queued on the socket
+     *        (up to kMaxReceiveBatch messages) in one call.
+     *
+     * Replaces any per-message handler. Same lifetime rules as setZeroCopyHandler().
+     */
+    void setBatchHandler(BatchHandler handler);
+
     /**
      * @brief Install your own in‐process handler for inbound messages.
+     *
+     * Convenience wrapper over setZeroCopyHandler() that copies topic and payload
+     * into strings for every message; prefer the zero-copy handler on hot paths.
      */
     void setMessageHandler(std::function<void(const std::string& topic,
                                               const std::string& payload)> handler);
@@ -79,23 +119,39 @@ public:
      */
     void stop();
 
+    static constexpr std::size_t kMaxReceiveBatch = 256;
+
 private:
     void listenLoop();
+    void shmListenLoop();
+    void deliver(const MessageBatch& messages);
 
     std::shared_ptr<ZeroMQConnectionManager> manager_;
-    std::shared_ptr<Logger>                 logger_;
-    std::shared_ptr<Metrics>                metrics_;
-
+    std::shared_ptr<TradingSystem::Logger>  logger_;
+    std::shared_ptr<TradingSystem::Metrics> metrics_;
+    TradingSystem::Counter                  messagesSent_;      // handles resolved once, in the constructor
+    TradingSystem::Counter                  messagesReceived_;
+    TradingSystem::Counter                  shmDropped_;
+
+    // Health for shm:// sides, which the connection manager does not track.
+    ConnectionHealth                        shmPubHealth_;
+    ConnectionHealth                        shmSubHealth_;
     ConnectionHealth&                       pubHealth_;
     ConnectionHealth&                       subHealth_;
 
     std::shared_ptr<zmq::socket_t>          pubSocket_;
     std::shared_ptr<zmq::socket_t>          subSocket_;
 
+    bool                                    pubIsShm_;
+    bool                                    subIsShm_;
+    std::unique_ptr<ShmBroadcastRing>       shmPub_;
+    std::unique_ptr<ShmBroadcastRing>       shmSub_;
+    TradingSystem::RcuSnapshot<std::vector<std::string>> shmTopics_;  // prefix filter
+    std::mutex                              shmTopicsMutex_;           // serialises subscribe()
+
     std::atomic<bool>                       running_{false};
     std::thread                             listenThread_;
-    std::mutex                              handlerMutex_;
-    std::function<void(const std::string&, const std::string&)> messageHandler_;
+    MessageDispatcher                       dispatcher_;
 };
 
 } // namespace messaging
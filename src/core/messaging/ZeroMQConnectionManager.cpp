@@ -1,40 +1,54 @@
 // ZeroMQConnectionManager.cpp
 #include "ZeroMQConnectionManager.hpp"
-#include <iostream>
+#include "core/concurrency/ThreadRuntime.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 using namespace hft::core::messaging;
 
+namespace {
+// Upper bound on one poll, so shutdown and new sockets are noticed promptly.
+constexpr int kMaxPollMs = 100;
+
+uint64_t steadyNowMs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+}
+
 //—— Primary constructor —————————————————————————————————————————————————————————————————
 ZeroMQConnectionManager::ZeroMQConnectionManager(
     zmq::context_t& context,
-    const ConfigLoader& config,
-    std::shared_ptr<Logger> logger,
-    std::shared_ptr<Metrics> metrics
+    const TradingSystem::ConfigLoader& config,
+    std::shared_ptr<TradingSystem::Logger> logger,
+    std::shared_ptr<TradingSystem::Metrics> metrics
 )
     : zmqContextPtr_(&context)
     , ownedContext_(nullptr)
-    , configLoader_(config)
+    , config_(config.snapshot()->messaging)
     , logger_(std::move(logger))
     , metrics_(std::move(metrics))
-    , reconnectIntervalMs_(configLoader_.getInt("reconnectIntervalMs", 1000))
-    , heartbeatIntervalMs_(configLoader_.getInt("heartbeatIntervalMs", 5000))
-    , monitoringIntervalMs_(configLoader_.getInt("monitoringIntervalMs", 1000))
+    , reconnectIntervalMs_(config_.reconnectIntervalMs)
+    , heartbeatIntervalMs_(config_.heartbeatIntervalMs)
+    , monitoringIntervalMs_(config_.monitoringIntervalMs)
 {
     logger_->info("ZeroMQConnectionManager initialized");
 }
 
 //—— Convenience ctor: load from a JSON/YAML file path ——————————————————————————————————————
 ZeroMQConnectionManager::ZeroMQConnectionManager(const std::string& configFile)
-    : ownedContext_(std::make_unique<zmq::context_t>(1))  // One I/O thread
-    , zmqContextPtr_(ownedContext_.get())
-    , configLoader_(configFile)
-    , logger_(nullptr)
+    : zmqContextPtr_(nullptr)
+    , ownedContext_(std::make_unique<zmq::context_t>(1))  // One I/O thread
+    , config_(TradingSystem::ConfigLoader(configFile).snapshot()->messaging)
+    , logger_(std::shared_ptr<TradingSystem::Logger>(), &TradingSystem::defaultLogger())   // not owned
     , metrics_(nullptr)
-    , reconnectIntervalMs_(configLoader_.getInt("reconnectIntervalMs", 1000))
-    , heartbeatIntervalMs_(configLoader_.getInt("heartbeatIntervalMs", 5000))
-    , monitoringIntervalMs_(configLoader_.getInt("monitoringIntervalMs", 1000))
+    , reconnectIntervalMs_(config_.reconnectIntervalMs)
+    , heartbeatIntervalMs_(config_.heartbeatIntervalMs)
+    , monitoringIntervalMs_(config_.monitoringIntervalMs)
 {
-    std::cout << "ZeroMQConnectionManager initialized with config file: " << configFile << std::endl;
+    zmqContextPtr_ = ownedContext_.get();  // declared before ownedContext_, so set here
+    logger_->info("ZeroMQConnectionManager initialized with config file: {}", configFile);
 }
 
 ZeroMQConnectionManager::~ZeroMQConnectionManager() {
@@ -51,6 +65,12 @@ zmq::context_t& ZeroMQConnectionManager::getContext() {
 //—— Low‑level socket factory ———————————————————————————————————————————————————————
 std::unique_ptr<zmq::socket_t> ZeroMQConnectionManager::createSocket(int type, const std::string& endpoint, bool bind) {
     auto sock = std::make_unique<zmq::socket_t>(*zmqContextPtr_, type);
+    // Exponential backoff from reconnectIntervalMs_, run by libzmq's I/O thread.
+    const int reconnectIvl = reconnectIntervalMs_;
+    const int reconnectIvlMax = reconnectIntervalMs_ * kMaxBackoffFactor;
+    sock->setsockopt(ZMQ_RECONNECT_IVL, &reconnectIvl, sizeof(reconnectIvl));
+    sock->setsockopt(ZMQ_RECONNECT_IVL_MAX, &reconnectIvlMax, sizeof(reconnectIvlMax));
+    sock->setsockopt(ZMQ_LINGER, &config_.lingerMs, sizeof(config_.lingerMs));
     if (bind)   sock->bind(endpoint);
     else        sock->connect(endpoint);
     return sock;
@@ -67,7 +87,7 @@ std::shared_ptr<zmq::socket_t> ZeroMQConnectionManager::createPublisher(
     {
         std::lock_guard<std::mutex> lk(socketMutex_);
         sockets_[name] = sp;
-        healthStatus_[name] = ConnectionHealth{};
+        healthStatus_.try_emplace(name);
     }
     setupSocketMonitoring(sp, name);
     return sp;
@@ -87,16 +107,16 @@ std::shared_ptr<zmq::socket_t> ZeroMQConnectionManager::createSubscriber(
     {
         std::lock_guard<std::mutex> lk(socketMutex_);
         sockets_[name] = sp;
-        healthStatus_[name] = ConnectionHealth{};
+        healthStatus_.try_emplace(name);
     }
     setupSocketMonitoring(sp, name);
     return sp;
 }
 
-//—— Stubbed health‑monitoring entrypoint —————————————————————————————————————————————
+//—— Health monitoring ————————————————————————————————————————————————————————————————
 void ZeroMQConnectionManager::startHealthMonitoring() {
     if (monitorRunning_.exchange(true)) return;  // already running
-    monitorThread_ = std::thread(&ZeroMQConnectionManager::monitorThreadFunction, this);
+    monitorThread_ = TradingSystem::threadRuntime().start("zmq_monitor", [this] { monitorThreadFunction(); });
 }
 
 const ConnectionHealth& ZeroMQConnectionManager::getConnectionHealth(const std::string& name) const {
@@ -104,6 +124,12 @@ const ConnectionHealth& ZeroMQConnectionManager::getConnectionHealth(const std::
     return healthStatus_.at(name);
 }
 
+ConnectionHealth& ZeroMQConnectionManager::getConnectionHealth(const std::string& name) {
+    std::lock_guard<std::mutex> lk(socketMutex_);
+    // unordered_map nodes never move, so the reference survives later insertions.
+    return healthStatus_.try_emplace(name).first->second;
+}
+
 std::vector<std::string> ZeroMQConnectionManager::getConnectionNames() const {
     std::lock_guard<std::mutex> lk(socketMutex_);
     std::vector<std::string> names;
@@ -111,19 +137,169 @@ std::vector<std::string> ZeroMQConnectionManager::getConnectionNames() const {
     return names;
 }
 
-//—— Remaining private methods need your health‑check + metrics logic ———————————————————————
-void ZeroMQConnectionManager::setupSocketMonitoring(const std::shared_ptr<zmq::socket_t>&, const std::string&) {
-    // TODO
+//—— Monitor thread ———————————————————————————————————————————————————————————————————
+void ZeroMQConnectionManager::setupSocketMonitoring(const std::shared_ptr<zmq::socket_t>& socket, const std::string& name) {
+    static std::atomic<uint64_t> monitorId{0};
+    const std::string endpoint = "inproc://zmq-monitor-" + std::to_string(monitorId.fetch_add(1)) + "-" + name;
+    if (zmq_socket_monitor(socket->handle(), endpoint.c_str(), ZMQ_EVENT_ALL) != 0) {
+        if (logger_) logger_->error("Cannot monitor socket '{}': {}", name, zmq_strerror(zmq_errno()));
+        return;
+    }
+    auto monitor = std::make_shared<zmq::socket_t>(*zmqContextPtr_, ZMQ_PAIR);
+    const int linger = 0;
+    monitor->setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+    monitor->connect(endpoint);
+
+    std::lock_guard<std::mutex> lk(socketMutex_);
+    monitorSockets_[name] = std::move(monitor);
+    monitorGeneration_.fetch_add(1, std::memory_order_release);
+}
+
+void ZeroMQConnectionManager::refreshMonitoredSockets() {
+    std::lock_guard<std::mutex> lk(socketMutex_);
+    for (auto& [name, monitor] : monitorSockets_) {
+        auto it = std::find_if(monitored_.begin(), monitored_.end(),
+                               [&](const MonitoredSocket& m) { return m.name == name; });
+        if (it != monitored_.end()) {
+            it->monitor = monitor;   // a socket re-created under the same name
+            continue;
+        }
+        MonitoredSocket entry;
+        entry.name = name;
+        entry.monitor = monitor;
+        entry.health = &healthStatus_.at(name);
+        if (metrics_) {
+            entry.connected = metrics_->gaugeHandle("zmq." + name + ".connected");
+            entry.reconnects = metrics_->gaugeHandle("zmq." + name + ".reconnects");
+            entry.errors = metrics_->gaugeHandle("zmq." + name + ".errors");
+        }
+        monitored_.push_back(std::move(entry));
+    }
 }
+
 void ZeroMQConnectionManager::monitorThreadFunction() {
-    // TODO
+    uint64_t seenGeneration = ~uint64_t{0};
+    uint64_t nextUpdateMs = 0;
+    std::vector<zmq_pollitem_t> items;
+
+    while (monitorRunning_.load(std::memory_order_acquire)) {
+        const uint64_t generation = monitorGeneration_.load(std::memory_order_acquire);
+        if (generation != seenGeneration) {
+            refreshMonitoredSockets();
+            seenGeneration = generation;
+            items.clear();
+            for (const MonitoredSocket& m : monitored_) {
+                items.push_back(zmq_pollitem_t{m.monitor->handle(), 0, ZMQ_POLLIN, 0});
+            }
+        }
+
+        // Events wake the poll at once, so a disconnect is seen as soon as libzmq reports it.
+        const int timeoutMs = std::min(monitoringIntervalMs_, kMaxPollMs);
+        const int ready = zmq_poll(items.data(), static_cast<int>(items.size()), timeoutMs);
+        if (ready < 0 && zmq_errno() == ETERM) break;
+        for (std::size_t i = 0; ready > 0 && i < items.size(); ++i) {
+            if (items[i].revents & ZMQ_POLLIN) processMonitorEvents(monitored_[i]);
+        }
+
+        const uint64_t now = steadyNowMs();
+        if (now >= nextUpdateMs) {
+            updateMetrics();
+            reconnectDisconnectedSockets();
+            nextUpdateMs = now + static_cast<uint64_t>(monitoringIntervalMs_);
+        }
+    }
 }
-void ZeroMQConnectionManager::processMonitorEvents(zmq::socket_t&, const std::string&) {
-    // TODO
+
+void ZeroMQConnectionManager::processMonitorEvents(MonitoredSocket& entry) {
+    ConnectionHealth& health = *entry.health;
+    for (;;) {
+        // Each event is two frames: 16-bit event id + 32-bit value, then the peer endpoint.
+        zmq_msg_t eventFrame;
+        zmq_msg_init(&eventFrame);
+        if (zmq_msg_recv(&eventFrame, entry.monitor->handle(), ZMQ_DONTWAIT) < 0) {
+            zmq_msg_close(&eventFrame);
+            return;
+        }
+        uint16_t event = 0;
+        uint32_t value = 0;
+        if (zmq_msg_size(&eventFrame) >= sizeof(event) + sizeof(value)) {
+            const auto* data = static_cast<const char*>(zmq_msg_data(&eventFrame));
+            std::memcpy(&event, data, sizeof(event));
+            std::memcpy(&value, data + sizeof(event), sizeof(value));
+        }
+        zmq_msg_close(&eventFrame);
+
+        zmq_msg_t addressFrame;
+        zmq_msg_init(&addressFrame);
+        if (zmq_msg_recv(&addressFrame, entry.monitor->handle(), 0) < 0) {
+            zmq_msg_close(&addressFrame);
+            return;
+        }
+        const std::string address(static_cast<const char*>(zmq_msg_data(&addressFrame)), zmq_msg_size(&addressFrame));
+        zmq_msg_close(&addressFrame);
+
+        switch (event) {
+        case ZMQ_EVENT_CONNECTED:
+        case ZMQ_EVENT_ACCEPTED:
+            if (entry.disconnectedAtMs != 0 && logger_) {
+                logger_->info("Connection '{}' restored to {} after {} ms", entry.name, address,
+                              steadyNowMs() - entry.disconnectedAtMs);
+            }
+            health.isConnected.store(true, std::memory_order_relaxed);
+            health.lastHeartbeatTime.store(steadyNowMs(), std::memory_order_relaxed);
+            entry.disconnectedAtMs = 0;
+            entry.escalated = false;
+            break;
+        case ZMQ_EVENT_DISCONNECTED:
+        case ZMQ_EVENT_CLOSED:
+            if (entry.disconnectedAtMs == 0) entry.disconnectedAtMs = steadyNowMs();
+            health.isConnected.store(false, std::memory_order_relaxed);
+            if (logger_) logger_->warn("Connection '{}' lost {}", entry.name, address);
+            break;
+        case ZMQ_EVENT_CONNECT_RETRIED:
+            // value is the interval libzmq will wait before the next attempt.
+            health.reconnectCount.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case ZMQ_EVENT_BIND_FAILED:
+        case ZMQ_EVENT_ACCEPT_FAILED:
+        case ZMQ_EVENT_CLOSE_FAILED:
+        case ZMQ_EVENT_HANDSHAKE_FAILED_NO_DETAIL:
+        case ZMQ_EVENT_HANDSHAKE_FAILED_PROTOCOL:
+        case ZMQ_EVENT_HANDSHAKE_FAILED_AUTH:
+            health.errorCount.fetch_add(1, std::memory_order_relaxed);
+            if (logger_) logger_->error("Connection '{}' event {} on {}: {}", entry.name, event, address, zmq_strerror(static_cast<int>(value)));
+            break;
+        default:
+            break;
+        }
+    }
 }
+
 void ZeroMQConnectionManager::updateMetrics() {
-    // TODO
+    const uint64_t now = steadyNowMs();
+    for (const MonitoredSocket& m : monitored_) {
+        const bool connected = m.health->isConnected.load(std::memory_order_relaxed);
+        if (connected) m.health->lastHeartbeatTime.store(now, std::memory_order_relaxed);
+        // Unset handles (no metrics) ignore the writes.
+        m.connected.set(connected ? 1.0 : 0.0);
+        m.reconnects.set(static_cast<double>(m.health->reconnectCount.load(std::memory_order_relaxed)));
+        m.errors.set(static_cast<double>(m.health->errorCount.load(std::memory_order_relaxed)));
+    }
 }
+
 void ZeroMQConnectionManager::reconnectDisconnectedSockets() {
-    // TODO
+    // libzmq retries on its own, backing off from reconnectIntervalMs_ up to
+    // kMaxBackoffFactor times that. Past the full backoff the peer is likely gone for good:
+    // say so once rather than touching a socket another thread is using.
+    const uint64_t now = steadyNowMs();
+    const uint64_t giveUpMs = static_cast<uint64_t>(reconnectIntervalMs_) * kMaxBackoffFactor;
+    for (MonitoredSocket& m : monitored_) {
+        if (m.disconnectedAtMs == 0 || m.escalated || now - m.disconnectedAtMs < giveUpMs) continue;
+        m.escalated = true;
+        m.health->errorCount.fetch_add(1, std::memory_order_relaxed);
+        if (logger_) {
+            logger_->error("Connection '{}' still down after {} ms and {} reconnect attempts", m.name,
+                           now - m.disconnectedAtMs, m.health->reconnectCount.load(std::memory_order_relaxed));
+        }
+    }
 }
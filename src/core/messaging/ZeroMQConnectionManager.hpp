@@ -10,9 +10,9 @@
 #include <thread>
 #include <zmq.hpp>
 
-#include "core/Logger.hpp"
-#include "core/Metrics.hpp"
-#include "core/ConfigLoader.hpp"
+#include "utils/ConfigLoader.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Metrics.hpp"
 
 namespace hft {
 namespace core {
@@ -20,6 +20,10 @@ namespace messaging {
 
 /**
  * @brief Connection health status information
+ *
+ * The counters are bumped by whoever owns the socket; isConnected, reconnectCount and
+ * lastHeartbeatTime (steady-clock ms of the last monitoring pass that saw the
+ * connection up) are kept by the manager's monitor thread.
  */
 struct ConnectionHealth {
     std::atomic<bool> isConnected{false};
@@ -34,6 +38,11 @@ struct ConnectionHealth {
 /**
  * @brief ZeroMQConnectionManager handles connections, reconnects and health monitoring
  * for all ZMQ sockets in the system.
+ *
+ * Every socket it creates gets a zmq_socket_monitor PAIR socket, drained by a single
+ * monitor thread that only ever touches ConnectionHealth atomics. Reconnects are left to
+ * libzmq's I/O thread, with its backoff configured from reconnectIntervalMs: a ZMQ
+ * socket must not be used from two threads, and the send/recv paths never lock.
  */
 class ZeroMQConnectionManager {
 public:
@@ -41,15 +50,15 @@ public:
      * @brief Primary constructor
      * 
      * @param context ZMQ context to use
-     * @param config Configuration object containing connection settings
+     * @param config Configuration; the messaging section is read once, here
      * @param logger Logger instance
      * @param metrics Metrics collection instance
      */
     ZeroMQConnectionManager(
         zmq::context_t& context,
-        const ConfigLoader& config,
-        std::shared_ptr<Logger> logger,
-        std::shared_ptr<Metrics> metrics
+        const TradingSystem::ConfigLoader& config,
+        std::shared_ptr<TradingSystem::Logger> logger,
+        std::shared_ptr<TradingSystem::Metrics> metrics
     );
 
     /**
@@ -93,32 +102,57 @@ public:
      */
     const ConnectionHealth& getConnectionHealth(const std::string& name) const;
 
+    /**
+     * @brief Mutable health for the socket's owner to count traffic into. Creates the
+     *        entry if the connection does not exist yet, so owners can bind to it before
+     *        creating the socket. The reference stays valid for the manager's lifetime.
+     */
+    ConnectionHealth& getConnectionHealth(const std::string& name);
+
     /**
      * @brief Gets the list of all managed connections
      */
     std::vector<std::string> getConnectionNames() const;
 
 private:
+    // Monitor-thread view of one monitored socket.
+    struct MonitoredSocket {
+        std::string                    name;
+        std::shared_ptr<zmq::socket_t> monitor;
+        ConnectionHealth*              health;
+        uint64_t                       disconnectedAtMs = 0;   // 0 while connected
+        bool                           escalated = false;
+        TradingSystem::Gauge           connected;              // registered once, not per update
+        TradingSystem::Gauge           reconnects;
+        TradingSystem::Gauge           errors;
+    };
+
+    // libzmq doubles the reconnect interval per failed attempt up to this factor.
+    static constexpr int kMaxBackoffFactor = 32;
+
     // either points at external context _or_ ownedContext_.get()
     zmq::context_t* zmqContextPtr_;               
     std::unique_ptr<zmq::context_t> ownedContext_; 
-    ConfigLoader                configLoader_;
+    const TradingSystem::MessagingConfig config_;
     std::unordered_map<std::string, std::shared_ptr<zmq::socket_t>> sockets_;
     std::unordered_map<std::string, ConnectionHealth>               healthStatus_;
     std::unordered_map<std::string, std::shared_ptr<zmq::socket_t>> monitorSockets_;
-    mutable std::mutex           socketMutex_;
+    mutable std::mutex           socketMutex_;          // registration only, never send/recv
+    std::atomic<uint64_t>        monitorGeneration_{0}; // bumped when monitorSockets_ changes
     std::atomic<bool>            monitorRunning_{false};
     std::thread                  monitorThread_;
+    std::vector<MonitoredSocket> monitored_;            // monitor thread only
 
-    std::shared_ptr<Logger>      logger_;
-    std::shared_ptr<Metrics>     metrics_;
+    std::shared_ptr<TradingSystem::Logger> logger_;
+    std::shared_ptr<TradingSystem::Metrics> metrics_;
     int                          reconnectIntervalMs_;
     int                          heartbeatIntervalMs_;
     int                          monitoringIntervalMs_;
 
     void setupSocketMonitoring(const std::shared_ptr<zmq::socket_t>& socket, const std::string& name);
     void monitorThreadFunction();
-    void processMonitorEvents(zmq::socket_t& monitorSocket, const std::string& name);
+    void refreshMonitoredSockets();
+    void processMonitorEvents(MonitoredSocket& entry);
     void updateMetrics();
     void reconnectDisconnectedSockets();
 };
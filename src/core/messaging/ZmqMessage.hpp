@@ -0,0 +1,137 @@
+// ZmqMessage.hpp
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <zmq.hpp>
+
+#include "core/concurrency/RcuSnapshot.hpp"
+#include "utils/TraceContext.hpp"
+
+namespace hft {
+namespace core {
+namespace messaging {
+
+/**
+ * @brief Topic and payload of one received message.
+ *
+ * Over ZeroMQ the views point straight into the received frames; over the shared-memory
+ * transport they point into `local`, which the message was copied into out of the
+ * ring. Either way they stay valid as long as the message does. A handler that needs
+ * the message after it returns takes ownership by moving the whole ZmqMessage out; the
+ * receive loop then reads into fresh storage.
+ *
+ * `receivedTsc` is stamped once per received batch, before any handler runs; trace()
+ * starts the message's tick-to-trade trace from it.
+ */
+struct ZmqMessage {
+    zmq::message_t topicFrame;
+    zmq::message_t payloadFrame;
+
+    std::vector<char> local;
+    uint32_t localTopicLength = 0;
+    uint32_t localPayloadLength = 0;
+    bool isLocal = false;
+    uint64_t receivedTsc = 0;
+
+    TradingSystem::TraceContext trace() const noexcept { return TradingSystem::TraceContext::begin(receivedTsc); }
+
+    std::string_view topic() const noexcept {
+        if (isLocal) return {local.data(), localTopicLength};
+        return {static_cast<const char*>(topicFrame.data()), topicFrame.size()};
+    }
+    std::string_view payload() const noexcept {
+        if (isLocal) return {local.data() + localTopicLength, localPayloadLength};
+        return {static_cast<const char*>(payloadFrame.data()), payloadFrame.size()};
+    }
+};
+
+/**
+ * @brief Contiguous run of received messages, valid for the duration of one handler call.
+ */
+class MessageBatch {
+public:
+    MessageBatch(ZmqMessage* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    ZmqMessage* begin() const noexcept { return data_; }
+    ZmqMessage* end() const noexcept { return data_ + size_; }
+    std::size_t size() const noexcept { return size_; }
+    ZmqMessage& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+private:
+    ZmqMessage* data_;
+    std::size_t size_;
+};
+
+/**
+ * @brief One topic + payload pair to publish; the views only need to outlive the call.
+ */
+struct OutboundMessage {
+    std::string_view topic;
+    std::string_view payload;
+};
+
+/**
+ * @brief Zero-copy inbound handlers; run on the receive thread.
+ */
+using ZeroCopyHandler = std::function<void(ZmqMessage& message)>;
+using BatchHandler = std::function<void(const MessageBatch& batch)>;
+
+/**
+ * @brief Hands received messages to the installed handler without locking.
+ *
+ * The handlers live in an RcuSnapshot, so dispatch() is wait-free and a handler can
+ * be swapped while messages are flowing; the old one is destroyed only after the
+ * receive thread has finished any call into it. Setting a handler waits for that,
+ * so it must not be done from inside a handler. At most one of the per-message and
+ * batch handlers is installed at a time.
+ */
+class MessageDispatcher {
+public:
+    MessageDispatcher() : handlers_(std::make_unique<const Handlers>()) {}
+
+    void setHandler(ZeroCopyHandler handler) {
+        handlers_.publish(std::make_unique<const Handlers>(Handlers{std::move(handler), nullptr}));
+    }
+
+    void setBatchHandler(BatchHandler handler) {
+        handlers_.publish(std::make_unique<const Handlers>(Handlers{nullptr, std::move(handler)}));
+    }
+
+    /**
+     * @return false if no handler is installed.
+     */
+    bool dispatch(ZmqMessage& message) const {
+        return dispatch(MessageBatch(&message, 1));
+    }
+
+    /**
+     * @brief Deliver a batch: one call to the batch handler, or one call per message.
+     * @return false if no handler is installed.
+     */
+    bool dispatch(const MessageBatch& batch) const {
+        const auto handlers = handlers_.read();
+        if (handlers->batch) {
+            handlers->batch(batch);
+            return true;
+        }
+        if (!handlers->single) return false;
+        for (ZmqMessage& message : batch) handlers->single(message);
+        return true;
+    }
+
+private:
+    struct Handlers {
+        ZeroCopyHandler single;
+        BatchHandler batch;
+    };
+
+    TradingSystem::RcuSnapshot<Handlers> handlers_;
+};
+
+} // namespace messaging
+} // namespace core
+} // namespace hft
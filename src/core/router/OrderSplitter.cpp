@@ -0,0 +1,91 @@
+// OrderSplitter.cpp
+#include "OrderSplitter.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace TradingSystem::Routing {
+
+void OrderSplitter::split(bool isBuy, double quantity, const VenueDepth* venues, std::size_t venueCount,
+                          SplitPlan& plan) const noexcept {
+    constexpr double kExhausted = std::numeric_limits<double>::infinity();
+    const std::size_t n = std::min(venueCount, SplitPlan::kMaxSlices);
+
+    // Per venue: price multiplier, next level, volume left on it, and the level's
+    // comparison key (effective price for a buy, negated effective proceeds for a sell,
+    // so lower is always better).
+    std::array<double, SplitPlan::kMaxSlices> multiplier;
+    std::array<uint32_t, SplitPlan::kMaxSlices> cursor;
+    std::array<double, SplitPlan::kMaxSlices> levelLeft;
+    std::array<double, SplitPlan::kMaxSlices> key;
+    std::array<double, SplitPlan::kMaxSlices> filled;
+    std::array<double, SplitPlan::kMaxSlices> notional;
+    std::array<double, SplitPlan::kMaxSlices> limit;
+
+    auto loadLevel = [&](std::size_t v) noexcept {
+        const VenueDepth& depth = venues[v];
+        const uint32_t usable = std::min(depth.levelCount, model_.maxLevels);
+        // Skip empty levels so a zero-volume head never wins the merge.
+        while (cursor[v] < usable && depth.levels[cursor[v]].volume <= 0.0) ++cursor[v];
+        if (cursor[v] >= usable) {
+            key[v] = kExhausted;
+            return;
+        }
+        const double effective = depth.levels[cursor[v]].price * multiplier[v];
+        levelLeft[v] = depth.levels[cursor[v]].volume;
+        key[v] = isBuy ? effective : -effective;
+    };
+
+    for (std::size_t v = 0; v < n; ++v) {
+        const VenueDepth& depth = venues[v];
+        const double adjBps = depth.feeBps + model_.driftBpsPerMs * depth.latencyUs * 1e-3
+                              + model_.missPenaltyBps * (1.0 - std::clamp(depth.reliability, 0.0, 1.0));
+        multiplier[v] = isBuy ? 1.0 + adjBps * 1e-4 : 1.0 - adjBps * 1e-4;
+        cursor[v] = 0;
+        filled[v] = 0.0;
+        notional[v] = 0.0;
+        if (depth.available && depth.levels != nullptr) loadLevel(v);
+        else key[v] = kExhausted;
+    }
+
+    double remaining = quantity;
+    double effectiveCost = 0.0;
+    while (remaining > 0.0) {
+        std::size_t best = n;
+        double bestKey = kExhausted;
+        for (std::size_t v = 0; v < n; ++v) {
+            if (key[v] < bestKey) {
+                bestKey = key[v];
+                best = v;
+            }
+        }
+        if (best == n) break;  // visible depth exhausted everywhere
+
+        const double take = std::min(remaining, levelLeft[best]);
+        const double price = venues[best].levels[cursor[best]].price;
+        filled[best] += take;
+        notional[best] += take * price;
+        limit[best] = price;
+        effectiveCost += take * price * multiplier[best];
+        remaining -= take;
+        levelLeft[best] -= take;
+        if (levelLeft[best] <= 0.0) {
+            ++cursor[best];
+            loadLevel(best);
+        }
+    }
+
+    plan.count = 0;
+    double allocatedNotional = 0.0;
+    for (std::size_t v = 0; v < n; ++v) {
+        if (filled[v] <= 0.0) continue;
+        plan.slices[plan.count++] = VenueSlice{static_cast<uint32_t>(v), filled[v], notional[v] / filled[v], limit[v]};
+        allocatedNotional += notional[v];
+    }
+    plan.allocated = quantity - remaining;
+    plan.unallocated = remaining;
+    plan.avgPrice = plan.allocated > 0.0 ? allocatedNotional / plan.allocated : 0.0;
+    plan.effectiveCost = effectiveCost;
+}
+
+} // namespace TradingSystem::Routing
@@ -0,0 +1,74 @@
+// OrderSplitter.hpp
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "core/models/MarketData.hpp"
+
+namespace TradingSystem::Routing {
+
+// Everything the splitter knows about one venue for one decision. `levels` points at the
+// venue's side of the book that the order would take (asks for a buy, bids for a sell),
+// best level first; the splitter only reads it during split().
+struct VenueDepth {
+    const XAlgo::Data::PriceLevel* levels = nullptr;
+    uint32_t levelCount = 0;
+    double latencyUs = 0.0;
+    double reliability = 1.0;     // probability the venue fills what it is sent
+    double feeBps = 0.0;          // taker fee
+    bool available = true;
+};
+
+// Converts latency and reliability into price terms, so every level on every venue can
+// be compared on a single effective price.
+struct SplitCostModel {
+    double driftBpsPerMs = 0.5;   // expected adverse move while the order is in flight
+    double missPenaltyBps = 5.0;  // cost of re-sourcing quantity a venue fails to fill
+    uint32_t maxLevels = 5;       // top-N levels considered per venue
+};
+
+struct VenueSlice {
+    uint32_t venue;
+    double quantity;
+    double avgPrice;              // book price, before fees and penalties
+    double limitPrice;            // worst level reached on this venue
+};
+
+struct SplitPlan {
+    static constexpr std::size_t kMaxSlices = 64;
+
+    std::array<VenueSlice, kMaxSlices> slices;
+    uint32_t count = 0;
+    double allocated = 0.0;
+    double unallocated = 0.0;     // quantity beyond the visible depth considered
+    double avgPrice = 0.0;        // book price over the allocated quantity
+    double effectiveCost = 0.0;   // notional including fees and penalties (proceeds for a sell)
+};
+
+// Cost-aware allocation of a parent order across venues.
+//
+// Each venue's effective price for a level is its book price adjusted by
+//     feeBps + driftBpsPerMs * latencyMs + missPenaltyBps * (1 - reliability)
+// (added for a buy, subtracted for a sell). Book levels are monotone and the adjustment
+// is constant per venue, so every venue's marginal cost is non-decreasing in quantity
+// and taking levels greedily, cheapest effective price first across all venues, is the
+// minimum-cost allocation. The merge walks at most venues x maxLevels heads, without
+// sorting or allocating.
+class OrderSplitter {
+public:
+    explicit OrderSplitter(const SplitCostModel& model = SplitCostModel()) noexcept : model_(model) {}
+
+    void setCostModel(const SplitCostModel& model) noexcept { model_ = model; }
+    [[nodiscard]] const SplitCostModel& costModel() const noexcept { return model_; }
+
+    // Allocate `quantity` across `venues[0 .. venueCount)`; venues past kMaxSlices are ignored.
+    // Slice `venue` fields are indices into `venues`.
+    void split(bool isBuy, double quantity, const VenueDepth* venues, std::size_t venueCount,
+               SplitPlan& plan) const noexcept;
+
+private:
+    SplitCostModel model_;
+};
+
+} // namespace TradingSystem::Routing
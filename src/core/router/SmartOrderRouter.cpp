@@ -1,127 +1,321 @@
-#include <iostream>
-#include <vector>
-#include <string>
-#include <thread>
-#include <mutex>
-#include <atomic>
-#include <future>
-#include <chrono>
-#include <stdexcept>
+// SmartOrderRouter.cpp
+#include "SmartOrderRouter.hpp"
+
 #include <algorithm>
+#include <array>
 
-// Order and Venue definitions
-struct Order {
-    std::string symbol;
-    double price;
-    double quantity;
-    std::string side; // "buy" or "sell"
-};
-
-struct Venue {
-    std::string name;
-    double latency;       // in microseconds
-    double reliability;   // reliability factor (closer to 1 is better)
-    std::atomic<bool> available;
-
-    // Constructor
-    Venue(const std::string& n, double l, double r)
-        : name(n), latency(l), reliability(r), available(true) {}
-
-    // Delete copy constructor and assignment (because of std::atomic)
-    Venue(const Venue&) = delete;
-    Venue& operator=(const Venue&) = delete;
-
-    // Allow move semantics
-    Venue(Venue&& other) noexcept
-        : name(std::move(other.name)),
-          latency(other.latency),
-          reliability(other.reliability),
-          available(other.available.load()) {}
-
-    Venue& operator=(Venue&& other) noexcept {
-        if (this != &other) {
-            name = std::move(other.name);
-            latency = other.latency;
-            reliability = other.reliability;
-            available.store(other.available.load());
-        }
-        return *this;
+#include "core/concurrency/ThreadRuntime.hpp"
+#include "utils/Clock.hpp"
+#include "utils/LatencyTracer.hpp"
+
+namespace TradingSystem::Routing {
+
+namespace {
+
+// Default transport: hold the worker for the venue's nominal latency, like a blocking send.
+bool simulatedSend(const Venue& venue, const VenueOrder&) noexcept {
+    const uint64_t start = TscClock::now();
+    const double waitNs = venue.latency * 1e3;
+    while (TscClock::toNanos(TscClock::now() - start) < waitNs) cpuRelax();
+    return true;
+}
+
+} // namespace
+
+SmartOrderRouter::SmartOrderRouter(std::vector<Venue>&& v, CompletionCallback onComplete,
+                                   VenueTransport transport, std::vector<int> cores)
+    : venues(std::move(v)),
+      stats_(std::make_unique<VenueStatsCell[]>(venues.size())),
+      rankedVenue_(std::make_unique<std::atomic<uint32_t>[]>(venues.size())),
+      ranking_(std::make_unique<const VenueRanking>()),
+      onComplete_(std::move(onComplete)),
+      transport_(transport ? std::move(transport) : VenueTransport(&simulatedSend)),
+      routes_(std::make_unique<InFlightRoute[]>(kMaxInFlight)) {
+    TscClock::calibrate();
+    for (std::size_t i = 0; i < venues.size(); ++i) {
+        // Seed with the configured latency until real reports arrive.
+        stats_[i].latencyUs.store(venues[i].latency, std::memory_order_relaxed);
+        stats_[i].score.store(scoreFor(i, venues[i].latency, 1.0, 0.0), std::memory_order_relaxed);
+    }
+    rankVenues();
+    ranker_ = threadRuntime().start("router.rank", [this] { runRanker(); });
+
+    workers_.reserve(venues.size());
+    for (std::size_t i = 0; i < venues.size(); ++i) {
+        workers_.push_back(std::make_unique<VenueWorker>());
+        // "router.<venue>" in the thread topology; an explicit core overrides its CPU.
+        ThreadSpec spec = threadRuntime().spec("router." + venues[i].name());
+        if (!cores.empty()) spec.cpu = cores[i % cores.size()];
+        workers_.back()->thread = threadRuntime().start(std::move(spec), [this, i] { runWorker(i); });
+    }
+}
+
+SmartOrderRouter::~SmartOrderRouter() {
+    stop_.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+        worker->queue.wakeConsumer();
+        worker->thread.join();
+    }
+    // Workers are gone, so nothing re-flags the ranking; wake the ranker to see stop_.
+    rankDirty_.store(true, std::memory_order_release);
+    rankDirty_.notify_one();
+    ranker_.join();
+}
+
+VenueOrder SmartOrderRouter::translateOrder(const Order& order) const noexcept {
+    VenueOrder out;
+    out.symbol = order.symbol;
+    out.price = order.price;
+    out.quantity = order.quantity;
+    out.isBuy = order.isBuy;
+    out.trace = order.trace;
+    out.trace.mark(TraceStage::Router);
+    return out;
+}
+
+double SmartOrderRouter::scoreFor(std::size_t venue, double latencyUs, double fillRatio,
+                                  double rejectRate) const noexcept {
+    const double effectiveReliability = venues[venue].reliability * fillRatio * (1.0 - rejectRate);
+    // Floor the latency so zero-latency venues still compare on reliability.
+    return std::max(latencyUs, 1e-3) / std::max(effectiveReliability, 1e-6);
+}
+
+void SmartOrderRouter::publishRanking() {
+    // Caller holds rankMutex_.
+    auto ranking = std::make_unique<VenueRanking>();
+    ranking->version = ranking_.version() + 1;
+    ranking->scores.resize(venues.size());
+    ranking->order.resize(venues.size());
+    for (std::size_t i = 0; i < venues.size(); ++i) {
+        ranking->scores[i] = stats_[i].score.load(std::memory_order_relaxed);
+        ranking->order[i] = static_cast<uint32_t>(i);
+    }
+    std::stable_sort(ranking->order.begin(), ranking->order.end(), [&](uint32_t a, uint32_t b) {
+        return ranking->scores[a] < ranking->scores[b];
+    });
+    for (std::size_t pos = 0; pos < venues.size(); ++pos) {
+        rankedVenue_[pos].store(ranking->order[pos], std::memory_order_relaxed);
+        stats_[ranking->order[pos]].rank.store(static_cast<uint32_t>(pos), std::memory_order_relaxed);
+    }
+    ranking_.publish(std::move(ranking));
+}
+
+void SmartOrderRouter::rankVenues() {
+    std::lock_guard<std::mutex> lock(rankMutex_);
+    rankDirty_.store(false, std::memory_order_relaxed);
+    publishRanking();
+}
+
+bool SmartOrderRouter::flushRanking() {
+    std::lock_guard<std::mutex> lock(rankMutex_);
+    if (!rankDirty_.exchange(false, std::memory_order_acquire)) return false;
+    publishRanking();
+    return true;
+}
+
+void SmartOrderRouter::requestRerank() noexcept {
+    // Runs on a venue worker: flag only, and notify on the clean-to-dirty edge so a
+    // burst of reports costs one wake-up. The rebuild happens in runRanker().
+    if (!rankDirty_.exchange(true, std::memory_order_release)) rankDirty_.notify_one();
+}
+
+void SmartOrderRouter::runRanker() noexcept {
+    for (;;) {
+        rankDirty_.wait(false, std::memory_order_acquire);
+        if (stop_.load(std::memory_order_relaxed)) return;
+        // Reports landing during the rebuild set the flag again and get another pass.
+        flushRanking();
+    }
+}
+
+bool SmartOrderRouter::orderChanged(std::size_t venue, double score) const noexcept {
+    // Positions are hints maintained by publishRanking(); a stale read costs at most
+    // one extra or one deferred re-rank.
+    const uint32_t pos = stats_[venue].rank.load(std::memory_order_relaxed);
+    const double margin = 1.0 + kRerankHysteresis;
+    if (pos > 0) {
+        const uint32_t better = rankedVenue_[pos - 1].load(std::memory_order_relaxed);
+        if (score * margin < stats_[better].score.load(std::memory_order_relaxed)) return true;
     }
-};
+    if (pos + 1 < venues.size()) {
+        const uint32_t worse = rankedVenue_[pos + 1].load(std::memory_order_relaxed);
+        if (score > stats_[worse].score.load(std::memory_order_relaxed) * margin) return true;
+    }
+    return false;
+}
 
-// SmartOrderRouter implementation
-class SmartOrderRouter {
-private:
-    std::vector<Venue> venues;
-    std::mutex venueMutex;
+void SmartOrderRouter::onExecutionReport(const VenueExecutionReport& report) noexcept {
+    if (report.venue >= venues.size()) return;
+    VenueStatsCell& cell = stats_[report.venue];
 
-    // Order translation logic placeholder
-    Order translateOrder(const Order& order) {
-        return order; // placeholder for actual venue-specific transformation
+    while (cell.writing.test_and_set(std::memory_order_acquire)) cpuRelax();
+    const double fill = report.requestedQuantity > 0.0
+                            ? std::clamp(report.filledQuantity / report.requestedQuantity, 0.0, 1.0)
+                            : (report.rejected ? 0.0 : 1.0);
+    const double latency = cell.latencyUs.load(std::memory_order_relaxed);
+    const double fillRatio = cell.fillRatio.load(std::memory_order_relaxed);
+    const double rejectRate = cell.rejectRate.load(std::memory_order_relaxed);
+    const double newLatency = latency + kStatsAlpha * (report.latencyUs - latency);
+    const double newFill = fillRatio + kStatsAlpha * (fill - fillRatio);
+    const double newReject = rejectRate + kStatsAlpha * ((report.rejected ? 1.0 : 0.0) - rejectRate);
+    const double score = scoreFor(report.venue, newLatency, newFill, newReject);
+    cell.latencyUs.store(newLatency, std::memory_order_relaxed);
+    cell.fillRatio.store(newFill, std::memory_order_relaxed);
+    cell.rejectRate.store(newReject, std::memory_order_relaxed);
+    cell.score.store(score, std::memory_order_relaxed);
+    cell.reports.fetch_add(1, std::memory_order_relaxed);
+    cell.writing.clear(std::memory_order_release);
+
+    if (orderChanged(report.venue, score)) requestRerank();
+}
+
+VenueStats SmartOrderRouter::venueStats(std::size_t venue) const noexcept {
+    const VenueStatsCell& cell = stats_[venue];
+    return VenueStats{cell.latencyUs.load(std::memory_order_relaxed), cell.fillRatio.load(std::memory_order_relaxed),
+                      cell.rejectRate.load(std::memory_order_relaxed), cell.score.load(std::memory_order_relaxed),
+                      cell.reports.load(std::memory_order_relaxed)};
+}
+
+uint64_t SmartOrderRouter::sendOrderAsync(const Order& order) {
+    // Copy the ranked, available venues out of the snapshot and release it before
+    // pushing: a push can wait on a worker, and that worker may be publishing.
+    std::array<uint32_t, kMaxVenues> targets;
+    uint32_t available = 0;
+    {
+        const auto ranking = ranking_.read();
+        for (const uint32_t i : ranking->order) {
+            if (available == kMaxVenues) break;
+            if (venues[i].available.load(std::memory_order_acquire)) targets[available++] = i;
+        }
     }
+    if (available == 0) return 0;
 
-public:
-    SmartOrderRouter(std::vector<Venue>&& v) : venues(std::move(v)) {}
+    uint64_t routeId = 0;
+    const uint32_t slot = claimRoute(available, routeId);
+    if (slot == kMaxInFlight) return 0;
 
-    void rankVenues() {
-        std::lock_guard<std::mutex> lock(venueMutex);
-        std::sort(venues.begin(), venues.end(), [](const Venue& a, const Venue& b) {
-            return (a.latency / a.reliability) < (b.latency / b.reliability);
-        });
+    Job job{translateOrder(order), slot};
+    job.order.routeId = routeId;
+    for (uint32_t k = 0; k < available; ++k) {
+        // Bounded rings: a saturated venue applies backpressure rather than dropping.
+        workers_[targets[k]]->queue.push(job);
     }
+    return routeId;
+}
 
-    void sendOrderAsync(const Order& order) {
-        std::vector<std::future<void>> futures;
-        futures.reserve(venues.size());
-        Order translatedOrder = translateOrder(order);
-
-        for (auto& venue : venues) {
-            if (!venue.available.load(std::memory_order_acquire))
-                continue;
-
-            futures.emplace_back(std::async(std::launch::async, [&translatedOrder, &venue]() {
-                try {
-                    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(venue.latency)));
-                    std::cout << "Order for " << translatedOrder.symbol
-                              << " routed to venue: " << venue.name << std::endl;
-                } catch (const std::exception& e) {
-                    std::cerr << "Error routing order to venue " << venue.name
-                              << ": " << e.what() << std::endl;
-                }
-            }));
+uint64_t SmartOrderRouter::sendOrderSplit(const Order& order,
+                                          const std::vector<const XAlgo::Data::OrderBookSnapshot*>& books,
+                                          SplitPlan* planOut) {
+    const bool isBuy = order.isBuy;
+    const std::size_t n = std::min({venues.size(), books.size(), kMaxVenues});
+    std::array<VenueDepth, kMaxVenues> depth;
+    for (std::size_t i = 0; i < n; ++i) {
+        const XAlgo::Data::OrderBookSnapshot* book = books[i];
+        const VenueStatsCell& cell = stats_[i];
+        VenueDepth& d = depth[i];
+        d = VenueDepth{};
+        if (book != nullptr) {
+            const std::vector<XAlgo::Data::PriceLevel>& side = isBuy ? book->asks : book->bids;
+            d.levels = side.data();
+            d.levelCount = static_cast<uint32_t>(side.size());
         }
+        d.latencyUs = cell.latencyUs.load(std::memory_order_relaxed);
+        d.reliability = venues[i].reliability * cell.fillRatio.load(std::memory_order_relaxed)
+                        * (1.0 - cell.rejectRate.load(std::memory_order_relaxed));
+        d.feeBps = venues[i].feeBps;
+        d.available = venues[i].available.load(std::memory_order_acquire);
+    }
+
+    SplitPlan localPlan;
+    SplitPlan& plan = planOut ? *planOut : localPlan;
+    splitter_.split(isBuy, order.quantity, depth.data(), n, plan);
+    if (plan.count == 0) return 0;
 
-        for (auto& f : futures) {
-            try {
-                f.get();
-            } catch (const std::exception& e) {
-                std::cerr << "Async task error: " << e.what() << std::endl;
-            }
+    uint64_t routeId = 0;
+    const uint32_t slot = claimRoute(plan.count, routeId);
+    if (slot == kMaxInFlight) return 0;
+
+    Job job{translateOrder(order), slot};
+    job.order.routeId = routeId;
+    for (uint32_t k = 0; k < plan.count; ++k) {
+        const VenueSlice& slice = plan.slices[k];
+        job.order.quantity = slice.quantity;
+        // Limit at the deepest level the plan reaches on this venue, not the parent's price.
+        job.order.price = slice.limitPrice;
+        workers_[slice.venue]->queue.push(job);
+    }
+    return routeId;
+}
+
+uint64_t SmartOrderRouter::routeOrder(const Order& order) {
+    // Ranking is maintained from execution reports; nothing to recompute per order.
+    return sendOrderAsync(order);
+}
+
+uint32_t SmartOrderRouter::claimRoute(uint32_t venuesSent, uint64_t& routeId) noexcept {
+    // Slots free up out of order: one slow venue must not block every order that would
+    // land on its slot, so probe forward from a rotating start until a slot is free.
+    const uint64_t start = nextSlot_.fetch_add(1, std::memory_order_relaxed);
+    uint32_t slot = static_cast<uint32_t>(kMaxInFlight);
+    for (std::size_t probe = 0; probe < kMaxInFlight; ++probe) {
+        const auto candidate = static_cast<uint32_t>((start + probe) & (kMaxInFlight - 1));
+        std::atomic<bool>& busy = routes_[candidate].busy;
+        bool expected = false;
+        if (!busy.load(std::memory_order_relaxed)
+            && busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            slot = candidate;
+            break;
         }
     }
+    if (slot == kMaxInFlight) return slot;
+
+    InFlightRoute& route = routes_[slot];
+    routeId = nextRouteId_.fetch_add(1, std::memory_order_relaxed) + 1;
+    route.routeId = routeId;
+    route.sent = venuesSent;
+    route.startTsc = TscClock::now();
+    route.failed.store(0, std::memory_order_relaxed);
+    route.remaining.store(venuesSent, std::memory_order_relaxed);
+    inFlight_.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
 
-    void routeOrder(const Order& order) {
-        rankVenues();
-        sendOrderAsync(order);
+void SmartOrderRouter::waitIdle() const noexcept {
+    uint32_t spins = 0;
+    while (inFlight_.load(std::memory_order_acquire) != 0) {
+        if (++spins < SpinYieldWait::kSpinLimit) cpuRelax();
+        else std::this_thread::yield();
     }
-};
-
-// MAIN
-int main() {
-    try {
-        std::vector<Venue> venues;
-        venues.emplace_back("VenueA", 50.0, 0.99);
-        venues.emplace_back("VenueB", 30.0, 0.97);
-        venues.emplace_back("VenueC", 70.0, 0.995);
-
-        SmartOrderRouter router(std::move(venues));
-        Order order = { "EUR/USD", 1.1234, 1000000, "buy" };
-
-        router.routeOrder(order);
-    } catch (const std::exception& ex) {
-        std::cerr << "Fatal error in SmartOrderRouter: " << ex.what() << std::endl;
-        return EXIT_FAILURE;
+}
+
+void SmartOrderRouter::runWorker(std::size_t venueIndex) noexcept {
+    const Venue& venue = venues[venueIndex];
+    JobQueue& queue = workers_[venueIndex]->queue;
+
+    Job job{};
+    while (queue.waitAndPop(job, stop_)) {
+        const uint64_t start = TscClock::now();
+        job.order.trace.mark(TraceStage::VenueSend, start);
+        const bool ok = transport_(venue, job.order);
+        const double latencyUs = TscClock::toNanos(TscClock::now() - start) / 1e3;
+        onExecutionReport(VenueExecutionReport{venueIndex, latencyUs, job.order.quantity,
+                                               ok ? job.order.quantity : 0.0, !ok});
+        if (tracer_ != nullptr) tracer_->record(job.order.trace);
+        finish(job.slot, ok);
     }
+}
+
+void SmartOrderRouter::finish(uint32_t slot, bool ok) noexcept {
+    InFlightRoute& route = routes_[slot];
+    if (!ok) route.failed.fetch_add(1, std::memory_order_relaxed);
+    if (route.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
 
-    return EXIT_SUCCESS;
+    // Last venue for this order: report, then hand the slot back.
+    const RouteCompletion completion{route.routeId, route.sent, route.failed.load(std::memory_order_relaxed),
+                                     TscClock::toNanos(TscClock::now() - route.startTsc)};
+    if (onComplete_) onComplete_(completion);
+    route.busy.store(false, std::memory_order_release);
+    inFlight_.fetch_sub(1, std::memory_order_release);
 }
+
+} // namespace TradingSystem::Routing
@@ -0,0 +1,274 @@
+// SmartOrderRouter.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/concurrency/RcuSnapshot.hpp"
+#include "core/models/MarketData.hpp"
+#include "core/models/SymbolRegistry.hpp"
+#include "utils/TraceContext.hpp"
+#include "OrderSplitter.hpp"
+
+namespace TradingSystem {
+class LatencyTracer;
+}
+
+// Router-local order/venue types; namespaced so they do not collide with the
+// TradingSystem::Order variants declared by the interface headers.
+namespace TradingSystem::Routing {
+
+// Order and Venue definitions. Names are interned (SymbolRegistry.hpp): orders carry
+// ids and copy without allocating.
+struct Order {
+    SymbolId symbol;
+    double price;
+    double quantity;
+    bool isBuy;
+    TraceContext trace{};  // tick-to-trade stamps so far; stamped Router and VenueSend here
+};
+
+struct Venue {
+    VenueId id;
+    double latency;       // in microseconds
+    double reliability;   // reliability factor (closer to 1 is better)
+    double feeBps;        // taker fee in basis points
+    std::atomic<bool> available;
+
+    // Constructor; venues are configured at startup, so the name is interned here.
+    Venue(const std::string& n, double l, double r, double fee = 0.0)
+        : id(internVenue(n)), latency(l), reliability(r), feeBps(fee), available(true) {}
+
+    // Registry lookup, for logging.
+    [[nodiscard]] const std::string& name() const noexcept { return venueName(id); }
+
+    // Delete copy constructor and assignment (because of std::atomic)
+    Venue(const Venue&) = delete;
+    Venue& operator=(const Venue&) = delete;
+
+    // Allow move semantics
+    Venue(Venue&& other) noexcept
+        : id(other.id),
+          latency(other.latency),
+          reliability(other.reliability),
+          feeBps(other.feeBps),
+          available(other.available.load()) {}
+
+    Venue& operator=(Venue&& other) noexcept {
+        if (this != &other) {
+            id = other.id;
+            latency = other.latency;
+            reliability = other.reliability;
+            feeBps = other.feeBps;
+            available.store(other.available.load());
+        }
+        return *this;
+    }
+};
+
+// Venue-ready copy of an order: fixed size and trivially copyable, so it can sit in
+// a lock-free ring slot without touching the heap.
+struct VenueOrder {
+    uint64_t routeId = 0;
+    SymbolId symbol = kInvalidSymbol;
+    double price = 0.0;
+    double quantity = 0.0;
+    bool isBuy = false;
+    TraceContext trace{};
+};
+
+// Delivered once per routed order, after every venue it was sent to has finished.
+struct RouteCompletion {
+    uint64_t routeId;
+    uint32_t venuesSent;
+    uint32_t venuesFailed;
+    double latencyNs;      // sendOrderAsync() to the last venue finishing
+};
+
+// Execution feedback for one venue send. Workers report every send they make; venue
+// sessions with real fill information can report through onExecutionReport() too.
+struct VenueExecutionReport {
+    std::size_t venue;
+    double latencyUs;
+    double requestedQuantity;
+    double filledQuantity;
+    bool rejected;
+};
+
+// Smoothed per-venue execution quality.
+struct VenueStats {
+    double latencyUs;
+    double fillRatio;
+    double rejectRate;
+    double score;          // lower is better; see SmartOrderRouter::scoreFor
+    uint64_t reports;
+};
+
+// Immutable ranking published to routing threads.
+struct VenueRanking {
+    std::vector<uint32_t> order;   // venue indices, best first
+    std::vector<double> scores;    // score per venue index at publish time
+    uint64_t version = 0;
+};
+
+// SmartOrderRouter implementation
+//
+// Each venue owns one long-lived worker thread (optionally pinned to a core) that
+// polls an MPSC ring. Routing copies the order into every available venue's ring and
+// returns immediately; the worker that finishes last for an order fires the
+// completion callback. Nothing is created or joined per order.
+//
+// Venues are ranked by score = EWMA latency / effective reliability, where effective
+// reliability is the configured reliability times the EWMA fill ratio times (1 - EWMA
+// reject rate). Scores move with every execution report, but the ranking is rebuilt
+// only when a venue overtakes a neighbour by more than kRerankHysteresis, and is then
+// published as an immutable snapshot: routing threads read it wait-free and never
+// take a lock. The rebuild runs on the "router.rank" thread; the venue worker that
+// folds in a report only flags the ranking dirty, so it never allocates, sorts or
+// waits out a publish grace period between sends.
+//
+// sendOrderSplit() is the sizing mode: instead of broadcasting the full quantity it
+// splits the parent across venues by OrderSplitter, pricing each venue's visible depth
+// with its fee and its live latency and effective reliability, and sends each venue
+// only its slice.
+class SmartOrderRouter {
+public:
+    // Sends one order to one venue on that venue's worker thread. Returns false on failure.
+    using VenueTransport = std::function<bool(const Venue&, const VenueOrder&)>;
+    // Invoked on a venue worker thread; keep it short.
+    using CompletionCallback = std::function<void(const RouteCompletion&)>;
+
+    static constexpr std::size_t kMaxInFlight = 4096;
+    static constexpr std::size_t kQueueDepth = 1024;
+    static constexpr std::size_t kMaxVenues = 64;            // venues past this are never routed to
+    static constexpr double kStatsAlpha = 0.05;              // EWMA weight of each report
+    static constexpr double kRerankHysteresis = 0.10;        // relative score margin to reorder
+
+    // @param onComplete per-order completion callback (may be empty)
+    // @param transport  how a worker sends to its venue; defaults to a simulated wire
+    //                   delay of venue.latency microseconds
+    // @param cores      worker i is pinned to cores[i % cores.size()]; empty = as the
+    //                   thread topology says for "router.<venue name>"
+    explicit SmartOrderRouter(std::vector<Venue>&& v,
+                              CompletionCallback onComplete = nullptr,
+                              VenueTransport transport = nullptr,
+                              std::vector<int> cores = {});
+    ~SmartOrderRouter();
+
+    SmartOrderRouter(const SmartOrderRouter&) = delete;
+    SmartOrderRouter& operator=(const SmartOrderRouter&) = delete;
+
+    // Rebuild and publish the ranking from the current stats unconditionally.
+    void rankVenues();
+
+    // Publish now if a re-rank is pending instead of leaving it to the ranking thread.
+    // @return true if a new ranking was published
+    bool flushRanking();
+
+    // Fold one execution report into the venue's stats; if the order changes, flags a
+    // re-rank for the ranking thread.
+    void onExecutionReport(const VenueExecutionReport& report) noexcept;
+
+    [[nodiscard]] VenueStats venueStats(std::size_t venue) const noexcept;
+    [[nodiscard]] RcuSnapshot<VenueRanking>::ReadGuard ranking() const noexcept { return ranking_.read(); }
+
+    // Fire-and-forget fan-out to every available venue.
+    // @return route id reported in the completion, or 0 if no venue is available or
+    //         all kMaxInFlight in-flight slots are taken.
+    uint64_t sendOrderAsync(const Order& order);
+
+    // Split `order` across venues by expected cost and send each venue its slice.
+    // @param books  books[i] is venue i's current book (nullptr = no depth, not routed to)
+    // @param plan   optional; receives the allocation, including any unallocated remainder
+    // @return route id, or 0 if nothing could be allocated or the in-flight table is full
+    uint64_t sendOrderSplit(const Order& order, const std::vector<const XAlgo::Data::OrderBookSnapshot*>& books,
+                            SplitPlan* plan = nullptr);
+
+    // Not synchronised with routing; configure before orders flow.
+    void setSplitCostModel(const SplitCostModel& model) noexcept { splitter_.setCostModel(model); }
+    // Each venue send of a traced order is recorded here after the transport returns.
+    // Not synchronised with routing either; nullptr (the default) records nothing.
+    void setTracer(LatencyTracer* tracer) noexcept { tracer_ = tracer; }
+
+    uint64_t routeOrder(const Order& order);
+
+    // Spin until every routed order has completed (tests, benchmarks, shutdown).
+    void waitIdle() const noexcept;
+
+    [[nodiscard]] std::size_t inFlight() const noexcept { return inFlight_.load(std::memory_order_acquire); }
+    [[nodiscard]] std::size_t venueCount() const noexcept { return venues.size(); }
+
+private:
+    struct Job {
+        VenueOrder order;
+        uint32_t slot;
+    };
+
+    // Outstanding fan-out for one route id; claimed via `busy`, released by the last venue.
+    struct alignas(TradingSystem::kCacheLineSize) InFlightRoute {
+        std::atomic<bool> busy{false};
+        std::atomic<uint32_t> remaining{0};
+        std::atomic<uint32_t> failed{0};
+        uint32_t sent = 0;
+        uint64_t routeId = 0;
+        uint64_t startTsc = 0;
+    };
+
+    using JobQueue = TradingSystem::ConcurrentQueue<TradingSystem::MpscRing<Job, kQueueDepth>, TradingSystem::SpinYieldWait>;
+
+    struct VenueWorker {
+        JobQueue queue;
+        std::thread thread;
+    };
+
+    // Stats are written under a per-venue spin flag (writers only); readers use the atomics.
+    struct alignas(TradingSystem::kCacheLineSize) VenueStatsCell {
+        std::atomic_flag writing = ATOMIC_FLAG_INIT;
+        std::atomic<double> latencyUs{0.0};
+        std::atomic<double> fillRatio{1.0};
+        std::atomic<double> rejectRate{0.0};
+        std::atomic<double> score{0.0};
+        std::atomic<uint64_t> reports{0};
+        std::atomic<uint32_t> rank{0};          // position in the last published ranking
+    };
+
+    std::vector<Venue> venues;
+    std::unique_ptr<VenueStatsCell[]> stats_;
+    std::unique_ptr<std::atomic<uint32_t>[]> rankedVenue_;  // venue at each published position
+    RcuSnapshot<VenueRanking> ranking_;
+    std::mutex rankMutex_;                 // serialises re-rankers, never taken by routing
+    std::atomic<bool> rankDirty_{false};   // waited on by the ranking thread
+    std::thread ranker_;
+    OrderSplitter splitter_;
+
+    CompletionCallback onComplete_;
+    VenueTransport transport_;
+    LatencyTracer* tracer_ = nullptr;
+    std::vector<std::unique_ptr<VenueWorker>> workers_;
+    std::unique_ptr<InFlightRoute[]> routes_;
+    std::atomic<uint64_t> nextRouteId_{0};
+    std::atomic<uint64_t> nextSlot_{0};    // where the next claim starts probing
+    std::atomic<std::size_t> inFlight_{0};
+    std::atomic<bool> stop_{false};
+
+    VenueOrder translateOrder(const Order& order) const noexcept;
+    // Claim a free in-flight slot for `venuesSent` sends, probing past busy ones; returns
+    // kMaxInFlight (and assigns no route id) only if every slot is busy.
+    uint32_t claimRoute(uint32_t venuesSent, uint64_t& routeId) noexcept;
+    void runWorker(std::size_t venueIndex) noexcept;
+    void finish(uint32_t slot, bool ok) noexcept;
+    [[nodiscard]] double scoreFor(std::size_t venue, double latencyUs, double fillRatio, double rejectRate) const noexcept;
+    [[nodiscard]] bool orderChanged(std::size_t venue, double score) const noexcept;
+    void requestRerank() noexcept;
+    void publishRanking();
+    void runRanker() noexcept;
+};
+
+} // namespace TradingSystem::Routing
@@ -0,0 +1,165 @@
+// currency_graph.cpp
+#include "core/models/CurrencyGraph.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TradingSystem {
+
+CurrencyGraph::CurrencyGraph(std::size_t maxCurrencies, std::size_t maxCycleLength,
+                             double minLogProfit, std::size_t maxOpportunities)
+    : stride_(std::max<std::size_t>(maxCurrencies, 3)),
+      maxCycleLength_(std::clamp<std::size_t>(maxCycleLength, 3, ArbitrageOpportunity::kMaxLegs)),
+      minLogProfit_(minLogProfit),
+      maxOpportunities_(std::max<std::size_t>(maxOpportunities, 1)),
+      weight_(stride_ * stride_, kNoEdge),
+      transposed_(stride_ * stride_, kNoEdge),
+      edgePair_(stride_ * stride_, std::numeric_limits<PairId>::max()) {
+    codes_.reserve(stride_);
+    live_.reserve(maxOpportunities_);
+}
+
+CurrencyGraph::CurrencyId CurrencyGraph::addCurrency(const std::string& code) {
+    const auto it = std::find(codes_.begin(), codes_.end(), code);
+    if (it != codes_.end()) return static_cast<CurrencyId>(it - codes_.begin());
+    if (codes_.size() == stride_) return kInvalidCurrency;
+    codes_.push_back(code);
+    return static_cast<CurrencyId>(codes_.size() - 1);
+}
+
+CurrencyGraph::PairId CurrencyGraph::addPair(const std::string& symbol) {
+    std::string base, quote;
+    const auto slash = symbol.find('/');
+    if (slash != std::string::npos) {
+        base = symbol.substr(0, slash);
+        quote = symbol.substr(slash + 1);
+    } else if (symbol.size() == 6) {
+        base = symbol.substr(0, 3);
+        quote = symbol.substr(3);
+    }
+    if (base.empty() || quote.empty() || base == quote) return kInvalidPair;
+
+    const CurrencyId b = addCurrency(base);
+    const CurrencyId q = addCurrency(quote);
+    if (b == kInvalidCurrency || q == kInvalidCurrency) return kInvalidPair;
+
+    pairs_.push_back(Pair{symbol, internSymbol(symbol), b, q});
+    const auto id = static_cast<PairId>(pairs_.size() - 1);
+    edgePair_[at(b, q)] = id;
+    edgePair_[at(q, b)] = id;
+    return id;
+}
+
+double CurrencyGraph::logRate(CurrencyId from, CurrencyId to) const noexcept {
+    if (from >= stride_ || to >= stride_) return kNoEdge;
+    return weight_[at(from, to)];
+}
+
+std::size_t CurrencyGraph::onQuote(PairId pair, double bid, double ask) noexcept {
+    if (pair >= pairs_.size() || !(bid > 0.0) || !(ask >= bid)) return live_.size();
+
+    const Pair& p = pairs_[pair];
+    const double sell = std::log(bid);
+    const double buy = -std::log(ask);
+    weight_[at(p.base, p.quote)] = transposed_[at(p.quote, p.base)] = sell;
+    weight_[at(p.quote, p.base)] = transposed_[at(p.base, p.quote)] = buy;
+
+    // Every cycle through either edge is now stale; the rest of the list is untouched.
+    dropCyclesThrough(p.base, p.quote);
+    recheckEdge(p.base, p.quote);
+    recheckEdge(p.quote, p.base);
+    return live_.size();
+}
+
+void CurrencyGraph::dropCyclesThrough(CurrencyId a, CurrencyId b) noexcept {
+    live_.erase(std::remove_if(live_.begin(), live_.end(),
+                               [a, b](const ArbitrageOpportunity& o) { return o.uses(a, b) || o.uses(b, a); }),
+                live_.end());
+}
+
+void CurrencyGraph::recheckEdge(CurrencyId u, CurrencyId v) noexcept {
+    const std::size_t n = codes_.size();
+    const double base = weight_[at(u, v)];
+    if (base <= kNoEdge * 0.5) return;
+
+    // Triangles u -> v -> k -> u. The diagonal holds kNoEdge, so k == u and k == v
+    // fall below the threshold without a branch.
+    const double* fromV = &weight_[at(v, 0)];
+    const double* intoU = &transposed_[at(u, 0)];
+    for (std::size_t k = 0; k < n; ++k) {
+        const double sum = base + fromV[k] + intoU[k];
+        if (sum > minLogProfit_) {
+            const CurrencyId path[3] = {u, v, static_cast<CurrencyId>(k)};
+            consider(path, 3, sum);
+        }
+    }
+    cyclesChecked_ += n;
+
+    if (maxCycleLength_ < 4) return;
+
+    // Quadrilaterals u -> v -> k -> l -> u. Prune on the partial sum: every edge
+    // weight is a log-rate near zero, so an unquoted hop can never be recovered.
+    for (std::size_t k = 0; k < n; ++k) {
+        const double head = base + fromV[k];
+        if (k == u || head <= kNoEdge * 0.5) continue;
+        const double* fromK = &weight_[at(k, 0)];
+        for (std::size_t l = 0; l < n; ++l) {
+            const double sum = head + fromK[l] + intoU[l];
+            if (sum > minLogProfit_ && l != v) {
+                const CurrencyId path[4] = {u, v, static_cast<CurrencyId>(k), static_cast<CurrencyId>(l)};
+                consider(path, 4, sum);
+            }
+        }
+        cyclesChecked_ += n;
+    }
+}
+
+void CurrencyGraph::consider(const CurrencyId* path, std::size_t length, double logProfit) noexcept {
+    if (live_.size() == maxOpportunities_) {
+        if (logProfit <= live_.back().logProfit) return;
+        live_.pop_back();
+    }
+
+    // Rotate so the smallest currency id starts the cycle; equal cycles then compare equal.
+    const std::size_t start = static_cast<std::size_t>(std::min_element(path, path + length) - path);
+    ArbitrageOpportunity opp;
+    opp.length = static_cast<uint8_t>(length);
+    opp.logProfit = logProfit;
+    for (std::size_t i = 0; i < length; ++i) {
+        CycleLeg& leg = opp.legs[i];
+        leg.from = path[(start + i) % length];
+        leg.to = path[(start + i + 1) % length];
+        leg.pair = edgePair_[at(leg.from, leg.to)];
+        leg.sellBase = pairs_[leg.pair].base == leg.from;
+        leg.rate = std::exp(weight_[at(leg.from, leg.to)]);
+    }
+
+    const auto pos = std::upper_bound(live_.begin(), live_.end(), logProfit,
+                                      [](double p, const ArbitrageOpportunity& o) { return p > o.logProfit; });
+    live_.insert(pos, opp);
+}
+
+std::size_t CurrencyGraph::toTradeLegs(const ArbitrageOpportunity& opp, double notional,
+                                       std::array<TradeLeg, ArbitrageOpportunity::kMaxLegs>& out) const {
+    if (opp.length > kMaxExecutableLegs) return 0;
+
+    double amount = notional;  // held in legs[i].from at the start of step i
+    for (uint8_t i = 0; i < opp.length; ++i) {
+        const CycleLeg& leg = opp.legs[i];
+        const SymbolId symbol = pairs_[leg.pair].id;
+        if (leg.sellBase) {
+            // Sell `amount` of base at the bid.
+            out[i] = TradeLeg(symbol, leg.rate, amount, OrderSide::SELL);
+            amount *= leg.rate;
+        } else {
+            // Spend `amount` of quote on base at the ask; rate is 1 / ask.
+            const double baseQty = amount * leg.rate;
+            out[i] = TradeLeg(symbol, 1.0 / leg.rate, baseQty, OrderSide::BUY);
+            amount = baseQty;
+        }
+    }
+    return opp.length;
+}
+
+} // namespace TradingSystem
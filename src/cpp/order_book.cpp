@@ -0,0 +1,382 @@
+// order_book.cpp
+#include "core/models/OrderBook.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace XAlgo::Data {
+
+namespace {
+
+constexpr uint32_t kLevelsPerSummaryWord = 64 * 64;
+
+inline uint64_t hashOrderId(uint64_t id) noexcept {
+    // murmur3 finalizer: exchange ids are often sequential, so spread them out.
+    id ^= id >> 33;
+    id *= 0xff51afd7ed558ccdULL;
+    id ^= id >> 33;
+    return id;
+}
+
+inline uint32_t highestBit(uint64_t word) noexcept { return 63u - static_cast<uint32_t>(std::countl_zero(word)); }
+inline uint32_t lowestBit(uint64_t word) noexcept { return static_cast<uint32_t>(std::countr_zero(word)); }
+
+} // namespace
+
+// ============================================================================
+// BookView
+// ============================================================================
+
+BookView::Iterator BookView::begin() const noexcept {
+    const int32_t best = (side_ == BookSide::BID) ? book_->bestBid_ : book_->bestAsk_;
+    if (depth_ == 0 || best < 0) return end();
+    return Iterator(book_, side_, best, depth_);
+}
+
+PriceLevel BookView::Iterator::operator*() const noexcept {
+    return book_->levelAt(side_, index_);
+}
+
+BookView::Iterator& BookView::Iterator::operator++() noexcept {
+    if (--remaining_ == 0) {
+        index_ = -1;
+    } else {
+        index_ = book_->nextLevel(side_, index_);
+        if (index_ < 0) remaining_ = 0;
+    }
+    return *this;
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+OrderBook::OrderBook(double tickSize, double referencePrice, uint32_t priceLevels, uint32_t maxOrders)
+    : tickSize_(tickSize),
+      invTickSize_(1.0 / tickSize),
+      baseTick_(0),
+      priceLevels_(std::max(kLevelsPerSummaryWord,
+                            (priceLevels + kLevelsPerSummaryWord - 1) / kLevelsPerSummaryWord * kLevelsPerSummaryWord)) {
+    baseTick_ = toTicks(referencePrice) - static_cast<PriceTicks>(priceLevels_ / 2);
+
+    for (Ladder* side : {&bids_, &asks_}) {
+        side->levels.assign(priceLevels_, Level{});
+        side->occupancy.assign(priceLevels_ / 64, 0);
+        side->summary.assign(priceLevels_ / kLevelsPerSummaryWord, 0);
+    }
+
+    nodes_.resize(maxOrders);
+    for (uint32_t i = 0; i < maxOrders; ++i) {
+        nodes_[i].next = (i + 1 < maxOrders) ? i + 1 : kNil;
+    }
+    freeHead_ = maxOrders > 0 ? 0 : kNil;
+
+    // Keep the id index at most half full so linear probes stay short.
+    const uint64_t indexSize = std::bit_ceil(std::max<uint64_t>(2ull * maxOrders, 16));
+    index_.assign(indexSize, IndexSlot{});
+    indexMask_ = indexSize - 1;
+}
+
+// ============================================================================
+// Level bitmap
+// ============================================================================
+
+int32_t OrderBook::indexFor(double price) const noexcept {
+    const PriceTicks offset = toTicks(price) - baseTick_;
+    if (offset < 0 || offset >= static_cast<PriceTicks>(priceLevels_)) return -1;
+    return static_cast<int32_t>(offset);
+}
+
+void OrderBook::markOccupied(BookSide side, int32_t index) noexcept {
+    Ladder& l = ladder(side);
+    const uint32_t word = static_cast<uint32_t>(index) >> 6;
+    l.occupancy[word] |= 1ull << (index & 63);
+    l.summary[word >> 6] |= 1ull << (word & 63);
+
+    if (side == BookSide::BID) {
+        if (index > bestBid_) bestBid_ = index;
+    } else {
+        if (bestAsk_ < 0 || index < bestAsk_) bestAsk_ = index;
+    }
+}
+
+void OrderBook::markEmpty(BookSide side, int32_t index) noexcept {
+    Ladder& l = ladder(side);
+    const uint32_t word = static_cast<uint32_t>(index) >> 6;
+    l.occupancy[word] &= ~(1ull << (index & 63));
+    if (l.occupancy[word] == 0) l.summary[word >> 6] &= ~(1ull << (word & 63));
+
+    if (side == BookSide::BID && index == bestBid_) {
+        bestBid_ = highestAtOrBelow(l, index - 1);
+    } else if (side == BookSide::ASK && index == bestAsk_) {
+        bestAsk_ = lowestAtOrAbove(l, index + 1);
+    }
+}
+
+int32_t OrderBook::highestAtOrBelow(const Ladder& l, int32_t index) const noexcept {
+    if (index < 0) return -1;
+    const uint32_t word = static_cast<uint32_t>(index) >> 6;
+    const uint32_t bit = static_cast<uint32_t>(index) & 63;
+    const uint64_t below = (bit == 63) ? ~0ull : ((1ull << (bit + 1)) - 1);
+    if (const uint64_t bits = l.occupancy[word] & below) {
+        return static_cast<int32_t>(word * 64 + highestBit(bits));
+    }
+
+    // Walk the summary for the nearest lower non-empty word.
+    uint32_t sword = word >> 6;
+    uint64_t sbits = l.summary[sword] & ((1ull << (word & 63)) - 1);
+    for (;;) {
+        if (sbits) {
+            const uint32_t w = sword * 64 + highestBit(sbits);
+            return static_cast<int32_t>(w * 64 + highestBit(l.occupancy[w]));
+        }
+        if (sword == 0) return -1;
+        sbits = l.summary[--sword];
+    }
+}
+
+int32_t OrderBook::lowestAtOrAbove(const Ladder& l, int32_t index) const noexcept {
+    if (index >= static_cast<int32_t>(priceLevels_)) return -1;
+    const uint32_t word = static_cast<uint32_t>(index) >> 6;
+    const uint32_t bit = static_cast<uint32_t>(index) & 63;
+    if (const uint64_t bits = l.occupancy[word] & (~0ull << bit)) {
+        return static_cast<int32_t>(word * 64 + lowestBit(bits));
+    }
+
+    uint32_t sword = word >> 6;
+    uint64_t sbits = ((word & 63) == 63) ? 0 : (l.summary[sword] & (~0ull << ((word & 63) + 1)));
+    const uint32_t summaryWords = static_cast<uint32_t>(l.summary.size());
+    for (;;) {
+        if (sbits) {
+            const uint32_t w = sword * 64 + lowestBit(sbits);
+            return static_cast<int32_t>(w * 64 + lowestBit(l.occupancy[w]));
+        }
+        if (++sword == summaryWords) return -1;
+        sbits = l.summary[sword];
+    }
+}
+
+int32_t OrderBook::nextLevel(BookSide side, int32_t index) const noexcept {
+    return (side == BookSide::BID) ? highestAtOrBelow(bids_, index - 1)
+                                   : lowestAtOrAbove(asks_, index + 1);
+}
+
+// ============================================================================
+// L3 order handling
+// ============================================================================
+
+void OrderBook::appendOrder(uint32_t n) noexcept {
+    OrderNode& node = nodes_[n];
+    Level& level = ladder(node.side).levels[static_cast<uint32_t>(node.level)];
+    const bool wasEmpty = (level.orderCount == 0);
+
+    node.prev = level.tail;
+    node.next = kNil;
+    if (level.tail != kNil) nodes_[level.tail].next = n;
+    else                    level.head = n;
+    level.tail = n;
+
+    level.volume += node.volume;
+    ++level.orderCount;
+    if (wasEmpty) markOccupied(node.side, node.level);
+}
+
+void OrderBook::unlinkOrder(uint32_t n) noexcept {
+    OrderNode& node = nodes_[n];
+    Level& level = ladder(node.side).levels[static_cast<uint32_t>(node.level)];
+
+    if (node.prev != kNil) nodes_[node.prev].next = node.next;
+    else                   level.head = node.next;
+    if (node.next != kNil) nodes_[node.next].prev = node.prev;
+    else                   level.tail = node.prev;
+
+    level.volume -= node.volume;
+    if (--level.orderCount == 0) {
+        level.volume = 0.0;  // drop floating-point residue
+        markEmpty(node.side, node.level);
+    }
+}
+
+bool OrderBook::addOrder(uint64_t orderId, BookSide side, double price, double volume) noexcept {
+    const int32_t level = indexFor(price);
+    if (orderId == kEmptyKey || volume <= 0.0 || level < 0 || freeHead_ == kNil || findIndex(orderId)) {
+        ++rejected_;
+        return false;
+    }
+
+    const uint32_t n = freeHead_;
+    freeHead_ = nodes_[n].next;
+
+    OrderNode& node = nodes_[n];
+    node.id = orderId;
+    node.volume = volume;
+    node.level = level;
+    node.side = side;
+
+    insertIndex(orderId, n);
+    appendOrder(n);
+    ++liveOrders_;
+    return true;
+}
+
+bool OrderBook::modifyOrder(uint64_t orderId, double newVolume) noexcept {
+    if (newVolume <= 0.0) return deleteOrder(orderId);
+
+    const uint32_t* slot = findIndex(orderId);
+    if (!slot) {
+        ++rejected_;
+        return false;
+    }
+
+    const uint32_t n = *slot;
+    OrderNode& node = nodes_[n];
+    if (newVolume <= node.volume) {
+        ladder(node.side).levels[static_cast<uint32_t>(node.level)].volume += newVolume - node.volume;
+        node.volume = newVolume;
+    } else {
+        unlinkOrder(n);
+        node.volume = newVolume;
+        appendOrder(n);
+    }
+    return true;
+}
+
+bool OrderBook::deleteOrder(uint64_t orderId) noexcept {
+    const uint32_t* slot = findIndex(orderId);
+    if (!slot) {
+        ++rejected_;
+        return false;
+    }
+
+    const uint32_t n = *slot;
+    unlinkOrder(n);
+    eraseIndex(orderId);
+
+    nodes_[n] = OrderNode{};
+    nodes_[n].next = freeHead_;
+    freeHead_ = n;
+    --liveOrders_;
+    return true;
+}
+
+// ============================================================================
+// L2 level handling
+// ============================================================================
+
+bool OrderBook::applyDelta(const BookDelta& delta) noexcept {
+    const int32_t index = indexFor(delta.price);
+    if (index < 0) {
+        ++rejected_;
+        return false;
+    }
+
+    Level& level = ladder(delta.side).levels[static_cast<uint32_t>(index)];
+    const bool wasOccupied = level.volume > 0.0;
+    if (delta.volume <= 0.0) {
+        level.volume = 0.0;
+        if (wasOccupied) markEmpty(delta.side, index);
+    } else {
+        level.volume = delta.volume;
+        if (!wasOccupied) markOccupied(delta.side, index);
+    }
+    return true;
+}
+
+void OrderBook::applySnapshot(const OrderBookSnapshot& snapshot) noexcept {
+    clear();
+
+    // The book is empty, so the window can be re-centred for free.
+    double reference = 0.0;
+    if (!snapshot.bids.empty() && !snapshot.asks.empty()) {
+        reference = 0.5 * (snapshot.bids.front().price + snapshot.asks.front().price);
+    } else if (!snapshot.bids.empty()) {
+        reference = snapshot.bids.front().price;
+    } else if (!snapshot.asks.empty()) {
+        reference = snapshot.asks.front().price;
+    }
+    if (reference > 0.0) baseTick_ = toTicks(reference) - static_cast<PriceTicks>(priceLevels_ / 2);
+
+    for (const PriceLevel& level : snapshot.bids) applyDelta(BookDelta{BookSide::BID, level.price, level.volume});
+    for (const PriceLevel& level : snapshot.asks) applyDelta(BookDelta{BookSide::ASK, level.price, level.volume});
+}
+
+void OrderBook::clear() noexcept {
+    // Only touch populated levels; the ladders are large and mostly empty.
+    for (BookSide side : {BookSide::BID, BookSide::ASK}) {
+        Ladder& l = ladder(side);
+        int32_t index = (side == BookSide::BID) ? bestBid_ : bestAsk_;
+        while (index >= 0) {
+            l.levels[static_cast<uint32_t>(index)] = Level{};
+            index = nextLevel(side, index);
+        }
+        std::fill(l.occupancy.begin(), l.occupancy.end(), 0);
+        std::fill(l.summary.begin(), l.summary.end(), 0);
+    }
+    bestBid_ = -1;
+    bestAsk_ = -1;
+
+    if (liveOrders_ > 0) {
+        std::fill(index_.begin(), index_.end(), IndexSlot{});
+        const uint32_t maxOrders = static_cast<uint32_t>(nodes_.size());
+        for (uint32_t i = 0; i < maxOrders; ++i) {
+            nodes_[i] = OrderNode{};
+            nodes_[i].next = (i + 1 < maxOrders) ? i + 1 : kNil;
+        }
+        freeHead_ = maxOrders > 0 ? 0 : kNil;
+        liveOrders_ = 0;
+    }
+}
+
+void OrderBook::copyTo(OrderBookSnapshot& out, uint32_t depth) const {
+    out.bids.clear();
+    out.asks.clear();
+    for (const PriceLevel level : topBids(depth)) out.bids.push_back(level);
+    for (const PriceLevel level : topAsks(depth)) out.asks.push_back(level);
+}
+
+// ============================================================================
+// Order id index (open addressing, linear probing, backward-shift delete)
+// ============================================================================
+
+uint32_t* OrderBook::findIndex(uint64_t orderId) noexcept {
+    // The sentinel would match the first empty slot, whose node is kNil.
+    if (orderId == kEmptyKey) return nullptr;
+    for (uint64_t i = hashOrderId(orderId) & indexMask_;; i = (i + 1) & indexMask_) {
+        IndexSlot& slot = index_[i];
+        if (slot.key == orderId) return &slot.node;
+        if (slot.key == kEmptyKey) return nullptr;
+    }
+}
+
+bool OrderBook::insertIndex(uint64_t orderId, uint32_t node) noexcept {
+    for (uint64_t i = hashOrderId(orderId) & indexMask_;; i = (i + 1) & indexMask_) {
+        IndexSlot& slot = index_[i];
+        if (slot.key == kEmptyKey) {
+            slot.key = orderId;
+            slot.node = node;
+            return true;
+        }
+        if (slot.key == orderId) return false;
+    }
+}
+
+void OrderBook::eraseIndex(uint64_t orderId) noexcept {
+    uint64_t i = hashOrderId(orderId) & indexMask_;
+    while (index_[i].key != orderId) {
+        if (index_[i].key == kEmptyKey) return;
+        i = (i + 1) & indexMask_;
+    }
+
+    // Shift later members of the probe run back so lookups never stop early.
+    for (uint64_t j = (i + 1) & indexMask_; index_[j].key != kEmptyKey; j = (j + 1) & indexMask_) {
+        const uint64_t home = hashOrderId(index_[j].key) & indexMask_;
+        const bool homeInGap = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+        if (homeInGap) {
+            index_[i] = index_[j];
+            i = j;
+        }
+    }
+    index_[i] = IndexSlot{};
+}
+
+} // namespace XAlgo::Data
@@ -0,0 +1,48 @@
+// position_book.cpp
+#include "core/models/PositionBook.hpp"
+
+#include "core/concurrency/LockFreeQueue.hpp"
+
+PositionBook::PositionBook(std::size_t maxSymbols, std::size_t maxCurrencies)
+    : maxSymbols_(maxSymbols),
+      positions_(std::make_unique<Position[]>(maxSymbols)),
+      currencies_(std::make_unique<Currencies[]>(maxSymbols)),
+      currencyRegistry_(maxCurrencies),
+      exposure_(std::make_unique<std::atomic<double>[]>(maxCurrencies)) {
+    for (std::size_t i = 0; i < maxSymbols_; ++i) positions_[i].symbol_ = static_cast<TradingSystem::SymbolId>(i);
+}
+
+bool PositionBook::addSymbol(TradingSystem::SymbolId symbol) {
+    if (symbol >= maxSymbols_) return false;
+    const std::string_view name = TradingSystem::symbolName(symbol);
+    std::string_view base, quote;
+    const auto slash = name.find('/');
+    if (slash != std::string_view::npos) {
+        base = name.substr(0, slash);
+        quote = name.substr(slash + 1);
+    } else if (name.size() == 6) {
+        base = name.substr(0, 3);
+        quote = name.substr(3);
+    }
+    if (base.empty() || quote.empty() || base == quote) return false;
+
+    const CurrencyId b = currencyRegistry_.intern(base);
+    const CurrencyId q = currencyRegistry_.intern(quote);
+    if (b == kInvalidCurrency || q == kInvalidCurrency) return false;
+    currencies_[symbol] = Currencies{b, q};
+    return true;
+}
+
+std::size_t PositionBook::exposures(double* out, std::size_t capacity) const noexcept {
+    for (;;) {
+        const uint64_t before = seq_.load(std::memory_order_acquire);
+        // currencyRegistry_ only grows at startup, so its size is stable here.
+        const std::size_t n = capacity < currencyRegistry_.size() ? capacity : currencyRegistry_.size();
+        if ((before & 1) == 0) {
+            for (std::size_t i = 0; i < n; ++i) out[i] = exposure_[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) return n;
+        }
+        TradingSystem::cpuRelax();
+    }
+}
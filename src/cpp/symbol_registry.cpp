@@ -0,0 +1,47 @@
+// symbol_registry.cpp
+#include "core/models/SymbolRegistry.hpp"
+
+#include <algorithm>
+
+namespace TradingSystem {
+
+namespace {
+constexpr std::size_t kMaxSymbols = 4096;
+constexpr std::size_t kMaxVenues = 256;
+} // namespace
+
+NameRegistry::NameRegistry(std::size_t capacity)
+    : capacity_(std::min<std::size_t>(capacity, kInvalid)),
+      names_(std::make_unique<std::string[]>(capacity_)) {
+    ids_.reserve(capacity_);
+}
+
+NameRegistry::Id NameRegistry::intern(std::string_view name) {
+    if (name.empty()) return kInvalid;
+    const auto it = ids_.find(name);
+    if (it != ids_.end()) return it->second;
+    if (size_ == capacity_) return kInvalid;
+
+    const auto id = static_cast<Id>(size_);
+    names_[id].assign(name);
+    ids_.emplace(names_[id], id);
+    ++size_;
+    return id;
+}
+
+NameRegistry::Id NameRegistry::find(std::string_view name) const noexcept {
+    const auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : kInvalid;
+}
+
+NameRegistry& symbolRegistry() {
+    static NameRegistry registry(kMaxSymbols);
+    return registry;
+}
+
+NameRegistry& venueRegistry() {
+    static NameRegistry registry(kMaxVenues);
+    return registry;
+}
+
+} // namespace TradingSystem
@@ -0,0 +1,208 @@
+// thread_runtime.cpp
+#include "core/concurrency/ThreadRuntime.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace TradingSystem {
+
+namespace {
+
+// Spec of the ThreadRuntime thread this is, for IdleStrategy::forCurrentThread().
+thread_local const ThreadSpec* currentSpec = nullptr;
+
+constexpr std::size_t kMaxThreadName = 15;   // kernel limit, excluding the terminator
+
+int currentTid() noexcept {
+    return static_cast<int>(::syscall(SYS_gettid));
+}
+
+// set_mempolicy(2) directly, so the runtime needs no libnuma.
+bool preferNode(int node) noexcept {
+    constexpr int kMaxNodes = 1024;
+    if (node < 0 || node >= kMaxNodes) return false;
+    unsigned long mask[kMaxNodes / (8 * sizeof(unsigned long))] = {};
+    mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+    return ::syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, kMaxNodes + 1) == 0;
+}
+
+int nodeOfCurrentCpu() noexcept {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    return ::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 ? static_cast<int>(node) : -1;
+}
+
+// Live figures for a running thread, from procfs and its CPU-time clock.
+void readUsage(ThreadStats& s, pthread_t handle) {
+    clockid_t clock;
+    timespec ts{};
+    if (pthread_getcpuclockid(handle, &clock) == 0 && clock_gettime(clock, &ts) == 0) {
+        s.cpuNanos = static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    const std::string task = "/proc/self/task/" + std::to_string(s.tid);
+    char buf[1024];
+    if (std::FILE* f = std::fopen((task + "/stat").c_str(), "r")) {
+        const std::size_t n = std::fread(buf, 1, sizeof(buf) - 1, f);
+        std::fclose(f);
+        buf[n] = '\0';
+        // Fields after the parenthesised command name; "processor" is field 39.
+        if (const char* p = std::strrchr(buf, ')')) {
+            int field = 2;
+            for (++p; *p != '\0' && field < 39; ++p) field += *p == ' ';
+            if (field == 39) s.lastCpu = std::atoi(p);
+        }
+    }
+    if (std::FILE* f = std::fopen((task + "/status").c_str(), "r")) {
+        unsigned long long v = 0;
+        while (std::fgets(buf, sizeof(buf), f) != nullptr) {
+            if (std::sscanf(buf, "voluntary_ctxt_switches: %llu", &v) == 1) s.voluntarySwitches = v;
+            else if (std::sscanf(buf, "nonvoluntary_ctxt_switches: %llu", &v) == 1) s.involuntarySwitches = v;
+        }
+        std::fclose(f);
+    }
+}
+
+// Final figures, taken by the thread itself just before it exits.
+void readOwnUsage(ThreadStats& s) noexcept {
+    // The same clock as readUsage(); rusage times are coarser and can read lower.
+    timespec ts{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        s.cpuNanos = static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+    rusage ru{};
+    if (getrusage(RUSAGE_THREAD, &ru) == 0) {
+        s.voluntarySwitches = static_cast<uint64_t>(ru.ru_nvcsw);
+        s.involuntarySwitches = static_cast<uint64_t>(ru.ru_nivcsw);
+    }
+    s.lastCpu = sched_getcpu();
+}
+
+} // namespace
+
+std::string_view toString(IdlePolicy policy) noexcept {
+    switch (policy) {
+    case IdlePolicy::BusyPoll: return "busy_poll";
+    case IdlePolicy::SpinYield: return "spin_yield";
+    case IdlePolicy::Sleep: return "sleep";
+    }
+    return "unknown";
+}
+
+bool parseIdlePolicy(std::string_view name, IdlePolicy& out) noexcept {
+    for (IdlePolicy p : {IdlePolicy::BusyPoll, IdlePolicy::SpinYield, IdlePolicy::Sleep}) {
+        if (toString(p) == name) {
+            out = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+const ThreadSpec* ThreadTopology::find(std::string_view name) const noexcept {
+    for (const ThreadSpec& spec : threads) {
+        if (spec.name == name) return &spec;
+    }
+    return nullptr;
+}
+
+IdleStrategy IdleStrategy::forCurrentThread() noexcept {
+    return currentSpec != nullptr ? IdleStrategy(currentSpec->idle, currentSpec->sleep) : IdleStrategy();
+}
+
+void ThreadRuntime::setTopology(ThreadTopology topology) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    topology_ = std::move(topology);
+}
+
+ThreadSpec ThreadRuntime::spec(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const ThreadSpec* found = topology_.find(name)) return *found;
+    ThreadSpec fallback;
+    fallback.name = std::string(name);
+    return fallback;
+}
+
+ThreadStats ThreadRuntime::applyToCurrentThread(const ThreadSpec& spec) {
+    ThreadStats s;
+    s.name = spec.name;
+    s.tid = currentTid();
+    s.requestedCpu = spec.cpu;
+
+    char shortName[kMaxThreadName + 1] = {};
+    std::strncpy(shortName, spec.name.c_str(), kMaxThreadName);
+    (void)pthread_setname_np(pthread_self(), shortName);
+
+    if (spec.cpu >= 0 && spec.cpu < CPU_SETSIZE) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(spec.cpu, &set);
+        s.pinned = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+
+    // Pin first, so "the node of my CPU" means the CPU the thread will stay on.
+    const int node = spec.numaNode >= 0 ? spec.numaNode : (s.pinned ? nodeOfCurrentCpu() : -1);
+    if (node >= 0 && preferNode(node)) s.numaNode = node;
+
+    if (spec.priority > 0) {
+        sched_param param{};
+        param.sched_priority = spec.priority;
+        s.realtime = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+
+    s.lastCpu = sched_getcpu();
+    return s;
+}
+
+void ThreadRuntime::runThread(ThreadSpec spec, std::function<void()> fn) {
+    ThreadStats applied = applyToCurrentThread(spec);
+    applied.running = true;
+    std::size_t index;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.push_back(Record{std::move(applied), pthread_self()});
+        index = records_.size() - 1;
+    }
+
+    currentSpec = &spec;
+    fn();
+    currentSpec = nullptr;
+
+    ThreadStats final;
+    readOwnUsage(final);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ThreadStats& s = records_[index].stats;
+    s.running = false;
+    s.cpuNanos = final.cpuNanos;
+    s.voluntarySwitches = final.voluntarySwitches;
+    s.involuntarySwitches = final.involuntarySwitches;
+    s.lastCpu = final.lastCpu;
+}
+
+std::vector<ThreadStats> ThreadRuntime::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<ThreadStats> out;
+    out.reserve(records_.size());
+    for (const Record& r : records_) {
+        out.push_back(r.stats);
+        // A running thread cannot finish its record while we hold the lock, so its handle is valid.
+        if (r.stats.running) readUsage(out.back(), r.handle);
+    }
+    return out;
+}
+
+ThreadRuntime& threadRuntime() {
+    // Never destroyed: a detached thread may still be finishing its record during exit.
+    static ThreadRuntime* runtime = new ThreadRuntime();
+    return *runtime;
+}
+
+} // namespace TradingSystem
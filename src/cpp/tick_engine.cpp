@@ -0,0 +1,69 @@
+// tick_engine.cpp
+#include "core/models/TickEngine.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace TradingSystem {
+
+QuoteHistory::QuoteHistory(std::size_t capacity)
+    : buffer_(std::bit_ceil(std::max<std::size_t>(capacity, 2))),
+      mask_(buffer_.size() - 1) {}
+
+TickEngine::TickEngine(TriangleCallback onTriangle, std::size_t historyCapacity)
+    : onTriangle_(std::move(onTriangle)),
+      histories_{QuoteHistory(historyCapacity), QuoteHistory(historyCapacity), QuoteHistory(historyCapacity)} {
+    // Pay for TSC calibration here rather than on the first tick.
+    TscClock::calibrate();
+}
+
+IngestResult TickEngine::onQuote(FxLeg leg, double bid, double ask, uint64_t sourceSeq,
+                                 const TraceContext& trace) noexcept {
+    const uint64_t now = TscClock::now();
+
+    if (bid <= 0.0 || ask <= 0.0 || bid > ask) {
+        ++rejected_;
+        return IngestResult::REJECTED;
+    }
+
+    const std::size_t i = static_cast<std::size_t>(leg);
+    QuoteHistory& history = histories_[i];
+    const bool hasPrevious = !history.empty();
+
+    if (hasPrevious) {
+        const Quote& last = history.latest();
+        if (sourceSeq != 0 && sourceSeq <= last.sourceSeq) {
+            ++stale_;
+            return IngestResult::STALE;
+        }
+        if (bid == last.bid && ask == last.ask) {
+            ++conflated_;
+            return IngestResult::CONFLATED;
+        }
+    }
+
+    const double previousMid = hasPrevious ? history.latest().mid() : 0.0;
+    history.push(Quote{bid, ask, sourceSeq, now});
+    ++updated_;
+
+    const double mid = 0.5 * (bid + ask);
+    switch (leg) {
+        case FxLeg::EURUSD: triangle_.eurUsd = mid; break;
+        case FxLeg::GBPUSD: triangle_.gbpUsd = mid; break;
+        case FxLeg::EURGBP: triangle_.eurGbp = mid; break;
+    }
+    primedMask_ |= static_cast<uint8_t>(1u << i);
+
+    // Only a moved mid changes the triangle; bid/ask-only changes are recorded but not fanned out.
+    if (isPrimed() && (!hasPrevious || mid != previousMid)) {
+        triangle_.timestamp = TscClock::toSteady(now);
+        triangle_.trace = trace;
+        triangle_.trace.mark(TraceStage::TickEngine);
+        ++triangleUpdates_;
+        if (onTriangle_) onTriangle_(triangle_, leg);
+    }
+    return IngestResult::UPDATED;
+}
+
+} // namespace TradingSystem
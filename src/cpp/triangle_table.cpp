@@ -0,0 +1,222 @@
+// triangle_table.cpp
+#include "core/models/TriangleTable.hpp"
+
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define XALGO_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace TradingSystem {
+
+namespace {
+
+constexpr double kMinVariance = 1e-300;
+
+inline bool updatesLane(const uint8_t* mask, std::size_t i) noexcept {
+    return mask != nullptr && ((mask[i / 8] >> (i % 8)) & 1u) != 0;
+}
+
+void spreadKernelScalar(const TriangleTable::KernelArgs& k) noexcept {
+    for (std::size_t i = 0; i < k.lanes; ++i) {
+        const double a = k.direct[i], b = k.crossFirst[i], c = k.crossSecond[i];
+        const double s = a - b * c;
+        k.spread[i] = s;
+        if (!(a > 0.0 && b > 0.0 && c > 0.0)) {
+            k.zScore[i] = 0.0;
+            continue;
+        }
+        if (updatesLane(k.updateMask, i)) {
+            const double d = s - k.mean[i];
+            k.mean[i] += k.alpha * d;
+            k.variance[i] = (1.0 - k.alpha) * (k.variance[i] + k.alpha * d * d);
+        }
+        const double var = k.variance[i];
+        k.zScore[i] = var > kMinVariance ? (s - k.mean[i]) / std::sqrt(var) : 0.0;
+    }
+}
+
+#ifdef XALGO_X86_KERNELS
+
+__attribute__((target("avx2,fma")))
+void spreadKernelAvx2(const TriangleTable::KernelArgs& k) noexcept {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d alpha = _mm256_set1_pd(k.alpha);
+    const __m256d decay = _mm256_set1_pd(1.0 - k.alpha);
+    const __m256d minVar = _mm256_set1_pd(kMinVariance);
+    const __m256i laneBit = _mm256_setr_epi64x(1, 2, 4, 8);
+
+    for (std::size_t i = 0; i < k.lanes; i += 4) {
+        const __m256d a = _mm256_loadu_pd(k.direct + i);
+        const __m256d b = _mm256_loadu_pd(k.crossFirst + i);
+        const __m256d c = _mm256_loadu_pd(k.crossSecond + i);
+        const __m256d s = _mm256_fnmadd_pd(b, c, a);  // a - b * c
+        _mm256_storeu_pd(k.spread + i, s);
+
+        const __m256d valid = _mm256_and_pd(_mm256_cmp_pd(a, zero, _CMP_GT_OQ),
+                              _mm256_and_pd(_mm256_cmp_pd(b, zero, _CMP_GT_OQ),
+                                            _mm256_cmp_pd(c, zero, _CMP_GT_OQ)));
+        __m256d mean = _mm256_loadu_pd(k.mean + i);
+        __m256d var = _mm256_loadu_pd(k.variance + i);
+        const unsigned bits = k.updateMask != nullptr ? (k.updateMask[i / 8] >> (i % 8)) & 0xFu : 0u;
+        if (bits != 0) {
+            // Expand the four mask bits to all-ones lanes.
+            const __m256i sel = _mm256_set1_epi64x(bits);
+            const __m256d dirty = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(sel, laneBit), laneBit));
+            const __m256d update = _mm256_and_pd(valid, dirty);
+            const __m256d d = _mm256_sub_pd(s, mean);
+            const __m256d newMean = _mm256_fmadd_pd(alpha, d, mean);
+            const __m256d newVar = _mm256_mul_pd(decay, _mm256_fmadd_pd(_mm256_mul_pd(alpha, d), d, var));
+            mean = _mm256_blendv_pd(mean, newMean, update);
+            var = _mm256_blendv_pd(var, newVar, update);
+            _mm256_storeu_pd(k.mean + i, mean);
+            _mm256_storeu_pd(k.variance + i, var);
+        }
+
+        // Lanes failing the mask may divide by zero; the AND clears them to 0.0.
+        const __m256d ok = _mm256_and_pd(valid, _mm256_cmp_pd(var, minVar, _CMP_GT_OQ));
+        const __m256d z = _mm256_div_pd(_mm256_sub_pd(s, mean), _mm256_sqrt_pd(var));
+        _mm256_storeu_pd(k.zScore + i, _mm256_and_pd(z, ok));
+    }
+}
+
+__attribute__((target("avx512f")))
+void spreadKernelAvx512(const TriangleTable::KernelArgs& k) noexcept {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d alpha = _mm512_set1_pd(k.alpha);
+    const __m512d decay = _mm512_set1_pd(1.0 - k.alpha);
+    const __m512d minVar = _mm512_set1_pd(kMinVariance);
+
+    for (std::size_t i = 0; i < k.lanes; i += 8) {
+        const __m512d a = _mm512_loadu_pd(k.direct + i);
+        const __m512d b = _mm512_loadu_pd(k.crossFirst + i);
+        const __m512d c = _mm512_loadu_pd(k.crossSecond + i);
+        const __m512d s = _mm512_fnmadd_pd(b, c, a);
+        _mm512_storeu_pd(k.spread + i, s);
+
+        const __mmask8 valid = _mm512_cmp_pd_mask(a, zero, _CMP_GT_OQ)
+                             & _mm512_cmp_pd_mask(b, zero, _CMP_GT_OQ)
+                             & _mm512_cmp_pd_mask(c, zero, _CMP_GT_OQ);
+        __m512d mean = _mm512_loadu_pd(k.mean + i);
+        __m512d var = _mm512_loadu_pd(k.variance + i);
+        const __mmask8 update = k.updateMask != nullptr ? valid & k.updateMask[i / 8] : 0;
+        if (update != 0) {
+            const __m512d d = _mm512_sub_pd(s, mean);
+            mean = _mm512_mask3_fmadd_pd(alpha, d, mean, update);  // other lanes keep mean
+            // Lanes outside `update` keep their previous variance.
+            var = _mm512_mask_mul_pd(var, update, decay, _mm512_fmadd_pd(_mm512_mul_pd(alpha, d), d, var));
+            _mm512_storeu_pd(k.mean + i, mean);
+            _mm512_storeu_pd(k.variance + i, var);
+        }
+
+        const __mmask8 ok = valid & _mm512_cmp_pd_mask(var, minVar, _CMP_GT_OQ);
+        const __m512d z = _mm512_maskz_div_pd(ok, _mm512_sub_pd(s, mean), _mm512_maskz_sqrt_pd(ok, var));
+        _mm512_storeu_pd(k.zScore + i, z);
+    }
+}
+
+#endif // XALGO_X86_KERNELS
+
+TriangleTable::KernelFn kernelFor(KernelIsa isa) noexcept {
+#ifdef XALGO_X86_KERNELS
+    switch (isa) {
+        case KernelIsa::AVX512: return &spreadKernelAvx512;
+        case KernelIsa::AVX2:   return &spreadKernelAvx2;
+        case KernelIsa::SCALAR: break;
+    }
+#else
+    (void)isa;
+#endif
+    return &spreadKernelScalar;
+}
+
+} // namespace
+
+KernelIsa TriangleTable::detectKernel() noexcept {
+#ifdef XALGO_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return KernelIsa::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return KernelIsa::AVX2;
+#endif
+    return KernelIsa::SCALAR;
+}
+
+const char* TriangleTable::kernelName(KernelIsa isa) noexcept {
+    switch (isa) {
+        case KernelIsa::AVX512: return "avx512";
+        case KernelIsa::AVX2:   return "avx2";
+        case KernelIsa::SCALAR: return "scalar";
+    }
+    return "unknown";
+}
+
+TriangleTable::TriangleTable(std::size_t symbolCount, double ewmaAlpha)
+    : alpha_(ewmaAlpha),
+      legsBySymbol_(symbolCount),
+      isa_(detectKernel()),
+      kernel_(kernelFor(isa_)) {}
+
+void TriangleTable::forceKernel(KernelIsa isa) noexcept {
+    // Never select an ISA the CPU cannot execute.
+    const KernelIsa best = detectKernel();
+    isa_ = static_cast<uint8_t>(isa) <= static_cast<uint8_t>(best) ? isa : best;
+    kernel_ = kernelFor(isa_);
+}
+
+void TriangleTable::resizeColumns(std::size_t lanes) {
+    for (std::vector<double>* column : {&direct_, &crossFirst_, &crossSecond_, &mean_, &variance_, &spread_, &zScore_}) {
+        column->resize(lanes, 0.0);
+    }
+    primed_.resize(lanes, 0);
+    dirty_.resize(lanes / 8, 0);
+    allLanes_.resize(lanes / 8, 0xFF);
+}
+
+std::size_t TriangleTable::addTriangle(SymbolId direct, SymbolId crossFirst, SymbolId crossSecond) {
+    const std::size_t index = count_++;
+    if (count_ > direct_.size()) {
+        resizeColumns((count_ + kLaneMultiple - 1) / kLaneMultiple * kLaneMultiple);
+    }
+    const auto t = static_cast<uint32_t>(index);
+    legsBySymbol_.at(direct).push_back(LegRef{t, 0});
+    legsBySymbol_.at(crossFirst).push_back(LegRef{t, 1});
+    legsBySymbol_.at(crossSecond).push_back(LegRef{t, 2});
+    return index;
+}
+
+void TriangleTable::onQuote(SymbolId symbol, double mid, bool updateStatistics) noexcept {
+    if (symbol >= legsBySymbol_.size()) return;
+
+    for (const LegRef& ref : legsBySymbol_[symbol]) {
+        const uint32_t t = ref.triangle;
+        switch (ref.column) {
+            case 0:  direct_[t] = mid; break;
+            case 1:  crossFirst_[t] = mid; break;
+            default: crossSecond_[t] = mid; break;
+        }
+        primed_[t] |= static_cast<uint8_t>(1u << ref.column);
+        // Seed the EWMA with the first complete spread so it does not start from 0.
+        if (primed_[t] == 0x7) {
+            mean_[t] = direct_[t] - crossFirst_[t] * crossSecond_[t];
+            variance_[t] = 0.0;
+            primed_[t] |= 0x8;
+        }
+        dirty_[t / 8] |= static_cast<uint8_t>(1u << (t % 8));
+    }
+    evaluate(updateStatistics ? dirty_.data() : nullptr);
+    for (const LegRef& ref : legsBySymbol_[symbol]) dirty_[ref.triangle / 8] = 0;
+}
+
+void TriangleTable::evaluateAll(bool updateStatistics) noexcept {
+    evaluate(updateStatistics ? allLanes_.data() : nullptr);
+}
+
+void TriangleTable::evaluate(const uint8_t* updateMask) noexcept {
+    const KernelArgs args{direct_.data(), crossFirst_.data(), crossSecond_.data(),
+                          mean_.data(), variance_.data(), spread_.data(), zScore_.data(),
+                          direct_.size(), alpha_, updateMask};
+    kernel_(args);
+}
+
+} // namespace TradingSystem
@@ -7,11 +7,15 @@
 #include <memory>            // Smart pointers
 #include <string>            // For config paths & symbols
 #include <cstdlib>           // For EXIT_SUCCESS / EXIT_FAILURE
+#include <algorithm>         // std::min over leg histories
+#include <cmath>             // std::abs on the Z-score
 
 // =====================[ Configuration & Logging ]===================== //
 #include "utils/ConfigLoader.hpp"
 #include "utils/Logger.hpp"
 #include "utils/Metrics.hpp"
+#include "utils/LatencyTracer.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
 
 // =====================[ Data Models ]===================== //
 #include "core/models/Order.hpp"
@@ -21,6 +25,8 @@
 #include "core/models/MarketRegime.hpp"
 #include "core/models/Signal.hpp"
 #include "core/models/Position.hpp"
+#include "core/models/PositionBook.hpp"
+#include "core/models/TickEngine.hpp"
 #include "core/TradeLeg.hpp"
 
 // =====================[ Interfaces (Inversion Layer)]===================== //
@@ -66,42 +72,98 @@ int main() {
     // --------------------------------------------------------
     // Infrastructure Setup
     // --------------------------------------------------------
+    // The thread topology must be in place before any component starts its threads.
+    ConfigLoader config("config/config.yaml");
+    if (!config.ok()) std::cerr << "Config: " << config.lastError() << ", using defaults\n";
+    threadRuntime().setTopology(config.snapshot()->threads);
+
     OrderQueue orderQueue;
     ExecutionManager execManager(orderQueue);
 
+    // Per-stage tick-to-trade histograms ("tick_to_trade.*"), fed by the router's venue workers.
+    Metrics metrics;
+    LatencyTracer tracer(metrics);
+
+    // --------------------------------------------------------
+    // Risk Management
+    // --------------------------------------------------------
+    PositionBook positionBook;
+    for (const char* pair : {"EUR/USD", "GBP/USD", "EUR/GBP"}) positionBook.addSymbol(internSymbol(pair));
+    RiskManager riskManager(config.snapshot()->risk.capital, &positionBook);
+    riskManager.attachMetrics(metrics);
+
+    // Limits follow the config file; edits are picked up without a restart.
+    auto applyRiskLimits = [&riskManager](const ConfigSnapshot& cfg) {
+        riskManager.setMaxDrawdown(cfg.risk.maxDrawdown);
+        riskManager.setMaxOrderNotional(cfg.risk.maxOrderNotional);
+        riskManager.setMaxOrdersPerSecond(cfg.risk.maxOrdersPerSecond != 0 ? cfg.risk.maxOrdersPerSecond : UINT32_MAX);
+    };
+    applyRiskLimits(*config.snapshot());
+    config.onReload(applyRiskLimits);
+    config.startWatcher(std::chrono::seconds(1));
+
+    std::vector<Routing::Venue> venues;
+    venues.emplace_back("LMAX", 5.0, 0.99);
+    venues.emplace_back("EBS", 8.0, 0.98);
+    Routing::SmartOrderRouter router(std::move(venues));
+    router.setTracer(&tracer);
+
     // --------------------------------------------------------
     // Signal & Statistical Edge Computation
     // --------------------------------------------------------
     SignalEngine signalEngine;
     JohansenTestEngine johansenEngine;
 
-    std::vector<TickData> tickSeries;
-    for (int i = 0; i < 1000; ++i) {
-        TickData tick {
-            1.1200 + i * 1e-5,
-            1.3100 + i * 1e-5,
-            0.8600 + i * 1e-5,
-            std::chrono::steady_clock::now()
-        };
-        tickSeries.push_back(tick);
-    }
-
-    std::vector<double> spreadHistory;
-    for (const auto& tick : tickSeries) {
-        spreadHistory.push_back(signalEngine.computeSpread(tick));
+    constexpr int kSyntheticTicks = 1000;
+    constexpr double kEntryZ = 1.0;
+    constexpr double kTradeQuantity = 100'000;
+    const SymbolId eurUsdId = internSymbol("EUR/USD");
+    uint64_t nextOrderId = 1;
+    double zScore = 0.0;
+
+    // Quotes land in preallocated per-leg histories; the callback only fires when a leg's mid moves,
+    // and each triangle update folds into the rolling Z-score in O(1). A stretched spread trades
+    // the EUR/USD leg; the quote's trace follows it through risk and the router to each venue.
+    TickEngine tickEngine([&](const TickData& triangle, FxLeg) {
+        zScore = signalEngine.updateZScore(triangle);
+        TraceContext trace = triangle.trace;
+        trace.mark(TraceStage::Signal);
+        if (std::abs(zScore) < kEntryZ) return;
+
+        Order order(nextOrderId++, eurUsdId, triangle.eurUsd, kTradeQuantity,
+                    zScore < 0.0 ? OrderSide::BUY : OrderSide::SELL, OrderType::MARKET);
+        order.setTrace(trace);
+        if (riskManager.check(order) != RiskCheck::Accepted) return;
+        order.markTrace(TraceStage::RiskCheck);
+        router.sendOrderAsync(Routing::Order{order.getSymbolId(), order.getPrice(), order.getQuantity(),
+                                             order.getSide() == OrderSide::BUY, order.getTrace()});
+    }, kSyntheticTicks);
+
+    // Each synthetic quote is traced from the moment it is "received".
+    for (int i = 0; i < kSyntheticTicks; ++i) {
+        const double bump = i * 1e-5;
+        tickEngine.onQuote(FxLeg::EURUSD, 1.1200 + bump, 1.1200 + bump + 2e-5, 0, TraceContext::begin());
+        tickEngine.onQuote(FxLeg::GBPUSD, 1.3100 + bump, 1.3100 + bump + 2e-5, 0, TraceContext::begin());
+        tickEngine.onQuote(FxLeg::EURGBP, 0.8600 + bump, 0.8600 + bump + 2e-5, 0, TraceContext::begin());
     }
+    router.waitIdle();
 
-    double zScore = signalEngine.computeAdaptiveZScore(spreadHistory);
     std::cout << "Adaptive Z-Score: " << zScore << "\n";
+    std::cout << "Tick-to-trade latency by stage:\n" << tracer.report();
 
     // --------------------------------------------------------
     // Cointegration Test
     // --------------------------------------------------------
-    Eigen::VectorXd eurUsd(tickSeries.size()), gbpUsd(tickSeries.size()), eurGbp(tickSeries.size());
-    for (size_t i = 0; i < tickSeries.size(); ++i) {
-        eurUsd(i) = tickSeries[i].eurUsd;
-        gbpUsd(i) = tickSeries[i].gbpUsd;
-        eurGbp(i) = tickSeries[i].eurGbp;
+    const QuoteHistory& eurUsdHistory = tickEngine.history(FxLeg::EURUSD);
+    const QuoteHistory& gbpUsdHistory = tickEngine.history(FxLeg::GBPUSD);
+    const QuoteHistory& eurGbpHistory = tickEngine.history(FxLeg::EURGBP);
+    const size_t samples = std::min({eurUsdHistory.size(), gbpUsdHistory.size(), eurGbpHistory.size()});
+    Eigen::VectorXd eurUsd(samples), gbpUsd(samples), eurGbp(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        const size_t age = samples - 1 - i;  // oldest first
+        eurUsd(i) = eurUsdHistory[age].mid();
+        gbpUsd(i) = gbpUsdHistory[age].mid();
+        eurGbp(i) = eurGbpHistory[age].mid();
     }
     bool cointegrated = johansenEngine.runTest({eurUsd, gbpUsd, eurGbp});
     std::cout << "Cointegration detected: " << (cointegrated ? "Yes" : "No") << "\n";
@@ -109,7 +171,6 @@ int main() {
     // --------------------------------------------------------
     // Risk Management
     // --------------------------------------------------------
-    RiskManager riskManager(100e6);
     if (!riskManager.evaluateOrderRisk(2e6, 1.2)) {
         std::cerr << "Order rejected due to risk limits.\n";
         return EXIT_FAILURE;
@@ -131,8 +192,9 @@ int main() {
     // --------------------------------------------------------
     // Health Monitoring Simulation
     // --------------------------------------------------------
-    std::thread monitor([&riskManager]() {
+    std::thread monitor = threadRuntime().start("health_monitor", [&riskManager]() {
         while (true) {
+            riskManager.publishMetrics();
             if (!riskManager.isStrategyAllowed()) {
                 std::cerr << "Strategy disabled due to excessive drawdown. Alerting ops...\n";
                 break;
@@ -147,16 +209,20 @@ int main() {
     // --------------------------------------------------------
     // Multi-Leg Trade Execution
     // --------------------------------------------------------
-    Order sampleOrder(1001, "EUR/USD", 1.1234, 1'000'000, OrderSide::BUY, OrderType::MARKET);
+    Order sampleOrder(1001, internSymbol("EUR/USD"), 1.1234, 1'000'000, OrderSide::BUY, OrderType::MARKET);
     std::cout << "[Order Info] ID: " << sampleOrder.getId()
               << ", Symbol: " << sampleOrder.getSymbol()
               << ", Side: " << (sampleOrder.getSide() == OrderSide::BUY ? "BUY" : "SELL")
               << ", Price: " << sampleOrder.getPrice()
               << ", Qty: " << sampleOrder.getQuantity() << "\n";
+    if (const RiskCheck verdict = riskManager.check(sampleOrder); verdict != RiskCheck::Accepted) {
+        std::cerr << "Order rejected by pre-trade risk: " << toString(verdict) << "\n";
+        return EXIT_FAILURE;
+    }
 
-    TradeLeg leg1("EUR/USD", 1.1234, 1'000'000, "buy");
-    TradeLeg leg2("USD/GBP", 0.7890, 1'000'000, "sell");
-    TradeLeg leg3("GBP/EUR", 1.4210, 1'000'000, "buy");
+    TradeLeg leg1(TradingSystem::internSymbol("EUR/USD"), 1.1234, 1'000'000, TradingSystem::OrderSide::BUY);
+    TradeLeg leg2(TradingSystem::internSymbol("USD/GBP"), 0.7890, 1'000'000, TradingSystem::OrderSide::SELL);
+    TradeLeg leg3(TradingSystem::internSymbol("GBP/EUR"), 1.4210, 1'000'000, TradingSystem::OrderSide::BUY);
 
     ExecutionManager multiLegManager;
     multiLegManager.setLegs(leg1, leg2, leg3);
@@ -168,6 +234,12 @@ int main() {
     }
 
     std::cout << "Multi-leg trade executed successfully.\n";
+
+    for (const ThreadStats& t : threadRuntime().stats()) {
+        std::cout << "[Thread] " << t.name << " cpu " << t.lastCpu << (t.pinned ? " (pinned)" : "")
+                  << (t.realtime ? " fifo" : "") << ", " << t.cpuNanos / 1000 << " us cpu, "
+                  << t.voluntarySwitches << " voluntary / " << t.involuntarySwitches << " involuntary switches\n";
+    }
     std::cout << "System shutting down cleanly...\n";
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,86 @@
+// benchmark_currency_graph.cpp
+//
+// Per-quote recheck latency of CurrencyGraph with every pair between N currencies
+// quoted (N*(N-1)/2 pairs), for triangles only and for triangles + 4-cycles.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/models/CurrencyGraph.hpp"
+#include "utils/Clock.hpp"
+
+using namespace TradingSystem;
+
+namespace {
+
+struct Result {
+    double p50Ns, p99Ns, maxNs;
+    std::size_t live;
+};
+
+Result run(std::size_t currencies, std::size_t maxCycleLength, std::size_t quotes) {
+    // Threshold of ~1bp so only genuine dislocations are kept, as in production.
+    CurrencyGraph graph(currencies, maxCycleLength, 1e-4, 64);
+    std::vector<double> fair(currencies);
+    std::vector<CurrencyGraph::PairId> pairs;
+    std::vector<double> pairFair;
+    for (std::size_t i = 0; i < currencies; ++i) {
+        fair[i] = 0.5 + 0.05 * static_cast<double>(i);
+        for (std::size_t j = 0; j < i; ++j) {
+            char symbol[32];
+            std::snprintf(symbol, sizeof(symbol), "C%zu/C%zu", i, j);
+            pairs.push_back(graph.addPair(symbol));
+            pairFair.push_back(fair[i] / fair[j]);
+        }
+    }
+
+    std::mt19937_64 rng(5);
+    std::normal_distribution<double> noise(0.0, 1e-5);
+    std::uniform_int_distribution<std::size_t> pick(0, pairs.size() - 1);
+    auto quote = [&](std::size_t p) {
+        const double mid = pairFair[p] * (1.0 + noise(rng));
+        return std::pair<double, double>(mid * (1.0 - 1e-5), mid * (1.0 + 1e-5));
+    };
+    for (std::size_t p = 0; p < pairs.size(); ++p) {
+        const auto [bid, ask] = quote(p);
+        graph.onQuote(pairs[p], bid, ask);
+    }
+
+    std::vector<double> latencyNs(quotes);
+    for (std::size_t i = 0; i < quotes; ++i) {
+        const std::size_t p = pick(rng);
+        const auto [bid, ask] = quote(p);
+        const uint64_t t0 = TscClock::now();
+        graph.onQuote(pairs[p], bid, ask);
+        latencyNs[i] = TscClock::toNanos(TscClock::now() - t0);
+    }
+    std::sort(latencyNs.begin(), latencyNs.end());
+    return Result{latencyNs[quotes / 2], latencyNs[static_cast<std::size_t>(0.99 * (quotes - 1))],
+                  latencyNs.back(), graph.opportunities().size()};
+}
+
+} // namespace
+
+int main() {
+    TscClock::calibrate();
+    std::cout << std::left << std::setw(12) << "currencies" << std::setw(8) << "cycles"
+              << std::right << std::setw(12) << "p50 (ns)" << std::setw(12) << "p99 (ns)"
+              << std::setw(14) << "max (ns)" << std::setw(8) << "live" << "\n";
+
+    for (const std::size_t currencies : {16u, 50u, 100u}) {
+        for (const std::size_t length : {3u, 4u}) {
+            const Result r = run(currencies, length, 200'000);
+            std::cout << std::left << std::setw(12) << currencies << std::setw(8) << (length == 3 ? "3" : "3+4")
+                      << std::right << std::fixed << std::setprecision(0)
+                      << std::setw(12) << r.p50Ns << std::setw(12) << r.p99Ns
+                      << std::setw(14) << r.maxNs << std::setw(8) << r.live << "\n";
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+// benchmark_execution_latency.cpp
+//
+// Enqueue -> dequeue latency of the signal -> execution order queue.
+// Compares the original mutex + condition_variable OrderQueue against the
+// lock-free SPSC/MPSC rings under each wait policy, using bursty producers.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+
+using namespace TradingSystem;
+
+namespace {
+
+/// @brief Same shape as TradingSystem::Order in IExecutionManager.hpp, plus a send timestamp.
+struct BenchOrder {
+    uint64_t id = 0;
+    int      side = 0;
+    double   quantity = 0.0;
+    double   price = 0.0;
+    int64_t  sentNs = 0;
+};
+
+inline int64_t nowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// @brief The original OrderQueue implementation, kept here as the baseline.
+class MutexOrderQueue {
+public:
+    void push(const BenchOrder& order) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(order);
+        cond_var_.notify_one();
+    }
+
+    void waitAndPop(BenchOrder& order) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_var_.wait(lock, [&]{ return !queue_.empty(); });
+        order = queue_.front();
+        queue_.pop();
+    }
+private:
+    std::queue<BenchOrder> queue_;
+    std::mutex mutex_;
+    std::condition_variable cond_var_;
+};
+
+constexpr int kBurstSize = 32;
+constexpr auto kBurstGap = std::chrono::microseconds(20);
+
+struct Result {
+    std::string name;
+    double throughputMops;
+    int64_t p50, p99, p999, max;
+};
+
+template <typename Queue>
+Result runBenchmark(const std::string& name, int producers, int ordersPerProducer) {
+    Queue queue;
+    const int total = producers * ordersPerProducer;
+    std::vector<int64_t> latencies;
+    latencies.reserve(total);
+
+    std::atomic<bool> go{false};
+    std::thread consumer([&] {
+        BenchOrder order;
+        for (int i = 0; i < total; ++i) {
+            queue.waitAndPop(order);
+            latencies.push_back(nowNs() - order.sentNs);
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) cpuRelax();
+            for (int i = 0; i < ordersPerProducer; ++i) {
+                BenchOrder order{static_cast<uint64_t>(p) * ordersPerProducer + i, 0, 100000, 1.1234, nowNs()};
+                queue.push(order);
+                if ((i + 1) % kBurstSize == 0) {
+                    const auto until = std::chrono::steady_clock::now() + kBurstGap;
+                    while (std::chrono::steady_clock::now() < until) cpuRelax();
+                }
+            }
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    consumer.join();
+    const double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto pct = [&](double q) { return latencies[static_cast<size_t>(q * (latencies.size() - 1))]; };
+    return Result{name, total / elapsedUs, pct(0.50), pct(0.99), pct(0.999), latencies.back()};
+}
+
+void printResult(const Result& r) {
+    std::cout << std::left << std::setw(28) << r.name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << r.throughputMops
+              << std::setw(10) << r.p50 << std::setw(10) << r.p99
+              << std::setw(10) << r.p999 << std::setw(12) << r.max << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int ordersPerProducer = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    constexpr std::size_t kCap = 4096;
+
+    std::cout << std::left << std::setw(28) << "queue"
+              << std::right << std::setw(10) << "Mops/s" << std::setw(10) << "p50 ns"
+              << std::setw(10) << "p99 ns" << std::setw(10) << "p99.9 ns" << std::setw(12) << "max ns" << "\n";
+
+    // Single producer: signal -> execution path
+    printResult(runBenchmark<MutexOrderQueue>("mutex+condvar (baseline)", 1, ordersPerProducer));
+    printResult(runBenchmark<ConcurrentQueue<SpscRing<BenchOrder, kCap>, BusySpinWait>>("spsc busy-spin", 1, ordersPerProducer));
+    printResult(runBenchmark<ConcurrentQueue<SpscRing<BenchOrder, kCap>, SpinYieldWait>>("spsc spin-yield", 1, ordersPerProducer));
+    printResult(runBenchmark<ConcurrentQueue<SpscRing<BenchOrder, kCap>, BlockingWait>>("spsc blocking", 1, ordersPerProducer));
+
+    // Several strategies feeding one ExecutionManager
+    printResult(runBenchmark<MutexOrderQueue>("mutex+condvar x3 producers", 3, ordersPerProducer / 3));
+    printResult(runBenchmark<ConcurrentQueue<MpscRing<BenchOrder, kCap>, BusySpinWait>>("mpsc busy-spin x3", 3, ordersPerProducer / 3));
+    printResult(runBenchmark<ConcurrentQueue<MpscRing<BenchOrder, kCap>, SpinYieldWait>>("mpsc spin-yield x3", 3, ordersPerProducer / 3));
+    printResult(runBenchmark<ConcurrentQueue<MpscRing<BenchOrder, kCap>, BlockingWait>>("mpsc blocking x3", 3, ordersPerProducer / 3));
+
+    return EXIT_SUCCESS;
+}
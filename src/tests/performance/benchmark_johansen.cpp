@@ -0,0 +1,108 @@
+// benchmark_johansen.cpp
+//
+// Cost of re-testing cointegration each time the window moves by one tick:
+// JohansenTestEngine::runTest (copy window + full recompute) versus
+// RollingJohansenEngine (rank-1 moment update + 3x3 solve), at 1k/10k/100k windows.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "core/models/Signal.hpp"
+#include "core/models/RollingJohansen.hpp"
+
+using namespace TradingSystem;
+
+namespace {
+
+struct Series {
+    std::vector<double> eurUsd, gbpUsd, eurGbp;
+};
+
+Series makeSeries(std::size_t n) {
+    Series s;
+    s.eurUsd.reserve(n);
+    s.gbpUsd.reserve(n);
+    s.eurGbp.reserve(n);
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> noise(0.0, 1e-5);
+    double eurUsd = 1.12, gbpUsd = 1.31;
+    for (std::size_t i = 0; i < n; ++i) {
+        eurUsd += noise(rng);
+        gbpUsd += noise(rng);
+        s.eurUsd.push_back(eurUsd);
+        s.gbpUsd.push_back(gbpUsd);
+        s.eurGbp.push_back(eurUsd / gbpUsd + noise(rng));
+    }
+    return s;
+}
+
+/// @brief Average microseconds per window move with the current full-recompute engine.
+double benchFullRecompute(const Series& s, std::size_t window, std::size_t moves) {
+    JohansenTestEngine engine;
+    std::vector<Eigen::VectorXd> data(3, Eigen::VectorXd(static_cast<Eigen::Index>(window)));
+    volatile bool sink = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t m = 0; m < moves; ++m) {
+        for (std::size_t i = 0; i < window; ++i) {
+            const auto k = static_cast<Eigen::Index>(i);
+            data[0](k) = s.eurUsd[m + i];
+            data[1](k) = s.gbpUsd[m + i];
+            data[2](k) = s.eurGbp[m + i];
+        }
+        sink = engine.runTest(data);
+    }
+    (void)sink;
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / moves;
+}
+
+/// @brief Average microseconds per window move with the rolling engine (solving every `solveEvery` ticks).
+double benchRolling(const Series& s, std::size_t window, std::size_t moves, std::size_t solveEvery) {
+    RollingJohansenEngine<3> engine(window, solveEvery);
+    for (std::size_t i = 0; i <= window; ++i) {
+        engine.push(Eigen::Vector3d(s.eurUsd[i], s.gbpUsd[i], s.eurGbp[i]));
+    }
+    volatile int sink = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t m = 1; m <= moves; ++m) {
+        const std::size_t i = window + m;
+        engine.push(Eigen::Vector3d(s.eurUsd[i], s.gbpUsd[i], s.eurGbp[i]));
+        sink = engine.result().rank;
+    }
+    (void)sink;
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / moves;
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t kRollingMoves = 200'000;
+    const Series series = makeSeries(100'000 + kRollingMoves + 2);
+
+    std::cout << std::left << std::setw(10) << "window"
+              << std::right << std::setw(18) << "full (us/move)"
+              << std::setw(22) << "rolling solve=1"
+              << std::setw(22) << "rolling solve=100"
+              << std::setw(12) << "speedup" << "\n";
+
+    for (const std::size_t window : {1'000u, 10'000u, 100'000u}) {
+        // Keep the full-recompute run to roughly the same wall time at every size.
+        const std::size_t fullMoves = std::max<std::size_t>(10, 2'000'000 / window);
+        const double full = benchFullRecompute(series, window, fullMoves);
+        const double rolling = benchRolling(series, window, kRollingMoves, 1);
+        const double scheduled = benchRolling(series, window, kRollingMoves, 100);
+
+        std::cout << std::left << std::setw(10) << window << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(18) << full
+                  << std::setw(22) << rolling
+                  << std::setw(22) << scheduled
+                  << std::setw(11) << std::setprecision(0) << full / rolling << "x\n";
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+// benchmark_order_book.cpp
+//
+// Update throughput of OrderBook: an L2 delta stream and an L3 add/modify/delete mix,
+// both concentrated near the touch like a live EUR/USD feed, with best-level reads
+// after every update. Target: millions of updates per second per book.
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "core/models/OrderBook.hpp"
+#include "utils/Clock.hpp"
+
+using namespace XAlgo::Data;
+using TradingSystem::TscClock;
+
+namespace {
+
+constexpr double kTick = 1e-5;
+constexpr double kMid = 1.1234;
+constexpr std::size_t kUpdates = 5'000'000;
+
+/// @brief Tick offsets from the mid, geometric so most activity sits at the touch.
+std::vector<int> touchOffsets(std::mt19937_64& rng, std::size_t n) {
+    std::geometric_distribution<int> depth(0.15);
+    std::vector<int> out(n);
+    for (int& o : out) o = 1 + depth(rng);
+    return out;
+}
+
+double runL2() {
+    std::mt19937_64 rng(1);
+    const std::vector<int> offsets = touchOffsets(rng, kUpdates);
+    std::vector<double> volumes(kUpdates);
+    for (std::size_t i = 0; i < kUpdates; ++i) volumes[i] = (rng() % 4 == 0) ? 0.0 : 1e6 * static_cast<double>(1 + rng() % 5);
+
+    OrderBook book(kTick, kMid);
+    double checksum = 0.0;
+    const uint64_t start = TscClock::now();
+    for (std::size_t i = 0; i < kUpdates; ++i) {
+        const bool bid = (i & 1) != 0;
+        const double price = kMid + (bid ? -offsets[i] : offsets[i]) * kTick;
+        book.applyDelta(BookDelta{bid ? BookSide::BID : BookSide::ASK, price, volumes[i]});
+        checksum += book.bestBid().volume;
+    }
+    const double seconds = TscClock::toNanos(TscClock::now() - start) * 1e-9;
+    if (checksum < 0.0) std::cout << checksum;
+    return static_cast<double>(kUpdates) / seconds;
+}
+
+double runL3() {
+    constexpr uint32_t kResting = 20'000;
+    std::mt19937_64 rng(2);
+    const std::vector<int> offsets = touchOffsets(rng, kUpdates);
+
+    OrderBook book(kTick, kMid);
+    std::vector<uint64_t> live;
+    live.reserve(kResting);
+    uint64_t nextId = 1;
+    for (uint32_t i = 0; i < kResting; ++i) {
+        const bool bid = (i & 1) != 0;
+        book.addOrder(nextId, bid ? BookSide::BID : BookSide::ASK, kMid + (bid ? -offsets[i] : offsets[i]) * kTick, 1e6);
+        live.push_back(nextId++);
+    }
+
+    double checksum = 0.0;
+    const uint64_t start = TscClock::now();
+    for (std::size_t i = 0; i < kUpdates; ++i) {
+        const uint64_t r = rng();
+        const std::size_t victim = static_cast<std::size_t>(r >> 8) % live.size();
+        switch (r & 3) {
+            case 0:  // cancel and replace: keeps the resting count steady
+            case 1: {
+                book.deleteOrder(live[victim]);
+                const bool bid = (r & 4) != 0;
+                book.addOrder(nextId, bid ? BookSide::BID : BookSide::ASK,
+                              kMid + (bid ? -offsets[i] : offsets[i]) * kTick, 1e6);
+                live[victim] = nextId++;
+                break;
+            }
+            case 2:  book.modifyOrder(live[victim], 5e5); break;    // partial fill
+            default: book.modifyOrder(live[victim], 2e6); break;    // size up, loses priority
+        }
+        checksum += book.bestAsk().volume;
+    }
+    const double seconds = TscClock::toNanos(TscClock::now() - start) * 1e-9;
+    if (checksum < 0.0) std::cout << checksum;
+    return static_cast<double>(kUpdates) / seconds;
+}
+
+} // namespace
+
+int main() {
+    TscClock::calibrate();
+    std::cout << std::fixed << std::setprecision(2)
+              << "order book L2 deltas:        " << runL2() / 1e6 << " M updates/s\n"
+              << "order book L3 add/mod/del:   " << runL3() / 1e6 << " M updates/s\n";
+    return EXIT_SUCCESS;
+}
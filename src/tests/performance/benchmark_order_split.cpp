@@ -0,0 +1,87 @@
+// benchmark_order_split.cpp
+//
+// Latency of one OrderSplitter::split() call for a parent order that walks most of the
+// visible depth, with N venues x 5 levels of randomised books. Target: < 2us at 10 venues.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "core/router/OrderSplitter.hpp"
+#include "utils/Clock.hpp"
+
+using namespace TradingSystem;
+using namespace TradingSystem::Routing;
+using XAlgo::Data::PriceLevel;
+
+namespace {
+
+struct Result {
+    double p50Ns, p99Ns, maxNs;
+    double slices;
+};
+
+Result run(std::size_t venueCount, std::size_t iterations) {
+    constexpr std::size_t kLevels = 5;
+    constexpr std::size_t kBooks = 256;   // rotate books so the branch predictor cannot learn one
+    std::mt19937_64 rng(11);
+    std::uniform_real_distribution<double> offset(0.0, 2e-4);
+    std::uniform_real_distribution<double> volume(1e5, 1e6);
+    std::uniform_real_distribution<double> latency(20.0, 500.0);
+    std::uniform_real_distribution<double> reliability(0.95, 1.0);
+
+    std::vector<std::vector<std::vector<PriceLevel>>> books(kBooks, std::vector<std::vector<PriceLevel>>(venueCount));
+    std::vector<std::vector<VenueDepth>> depth(kBooks, std::vector<VenueDepth>(venueCount));
+    for (std::size_t b = 0; b < kBooks; ++b) {
+        for (std::size_t v = 0; v < venueCount; ++v) {
+            double price = 1.1 + offset(rng);
+            for (std::size_t l = 0; l < kLevels; ++l) {
+                books[b][v].push_back(PriceLevel{price, volume(rng)});
+                price += 1e-5 + offset(rng) * 0.1;
+            }
+            VenueDepth& d = depth[b][v];
+            d.levels = books[b][v].data();
+            d.levelCount = kLevels;
+            d.latencyUs = latency(rng);
+            d.reliability = reliability(rng);
+            d.feeBps = 0.2 * static_cast<double>(v % 3);
+        }
+    }
+
+    // Roughly 60% of the total visible depth, so most heads are consumed.
+    const double parent = 0.6 * static_cast<double>(venueCount * kLevels) * 5.5e5;
+    OrderSplitter splitter;
+    SplitPlan plan;
+    double slices = 0.0;
+    std::vector<double> latencyNs(iterations);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const std::vector<VenueDepth>& venues = depth[i % kBooks];
+        const uint64_t t0 = TscClock::now();
+        splitter.split(true, parent, venues.data(), venues.size(), plan);
+        latencyNs[i] = TscClock::toNanos(TscClock::now() - t0);
+        slices += plan.count;
+    }
+    std::sort(latencyNs.begin(), latencyNs.end());
+    return Result{latencyNs[iterations / 2], latencyNs[static_cast<std::size_t>(0.99 * (iterations - 1))],
+                  latencyNs.back(), slices / static_cast<double>(iterations)};
+}
+
+} // namespace
+
+int main() {
+    TscClock::calibrate();
+    std::cout << std::left << std::setw(8) << "venues"
+              << std::right << std::setw(12) << "p50 (ns)" << std::setw(12) << "p99 (ns)"
+              << std::setw(14) << "max (ns)" << std::setw(10) << "slices" << "\n";
+
+    for (const std::size_t venues : {3u, 10u, 20u}) {
+        const Result r = run(venues, 200'000);
+        std::cout << std::left << std::setw(8) << venues << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(12) << r.p50Ns << std::setw(12) << r.p99Ns << std::setw(14) << r.maxNs
+                  << std::setprecision(1) << std::setw(10) << r.slices << "\n";
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+// benchmark_router.cpp
+//
+// Order fan-out throughput for SmartOrderRouter: the previous design (one std::async
+// task per venue per order, joined before returning) against the persistent venue
+// worker pool. The transport is a no-op so the numbers isolate dispatch overhead.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "core/router/SmartOrderRouter.hpp"
+#include "utils/Clock.hpp"
+
+using namespace TradingSystem;
+using namespace TradingSystem::Routing;
+
+namespace {
+
+std::vector<Venue> makeVenues(std::size_t n) {
+    std::vector<Venue> venues;
+    for (std::size_t i = 0; i < n; ++i) {
+        venues.emplace_back("Venue" + std::to_string(i), 0.0, 0.99);
+    }
+    return venues;
+}
+
+bool noopSend(const Venue&, const VenueOrder& order) noexcept { return order.quantity > 0.0; }
+
+/// @brief Orders/second with the old per-order std::async fan-out.
+double benchAsyncPerOrder(std::size_t venueCount, int orders) {
+    std::vector<Venue> venues = makeVenues(venueCount);
+    const Order order{TradingSystem::internSymbol("EUR/USD"), 1.1234, 1'000'000, true};
+    VenueOrder wire;
+    wire.quantity = order.quantity;
+    std::atomic<uint64_t> sent{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < orders; ++i) {
+        std::vector<std::future<void>> futures;
+        futures.reserve(venues.size());
+        for (auto& venue : venues) {
+            futures.emplace_back(std::async(std::launch::async, [&wire, &venue, &sent] {
+                if (noopSend(venue, wire)) sent.fetch_add(1, std::memory_order_relaxed);
+            }));
+        }
+        for (auto& f : futures) f.get();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return orders / seconds;
+}
+
+struct PoolResult {
+    double ordersPerSec;
+    double p50Us, p99Us;
+};
+
+/// @brief Orders/second and completion latency with the persistent worker pool.
+PoolResult benchWorkerPool(std::size_t venueCount, int orders, std::vector<int> cores) {
+    std::vector<double> latencyNs(static_cast<std::size_t>(orders));
+    std::atomic<std::size_t> completed{0};
+    SmartOrderRouter router(
+        makeVenues(venueCount),
+        [&](const RouteCompletion& c) { latencyNs[completed.fetch_add(1, std::memory_order_relaxed)] = c.latencyNs; },
+        &noopSend, std::move(cores));
+    const Order order{TradingSystem::internSymbol("EUR/USD"), 1.1234, 1'000'000, true};
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < orders; ++i) {
+        while (router.sendOrderAsync(order) == 0) std::this_thread::yield();  // in-flight table full
+    }
+    router.waitIdle();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::size_t n = completed.load();
+    std::sort(latencyNs.begin(), latencyNs.begin() + static_cast<std::ptrdiff_t>(n));
+    return PoolResult{orders / seconds, latencyNs[n / 2] / 1e3,
+                      latencyNs[static_cast<std::size_t>(0.99 * static_cast<double>(n - 1))] / 1e3};
+}
+
+} // namespace
+
+int main() {
+    TscClock::calibrate();
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << std::left << std::setw(8) << "venues"
+              << std::right << std::setw(18) << "async (orders/s)"
+              << std::setw(18) << "pool (orders/s)"
+              << std::setw(14) << "pool p50 us" << std::setw(14) << "pool p99 us"
+              << std::setw(10) << "speedup" << "\n";
+
+    for (const std::size_t venues : {1u, 3u, 8u}) {
+        const double async = benchAsyncPerOrder(venues, 5'000);
+        std::vector<int> cores;
+        // Pin workers off core 0 (the producer) when there is room for them.
+        if (hw > venues) {
+            for (std::size_t i = 0; i < venues; ++i) cores.push_back(static_cast<int>(i + 1));
+        }
+        const PoolResult pool = benchWorkerPool(venues, 500'000, cores);
+        std::cout << std::left << std::setw(8) << venues << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(18) << async << std::setw(18) << pool.ordersPerSec
+                  << std::setprecision(2) << std::setw(14) << pool.p50Us << std::setw(14) << pool.p99Us
+                  << std::setprecision(0) << std::setw(9) << pool.ordersPerSec / async << "x\n";
+    }
+    return EXIT_SUCCESS;
+}
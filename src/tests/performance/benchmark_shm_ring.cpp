@@ -0,0 +1,204 @@
+// benchmark_shm_ring.cpp
+//
+// Loopback round-trip latency between two threads over the shared-memory broadcast
+// ring (two rings, ping and pong, as two co-located processes would use) against ZMQ
+// PUB/SUB over tcp://127.0.0.1, plus the cost of one publish + read on the ring without
+// a second thread. Each round trip carries a 64-byte payload; half a round trip is one
+// hop. Threads are pinned to separate cores when the host has two or more.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <zmq.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "core/concurrency/LockFreeQueue.hpp"
+#include "core/messaging/ShmBroadcastRing.hpp"
+
+using namespace hft::core::messaging;
+
+namespace {
+
+constexpr int kWarmup = 1'000;
+constexpr int kRoundTrips = 20'000;
+constexpr const char* kTopic = "MD.EURUSD";
+constexpr const char* kTcpPing = "tcp://127.0.0.1:5601";
+constexpr const char* kTcpPong = "tcp://127.0.0.1:5602";
+
+void pinTo(unsigned cpu) {
+    if (std::thread::hardware_concurrency() < 2) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+// Spins for a while, then yields, so the benchmark still makes progress on one core.
+template <typename Poll>
+void waitUntil(Poll&& poll) {
+    uint32_t spins = 0;
+    while (!poll()) {
+        if (++spins < TradingSystem::SpinYieldWait::kSpinLimit) TradingSystem::cpuRelax();
+        else std::this_thread::yield();
+    }
+}
+
+struct Percentiles {
+    double p50, p99, max;
+};
+
+Percentiles summarise(std::vector<double>& ns) {
+    std::sort(ns.begin(), ns.end());
+    return {ns[ns.size() / 2], ns[ns.size() * 99 / 100], ns.back()};
+}
+
+std::vector<double> shmRoundTrips() {
+    const std::string pingName = "/xalgo_bench_ping_" + std::to_string(getpid());
+    const std::string pongName = "/xalgo_bench_pong_" + std::to_string(getpid());
+    const ShmRingOptions options{4096, 256};
+    auto ping = ShmBroadcastRing::attach(pingName, options);
+    auto pong = ShmBroadcastRing::attach(pongName, options);
+    if (!ping || !pong) {
+        std::cerr << "cannot create shared-memory rings\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::thread echo([&] {
+        pinTo(1);
+        ShmBroadcastRing::Reader reader(*ping);
+        std::vector<char> buf(ping->maxMessageSize());
+        uint32_t topicLength = 0, payloadLength = 0;
+        for (int i = 0; i < kWarmup + kRoundTrips; ++i) {
+            waitUntil([&] { return reader.tryRead(buf.data(), topicLength, payloadLength); });
+            pong->publish({buf.data(), topicLength}, {buf.data() + topicLength, payloadLength});
+        }
+    });
+
+    pinTo(0);
+    // The echo thread's reader must exist before the first ping, or it starts past it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ShmBroadcastRing::Reader reader(*pong);
+    std::vector<char> buf(pong->maxMessageSize());
+    char payload[64] = {};
+    uint32_t topicLength = 0, payloadLength = 0;
+    std::vector<double> ns;
+    ns.reserve(kRoundTrips);
+    for (int i = 0; i < kWarmup + kRoundTrips; ++i) {
+        std::memcpy(payload, &i, sizeof(i));
+        const auto start = std::chrono::steady_clock::now();
+        ping->publish(kTopic, {payload, sizeof(payload)});
+        waitUntil([&] { return reader.tryRead(buf.data(), topicLength, payloadLength); });
+        const auto end = std::chrono::steady_clock::now();
+        if (i >= kWarmup) ns.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    echo.join();
+    ShmBroadcastRing::unlink(pingName);
+    ShmBroadcastRing::unlink(pongName);
+    return ns;
+}
+
+std::vector<double> tcpRoundTrips() {
+    zmq::context_t context(1);
+    zmq::socket_t pingPub(context, ZMQ_PUB);
+    pingPub.bind(kTcpPing);
+    zmq::socket_t pongPub(context, ZMQ_PUB);
+    pongPub.bind(kTcpPong);
+
+    std::thread echo([&] {
+        pinTo(1);
+        zmq::socket_t sub(context, ZMQ_SUB);
+        sub.set(zmq::sockopt::subscribe, "");
+        sub.connect(kTcpPing);
+        zmq::message_t topic, payload;
+        for (int i = 0; i < kWarmup + kRoundTrips; ++i) {
+            (void)sub.recv(topic, zmq::recv_flags::none);
+            (void)sub.recv(payload, zmq::recv_flags::none);
+            pongPub.send(topic, zmq::send_flags::sndmore);
+            pongPub.send(payload, zmq::send_flags::none);
+        }
+    });
+
+    pinTo(0);
+    zmq::socket_t sub(context, ZMQ_SUB);
+    sub.set(zmq::sockopt::subscribe, "");
+    sub.connect(kTcpPong);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));  // let both subscriptions propagate
+
+    char payload[64] = {};
+    zmq::message_t topicIn, payloadIn;
+    std::vector<double> ns;
+    ns.reserve(kRoundTrips);
+    for (int i = 0; i < kWarmup + kRoundTrips; ++i) {
+        std::memcpy(payload, &i, sizeof(i));
+        const auto start = std::chrono::steady_clock::now();
+        pingPub.send(zmq::buffer(kTopic, std::strlen(kTopic)), zmq::send_flags::sndmore);
+        pingPub.send(zmq::buffer(payload, sizeof(payload)), zmq::send_flags::none);
+        (void)sub.recv(topicIn, zmq::recv_flags::none);
+        (void)sub.recv(payloadIn, zmq::recv_flags::none);
+        const auto end = std::chrono::steady_clock::now();
+        if (i >= kWarmup) ns.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    echo.join();
+    pingPub.unbind(kTcpPing);
+    pongPub.unbind(kTcpPong);
+    return ns;
+}
+
+// One publish followed by one read on the same thread: the ring's own cost per hop.
+double shmHopCost() {
+    const std::string name = "/xalgo_bench_hop_" + std::to_string(getpid());
+    auto ring = ShmBroadcastRing::attach(name, ShmRingOptions{4096, 256});
+    if (!ring) return 0.0;
+    ShmBroadcastRing::Reader reader(*ring);
+    std::vector<char> buf(ring->maxMessageSize());
+    char payload[64] = {};
+    uint32_t topicLength = 0, payloadLength = 0;
+    constexpr int kHops = 1'000'000;
+    uint64_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kHops; ++i) {
+        payload[0] = static_cast<char>(i);
+        ring->publish(kTopic, {payload, sizeof(payload)});
+        reader.tryRead(buf.data(), topicLength, payloadLength);
+        checksum += static_cast<unsigned char>(buf[topicLength]);
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    ShmBroadcastRing::unlink(name);
+    return checksum == 0 ? 0.0 : ns / kHops;
+}
+
+void printRow(const char* name, Percentiles p) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::setprecision(0)
+              << std::setw(12) << p.p50 << std::setw(12) << p.p99 << std::setw(12) << p.max << "\n";
+}
+
+} // namespace
+
+int main() {
+    std::vector<double> shm = shmRoundTrips();
+    std::vector<double> tcp = tcpRoundTrips();
+    const Percentiles shmRtt = summarise(shm);
+    const Percentiles tcpRtt = summarise(tcp);
+
+    std::cout << "round trip, " << kRoundTrips << " x 64-byte payload ("
+              << std::thread::hardware_concurrency() << " cores)\n" << std::fixed;
+    std::cout << std::left << std::setw(16) << "transport" << std::right << std::setw(12) << "p50 ns"
+              << std::setw(12) << "p99 ns" << std::setw(12) << "max ns" << "\n";
+    printRow("shm ring", shmRtt);
+    printRow("zmq tcp", tcpRtt);
+    std::cout << "one-way p50: shm " << shmRtt.p50 / 2 << " ns, tcp " << tcpRtt.p50 / 2 << " ns ("
+              << std::setprecision(1) << tcpRtt.p50 / shmRtt.p50 << "x)\n";
+    std::cout << "shm publish + read on one thread: " << std::setprecision(1) << shmHopCost() << " ns\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+// benchmark_triangle_execution.cpp
+//
+// End-to-end triangle latency (execute() entry to terminal state) for sequential
+// versus parallel leg dispatch, over pre-warmed simulated venue sessions with a
+// fixed per-leg round trip. Also times the reject-and-unwind path.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "core/execution/ExecutionManager.hpp"
+
+using namespace TradingSystem;
+
+namespace {
+
+struct Percentiles {
+    double p50Us, p99Us, maxUs;
+};
+
+Percentiles measure(DispatchMode mode, std::chrono::nanoseconds venueLatency, bool rejectMiddle, int triangles) {
+    SimulatedVenueSession first(SimulatedVenueBehaviour{venueLatency});
+    SimulatedVenueSession second(SimulatedVenueBehaviour{venueLatency, 1.0, rejectMiddle});
+    SimulatedVenueSession third(SimulatedVenueBehaviour{venueLatency});
+
+    ExecutionManager manager(mode);
+    manager.setLegs(TradeLeg(TradingSystem::internSymbol("EUR/USD"), 1.1234, 1'000'000, TradingSystem::OrderSide::BUY),
+                    TradeLeg(TradingSystem::internSymbol("GBP/USD"), 1.3100, 850'000, TradingSystem::OrderSide::SELL),
+                    TradeLeg(TradingSystem::internSymbol("EUR/GBP"), 0.8560, 1'000'000, TradingSystem::OrderSide::SELL));
+    manager.setSessions(&first, &second, &third);
+
+    const TradeState expected = rejectMiddle ? TradeState::UNWOUND : TradeState::COMPLETE;
+    std::vector<double> latencyUs;
+    latencyUs.reserve(static_cast<std::size_t>(triangles));
+    for (int i = 0; i < triangles + 100; ++i) {
+        const uint64_t t0 = TscClock::now();
+        manager.execute();
+        const uint64_t t1 = TscClock::now();
+        if (manager.getState() != expected) {
+            std::cerr << "unexpected terminal state " << static_cast<int>(manager.getState()) << "\n";
+            std::exit(EXIT_FAILURE);
+        }
+        if (i >= 100) latencyUs.push_back(TscClock::toNanos(t1 - t0) / 1e3);  // skip warm-up
+    }
+    std::sort(latencyUs.begin(), latencyUs.end());
+    return Percentiles{latencyUs[latencyUs.size() / 2],
+                       latencyUs[static_cast<std::size_t>(0.99 * static_cast<double>(latencyUs.size() - 1))],
+                       latencyUs.back()};
+}
+
+} // namespace
+
+int main() {
+    TscClock::calibrate();
+    constexpr int kTriangles = 20'000;
+
+    std::cout << std::left << std::setw(14) << "venue (us)" << std::setw(12) << "path" << std::setw(12) << "mode"
+              << std::right << std::setw(10) << "p50 (us)" << std::setw(10) << "p99 (us)"
+              << std::setw(12) << "max (us)" << "\n";
+
+    for (const int venueUs : {0, 10, 50}) {
+        for (const bool reject : {false, true}) {
+            for (const DispatchMode mode : {DispatchMode::SEQUENTIAL, DispatchMode::PARALLEL}) {
+                const Percentiles p = measure(mode, std::chrono::microseconds(venueUs), reject, kTriangles);
+                std::cout << std::left << std::setw(14) << venueUs << std::setw(12) << (reject ? "unwind" : "fill")
+                          << std::setw(12) << (mode == DispatchMode::PARALLEL ? "parallel" : "sequential")
+                          << std::right << std::fixed << std::setprecision(2)
+                          << std::setw(10) << p.p50Us << std::setw(10) << p.p99Us
+                          << std::setw(12) << p.maxUs << "\n";
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,190 @@
+// benchmark_zmq_receive.cpp
+//
+// Subscriber-side throughput and heap allocations per message over an inproc PUB/SUB
+// pair: the previous receive path (fresh frames, topic and payload copied into strings,
+// std::function called under a mutex) against the zero-copy path (reused frames, views
+// handed to an RCU-held handler), and the batched drain (everything already queued is
+// received non-blocking and handed over in one call). All handlers do the same trivial
+// work on the bytes.
+// Allocation counts cover operator new on every thread, so they include anything the
+// publisher or libzmq allocate that way; the difference between the rows is the receive path.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zmq.hpp>
+
+#include "core/messaging/ZmqMessage.hpp"
+
+using namespace hft::core::messaging;
+
+namespace {
+std::atomic<uint64_t> gAllocations{0};
+}
+
+// Release builds use -fno-exceptions, so exhaustion aborts instead of throwing.
+void* operator new(std::size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) std::abort();
+    return p;
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr const char* kEndpoint = "inproc://md";
+constexpr const char* kTopic = "MD.EURUSD";
+
+struct Result {
+    double messagesPerSec;
+    double allocationsPerMessage;
+};
+
+// Publishes `count` messages with a 64-byte payload, then a stop message.
+void publishAll(zmq::socket_t& pub, int count) {
+    char payload[64] = {};
+    for (int i = 0; i < count; ++i) {
+        std::snprintf(payload, sizeof(payload), "%d", i);
+        pub.send(zmq::buffer(kTopic, std::strlen(kTopic)), zmq::send_flags::sndmore);
+        pub.send(zmq::buffer(payload, sizeof(payload)), zmq::send_flags::none);
+    }
+    pub.send(zmq::buffer(kTopic, std::strlen(kTopic)), zmq::send_flags::sndmore);
+    pub.send(zmq::str_buffer("stop"), zmq::send_flags::none);
+}
+
+template <typename ReceiveLoop>
+Result run(zmq::context_t& context, int count, ReceiveLoop receiveLoop) {
+    zmq::socket_t pub(context, ZMQ_PUB);
+    pub.set(zmq::sockopt::sndhwm, 0);
+    pub.bind(kEndpoint);
+    zmq::socket_t sub(context, ZMQ_SUB);
+    sub.set(zmq::sockopt::rcvhwm, 0);
+    sub.set(zmq::sockopt::subscribe, "MD.");
+    sub.connect(kEndpoint);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));  // let the subscription propagate
+
+    std::thread publisher([&] { publishAll(pub, count); });
+    const uint64_t allocationsBefore = gAllocations.load(std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+    const int received = receiveLoop(sub);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t allocations = gAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+    publisher.join();
+    pub.unbind(kEndpoint);
+
+    return Result{received / seconds, static_cast<double>(allocations) / received};
+}
+
+} // namespace
+
+int main() {
+    constexpr int kMessages = 1'000'000;
+    zmq::context_t context(1);
+    std::atomic<uint64_t> checksum{0};
+
+    // Previous path: fresh frames, two string copies and a mutex per message.
+    std::mutex handlerMutex;
+    std::function<void(const std::string&, const std::string&)> copyingHandler =
+        [&](const std::string& topic, const std::string& payload) {
+            checksum.fetch_add(topic.size() + static_cast<unsigned char>(payload[0]), std::memory_order_relaxed);
+        };
+    const Result copying = run(context, kMessages, [&](zmq::socket_t& sub) {
+        int received = 0;
+        for (;;) {
+            zmq::message_t t, p;
+            if (!sub.recv(t, zmq::recv_flags::none)) continue;
+            (void)sub.recv(p, zmq::recv_flags::none);
+            std::string topic(static_cast<char*>(t.data()), t.size());
+            std::string payload(static_cast<char*>(p.data()), p.size());
+            if (payload == "stop") return received;
+            ++received;
+            std::lock_guard<std::mutex> lk(handlerMutex);
+            copyingHandler(topic, payload);
+        }
+    });
+
+    // Zero-copy path: reused frames, views, wait-free handler lookup.
+    MessageDispatcher dispatcher;
+    bool stopped = false;
+    dispatcher.setHandler([&](ZmqMessage& message) {
+        const std::string_view payload = message.payload();
+        if (payload == "stop") {
+            stopped = true;
+            return;
+        }
+        checksum.fetch_add(message.topic().size() + static_cast<unsigned char>(payload[0]), std::memory_order_relaxed);
+    });
+    const Result zeroCopy = run(context, kMessages, [&](zmq::socket_t& sub) {
+        int received = 0;
+        ZmqMessage message;
+        while (!stopped) {
+            if (!sub.recv(message.topicFrame, zmq::recv_flags::none)) continue;
+            (void)sub.recv(message.payloadFrame, zmq::recv_flags::none);
+            dispatcher.dispatch(message);
+            received += stopped ? 0 : 1;
+        }
+        return received;
+    });
+
+    // Batched path: block for one message, drain the rest non-blocking, one handler call.
+    MessageDispatcher batchDispatcher;
+    bool batchStopped = false;
+    uint64_t batches = 0;
+    batchDispatcher.setBatchHandler([&](const MessageBatch& batch) {
+        ++batches;
+        for (const ZmqMessage& message : batch) {
+            const std::string_view payload = message.payload();
+            if (payload == "stop") {
+                batchStopped = true;
+                return;
+            }
+            checksum.fetch_add(message.topic().size() + static_cast<unsigned char>(payload[0]),
+                               std::memory_order_relaxed);
+        }
+    });
+    const Result batched = run(context, kMessages, [&](zmq::socket_t& sub) {
+        int received = 0;
+        std::vector<ZmqMessage> batch(256);
+        while (!batchStopped) {
+            if (!sub.recv(batch[0].topicFrame, zmq::recv_flags::none)) continue;
+            (void)sub.recv(batch[0].payloadFrame, zmq::recv_flags::none);
+            std::size_t count = 1;
+            while (count < batch.size() && sub.recv(batch[count].topicFrame, zmq::recv_flags::dontwait)) {
+                (void)sub.recv(batch[count].payloadFrame, zmq::recv_flags::none);
+                ++count;
+            }
+            batchDispatcher.dispatch(MessageBatch(batch.data(), count));
+            received += static_cast<int>(count) - (batchStopped ? 1 : 0);
+        }
+        return received;
+    });
+
+    std::cout << std::left << std::setw(12) << "path" << std::right << std::setw(16) << "msgs/s"
+              << std::setw(16) << "allocs/msg" << "\n" << std::fixed;
+    std::cout << std::left << std::setw(12) << "copying" << std::right << std::setprecision(0)
+              << std::setw(16) << copying.messagesPerSec << std::setprecision(2) << std::setw(16)
+              << copying.allocationsPerMessage << "\n";
+    std::cout << std::left << std::setw(12) << "zero-copy" << std::right << std::setprecision(0)
+              << std::setw(16) << zeroCopy.messagesPerSec << std::setprecision(2) << std::setw(16)
+              << zeroCopy.allocationsPerMessage << "\n";
+    std::cout << std::left << std::setw(12) << "batched" << std::right << std::setprecision(0)
+              << std::setw(16) << batched.messagesPerSec << std::setprecision(2) << std::setw(16)
+              << batched.allocationsPerMessage << "  (" << static_cast<double>(kMessages) / batches
+              << " msgs/batch)\n";
+    std::cout << "speedup vs copying: zero-copy " << std::setprecision(2)
+              << zeroCopy.messagesPerSec / copying.messagesPerSec << "x, batched "
+              << batched.messagesPerSec / copying.messagesPerSec << "x (checksum " << checksum.load() << ")\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,21 @@
+// log_decode.cpp
+//
+// Render a binary log written by Logger (Options::binary) as text lines.
+//   log_decode trading.xlog > trading.log
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "utils/Logger.hpp"
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <binary log>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!TradingSystem::Logger::decode(argv[1], stdout)) {
+        std::fprintf(stderr, "%s: not a binary log, or truncated\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
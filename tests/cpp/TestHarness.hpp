@@ -0,0 +1,80 @@
+// TestHarness.hpp
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+/// @brief Minimal self-registering test runner for the unit_tests binary.
+/// Tests are plain functions declared with TEST_CASE; CHECK records a failure and
+/// keeps going (assert() is compiled out in Release builds).
+namespace TestHarness {
+
+struct TestCase {
+    const char* name;
+    void (*fn)();
+};
+
+inline std::vector<TestCase>& registry() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int& failureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, void (*fn)()) { registry().push_back({name, fn}); }
+};
+
+/// @brief Number of global operator new calls made so far on this thread (defined in test_main.cpp).
+uint64_t allocationCount() noexcept;
+
+/// @brief Number of global operator new calls made so far by every thread.
+uint64_t totalAllocationCount() noexcept;
+
+/// @brief Fails the running test if any thread allocates while the scope is alive.
+/// Covers the worker threads a hot path hands off to, not just the caller.
+class NoAllocationScope {
+public:
+    NoAllocationScope(const char* file, int line) noexcept
+        : file_(file), line_(line), start_(totalAllocationCount()) {}
+    NoAllocationScope(const NoAllocationScope&) = delete;
+    NoAllocationScope& operator=(const NoAllocationScope&) = delete;
+    ~NoAllocationScope() {
+        const uint64_t allocations = totalAllocationCount() - start_;
+        if (allocations != 0) {
+            ++failureCount();
+            std::cerr << file_ << ":" << line_ << ": " << allocations << " heap allocation(s) in a no-allocation scope\n";
+        }
+    }
+
+private:
+    const char* file_;
+    int line_;
+    uint64_t start_;
+};
+
+} // namespace TestHarness
+
+#define TEST_CASE(name)                                                   \
+    static void name();                                                   \
+    static const TestHarness::Registrar name##_registrar(#name, &name);   \
+    static void name()
+
+#define TEST_HARNESS_CONCAT_(a, b) a##b
+#define TEST_HARNESS_CONCAT(a, b) TEST_HARNESS_CONCAT_(a, b)
+
+/// @brief Fail the test if anything allocates from here to the end of the enclosing block.
+#define EXPECT_NO_ALLOCATIONS() \
+    const TestHarness::NoAllocationScope TEST_HARNESS_CONCAT(noAllocationScope_, __LINE__)(__FILE__, __LINE__)
+
+#define CHECK(cond)                                                                   \
+    do {                                                                              \
+        if (!(cond)) {                                                                \
+            ++TestHarness::failureCount();                                            \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #cond "\n"; \
+        }                                                                             \
+    } while (0)
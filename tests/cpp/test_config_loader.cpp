@@ -0,0 +1,127 @@
+// test_config_loader.cpp
+#include "TestHarness.hpp"
+#include "utils/ConfigLoader.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace TradingSystem;
+
+namespace {
+
+std::string tempConfig(const char* suffix) {
+    return "/tmp/xalgo_config_test_" + std::to_string(getpid()) + suffix;
+}
+
+void writeFile(const std::string& path, const std::string& text) {
+    std::ofstream(path, std::ios::trunc) << text;
+}
+
+} // namespace
+
+TEST_CASE(configParsesJsonAndYamlIntoDottedKeys) {
+    std::string error;
+    const auto json = ConfigLoader::parse(R"({
+        "pub_endpoint": "shm://xalgo_bus",
+        "shm_ring": { "slots": 1024, "slot_size": 256 },
+        "socket_options": { "linger": 0, "rcvtimeo": 1e3 },
+        "venues": ["LMAX", "EBS\u00e9"],
+        "enabled": true, "comment": null, "slots": 1, "slots": 2
+    })", "zmq.json", &error);
+    CHECK(json.has_value() && error.empty());
+    CHECK(json->getString("pub_endpoint", "") == "shm://xalgo_bus");
+    CHECK(json->getInt("shm_ring.slot_size", 0) == 256);
+    CHECK(json->getInt("socket_options.rcvtimeo", 0) == 1000);
+    CHECK(json->getString("venues.1", "") == "EBS\xc3\xa9");
+    CHECK(json->getBool("enabled", false) && !json->contains("comment"));
+    CHECK(json->getInt("slots", 0) == 2);                          // last duplicate wins
+    CHECK(json->getInt("pub_endpoint", -1) == -1);                 // wrong type: default
+
+    CHECK(!ConfigLoader::parse(R"({"a": 1,})", "bad.json", &error));
+    CHECK(error.find("line 1") != std::string::npos);
+    CHECK(!ConfigLoader::parse("{\"a\": [1, 2}", "bad.json", &error));
+
+    const auto yaml = ConfigLoader::parse(R"(# comment
+risk:
+  capital: 5e7
+  max_drawdown: 0.05   # fraction
+venues:
+- LMAX
+- "EBS # main"
+heartbeatIntervalMs: 250
+empty:
+)", "config.yaml", &error);
+    CHECK(yaml.has_value());
+    CHECK(yaml->getDouble("risk.capital", 0) == 5e7);
+    CHECK(yaml->getDouble("risk.max_drawdown", 0) == 0.05);
+    CHECK(yaml->getString("venues.1", "") == "EBS # main");
+    CHECK(yaml->getInt("heartbeatIntervalMs", 0) == 250);
+    CHECK(yaml->contains("empty") && yaml->size() == 6);
+    CHECK(!ConfigLoader::parse("a:\n  b: 1\n c: 2\n", "bad.yaml", &error));
+    CHECK(!ConfigLoader::parse("a: [1, 2]\n", "bad.yaml", &error));
+
+    // Typed sections resolve once; absent or out-of-range keys keep the defaults.
+    const ConfigSnapshot snap = ConfigSnapshot::fromValues(*json);
+    CHECK(snap.messaging.shmSlots == 1024 && snap.messaging.receiveTimeoutMs == 1000);
+    CHECK(snap.messaging.reconnectIntervalMs == MessagingConfig{}.reconnectIntervalMs);
+    CHECK(ConfigSnapshot::fromValues(*ConfigLoader::parse(R"({"shm_ring": {"slots": -4}})", "x.json", &error))
+              .messaging.shmSlots == MessagingConfig{}.shmSlots);
+}
+
+TEST_CASE(configLoaderKeepsLastGoodSnapshotOnBadReload) {
+    const std::string path = tempConfig(".json");
+    writeFile(path, R"({"reconnectIntervalMs": 250, "risk": {"max_orders_per_second": 500}})");
+
+    ConfigLoader loader(path);
+    CHECK(loader.ok());
+    CHECK(loader.getInt("reconnectIntervalMs", 1000) == 250);
+    CHECK(loader.snapshot()->risk.maxOrdersPerSecond == 500 && loader.snapshot()->version == 1);
+
+    writeFile(path, R"({"reconnectIntervalMs": )");
+    CHECK(!loader.reload() && !loader.ok() && !loader.lastError().empty());
+    CHECK(loader.snapshot()->messaging.reconnectIntervalMs == 250 && loader.snapshot()->version == 1);
+
+    ConfigLoader missing(path + ".absent");
+    CHECK(!missing.ok() && missing.snapshot()->messaging.reconnectIntervalMs == 1000);
+    std::remove(path.c_str());
+}
+
+TEST_CASE(configWatcherPublishesWhileReadersRun) {
+    const std::string path = tempConfig(".yaml");
+    writeFile(path, "risk:\n  max_order_notional: 1000\n");
+    ConfigLoader loader(path);
+
+    std::atomic<double> applied{0.0};
+    loader.onReload([&](const ConfigSnapshot& cfg) { applied.store(cfg.risk.maxOrderNotional); });
+
+    // A reader never sees a snapshot whose fields disagree with each other.
+    std::atomic<bool> stop{false};
+    std::atomic<bool> torn{false};
+    std::thread reader([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            {
+                const ConfigLoader::Snapshot s = loader.snapshot();
+                if (s->risk.maxOrderNotional != s->values.getDouble("risk.max_order_notional", -1)) torn = true;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    CHECK(loader.startWatcher(std::chrono::milliseconds(5)));
+    CHECK(!loader.startWatcher(std::chrono::milliseconds(5)));
+    writeFile(path, "risk:\n  max_order_notional: 2500\n  max_drawdown: 0.01\n");
+    for (int i = 0; i < 400 && applied.load() != 2500.0; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    loader.stopWatcher();
+    stop = true;
+    reader.join();
+
+    CHECK(applied.load() == 2500.0 && !torn.load());
+    CHECK(loader.snapshot()->risk.maxDrawdown == 0.01 && loader.snapshot()->version == 2);
+    std::remove(path.c_str());
+}
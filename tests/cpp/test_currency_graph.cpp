@@ -0,0 +1,148 @@
+// test_currency_graph.cpp
+#include "TestHarness.hpp"
+#include "core/models/CurrencyGraph.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace TradingSystem;
+
+namespace {
+
+std::string pairName(std::size_t base, std::size_t quote) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "C%zu/C%zu", base, quote);
+    return buf;
+}
+
+/// @brief Brute-force count of profitable simple cycles of length 3 (and 4), each counted once.
+std::size_t countCyclesBruteForce(const CurrencyGraph& g, std::size_t maxLength, double threshold) {
+    const auto n = static_cast<CurrencyGraph::CurrencyId>(g.currencyCount());
+    std::size_t found = 0;
+    for (CurrencyGraph::CurrencyId a = 0; a < n; ++a) {
+        // Only count cycles whose smallest id is `a`, in each direction separately.
+        for (CurrencyGraph::CurrencyId b = a + 1; b < n; ++b) {
+            for (CurrencyGraph::CurrencyId c = a + 1; c < n; ++c) {
+                if (c == b) continue;
+                if (g.logRate(a, b) + g.logRate(b, c) + g.logRate(c, a) > threshold) ++found;
+                if (maxLength < 4) continue;
+                for (CurrencyGraph::CurrencyId d = a + 1; d < n; ++d) {
+                    if (d == b || d == c) continue;
+                    if (g.logRate(a, b) + g.logRate(b, c) + g.logRate(c, d) + g.logRate(d, a) > threshold) ++found;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+} // namespace
+
+TEST_CASE(currencyGraphFindsMispricedTriangle) {
+    CurrencyGraph graph(8);
+    const auto eurUsd = graph.addPair("EUR/USD");
+    const auto gbpUsd = graph.addPair("GBP/USD");
+    const auto eurGbp = graph.addPair("EUR/GBP");
+    CHECK(graph.currencyCount() == 3);
+    CHECK(graph.addPair("USDJPY") != CurrencyGraph::kInvalidPair);
+    CHECK(graph.currencyCount() == 4);
+    CHECK(graph.addPair("bogus") == CurrencyGraph::kInvalidPair);
+
+    // Consistent prices: 1.12 / 1.31 = 0.85496.
+    graph.onQuote(eurUsd, 1.11999, 1.12001);
+    graph.onQuote(gbpUsd, 1.30999, 1.31001);
+    CHECK(graph.onQuote(eurGbp, 0.85490, 0.85500) == 0);
+
+    // EUR/GBP bid too rich: sell EUR for GBP, GBP for USD, USD back into EUR.
+    CHECK(graph.onQuote(eurGbp, 0.85600, 0.85610) == 1);
+    const ArbitrageOpportunity& best = graph.opportunities().front();
+    CHECK(best.length == 3);
+    CHECK(graph.currencyCode(best.legs[0].from) == "EUR");
+    CHECK(graph.currencyCode(best.legs[1].from) == "GBP");
+    CHECK(graph.currencyCode(best.legs[2].from) == "USD");
+    CHECK(std::abs(best.logProfit - (std::log(0.85600) + std::log(1.30999) - std::log(1.12001))) < 1e-12);
+
+    std::array<TradeLeg, ArbitrageOpportunity::kMaxLegs> legs;
+    CHECK(graph.toTradeLegs(best, 1'000'000.0, legs) == 3);
+    CHECK(symbolName(legs[0].symbol) == "EUR/GBP" && legs[0].side == OrderSide::SELL && legs[0].quantity == 1'000'000.0);
+    CHECK(symbolName(legs[1].symbol) == "GBP/USD" && legs[1].side == OrderSide::SELL && std::abs(legs[1].quantity - 856'000.0) < 1e-6);
+    CHECK(symbolName(legs[2].symbol) == "EUR/USD" && legs[2].side == OrderSide::BUY && std::abs(legs[2].price - 1.12001) < 1e-12);
+    // Ending EUR quantity reflects the gross profit.
+    CHECK(std::abs(legs[2].quantity / 1'000'000.0 - std::exp(best.logProfit)) < 1e-12);
+
+    // Re-pricing the edge removes the stale cycle.
+    CHECK(graph.onQuote(eurGbp, 0.85490, 0.85500) == 0);
+    CHECK(graph.opportunities().empty());
+}
+
+TEST_CASE(currencyGraphIncrementalMatchesBruteForce) {
+    constexpr std::size_t kCurrencies = 12;
+    for (const std::size_t maxLength : {3u, 4u}) {
+        const double threshold = 2e-4;
+        CurrencyGraph graph(kCurrencies, maxLength, threshold, 100'000);
+        std::vector<double> fair(kCurrencies);
+        std::vector<CurrencyGraph::PairId> pairs;
+        std::vector<std::pair<std::size_t, std::size_t>> legs;
+        for (std::size_t i = 0; i < kCurrencies; ++i) {
+            fair[i] = 0.5 + 0.1 * static_cast<double>(i);
+            for (std::size_t j = 0; j < i; ++j) {
+                pairs.push_back(graph.addPair(pairName(i, j)));
+                legs.emplace_back(i, j);
+            }
+        }
+
+        std::mt19937_64 rng(11 + maxLength);
+        std::normal_distribution<double> noise(0.0, 2e-4);
+        std::uniform_int_distribution<std::size_t> pick(0, pairs.size() - 1);
+        for (int i = 0; i < 5'000; ++i) {
+            const std::size_t p = pick(rng);
+            const double mid = fair[legs[p].first] / fair[legs[p].second] * (1.0 + noise(rng));
+            graph.onQuote(pairs[p], mid * (1.0 - 2e-5), mid * (1.0 + 2e-5));
+        }
+
+        CHECK(graph.opportunities().size() == countCyclesBruteForce(graph, maxLength, threshold));
+        CHECK(!graph.opportunities().empty());
+        bool ranked = true;
+        for (std::size_t i = 1; i < graph.opportunities().size(); ++i) {
+            ranked = ranked && graph.opportunities()[i - 1].logProfit >= graph.opportunities()[i].logProfit;
+        }
+        CHECK(ranked);
+    }
+}
+
+TEST_CASE(currencyGraphDoesNotTranslateFourCycles) {
+    // A ring with no chords: the only cycles are the 4-cycle and its reverse.
+    CurrencyGraph graph(4, 4);
+    const CurrencyGraph::PairId ring[4] = {graph.addPair("C0/C1"), graph.addPair("C1/C2"),
+                                           graph.addPair("C2/C3"), graph.addPair("C3/C0")};
+    for (const CurrencyGraph::PairId p : ring) graph.onQuote(p, 0.99990, 1.00010);
+    CHECK(graph.opportunities().empty());
+
+    CHECK(graph.onQuote(ring[3], 1.00100, 1.00110) == 1);
+    const ArbitrageOpportunity& cycle = graph.opportunities().front();
+    CHECK(cycle.length == 4);
+
+    std::array<TradeLeg, ArbitrageOpportunity::kMaxLegs> legs;
+    legs[0].quantity = -1.0;
+    CHECK(graph.toTradeLegs(cycle, 1'000'000.0, legs) == 0);
+    CHECK(legs[0].quantity == -1.0);                    // nothing written
+}
+
+TEST_CASE(currencyGraphQuoteDoesNotAllocate) {
+    CurrencyGraph graph(16, 4, 0.0, 64);
+    std::vector<CurrencyGraph::PairId> pairs;
+    for (std::size_t i = 0; i < 16; ++i) {
+        for (std::size_t j = 0; j < i; ++j) pairs.push_back(graph.addPair(pairName(i, j)));
+    }
+
+    const uint64_t before = TestHarness::allocationCount();
+    for (int i = 0; i < 50'000; ++i) {
+        const double mid = 1.0 + ((i * 7919) % 101) * 1e-4;
+        graph.onQuote(pairs[static_cast<std::size_t>(i) % pairs.size()], mid, mid + 1e-5);
+    }
+    CHECK(TestHarness::allocationCount() == before);
+    CHECK(graph.opportunities().size() <= 64);
+}
@@ -0,0 +1,215 @@
+// test_execution_manager.cpp
+#include "TestHarness.hpp"
+#include "core/execution/ExecutionManager.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using Behaviour = SimulatedVenueSession::Behaviour;
+
+void setTriangle(ExecutionManager& manager) {
+    manager.setLegs(TradeLeg(TradingSystem::internSymbol("EUR/USD"), 1.1234, 1'000'000, TradingSystem::OrderSide::BUY),
+                    TradeLeg(TradingSystem::internSymbol("GBP/USD"), 1.3100, 850'000, TradingSystem::OrderSide::SELL),
+                    TradeLeg(TradingSystem::internSymbol("EUR/GBP"), 0.8560, 1'000'000, TradingSystem::OrderSide::SELL));
+}
+
+} // namespace
+
+TEST_CASE(parallelDispatchCompletesWhenAllLegsFill) {
+    SimulatedVenueSession a(Behaviour{std::chrono::microseconds(5)});
+    SimulatedVenueSession b(Behaviour{std::chrono::microseconds(5)});
+    SimulatedVenueSession c(Behaviour{std::chrono::microseconds(5)});
+    ExecutionManager manager(DispatchMode::PARALLEL);
+    setTriangle(manager);
+    manager.setSessions(&a, &b, &c);
+
+    for (int i = 0; i < 100; ++i) {
+        manager.execute();
+        CHECK(manager.getState() == TradeState::COMPLETE);
+    }
+    CHECK(manager.report(1).outcome == LegOutcome::FILLED);
+    CHECK(manager.report(1).filledQuantity == 850'000);
+}
+
+TEST_CASE(parallelDispatchUnwindsFilledLegsOnReject) {
+    SimulatedVenueSession good(Behaviour{std::chrono::microseconds(1)});
+    SimulatedVenueSession bad(Behaviour{std::chrono::microseconds(1), 1.0, true});
+    ExecutionManager manager(DispatchMode::PARALLEL);
+    setTriangle(manager);
+    manager.setSessions(&good, &bad, &good);
+
+    manager.execute();
+    // The unwind of leg 2 goes to the rejecting session only if leg 2 filled, which it did not.
+    CHECK(manager.getState() == TradeState::UNWOUND);
+    CHECK(manager.report(1).outcome == LegOutcome::REJECTED);
+    CHECK(manager.report(3).outcome == LegOutcome::FILLED);
+    CHECK(manager.report(3).filledQuantity == 1'000'000);
+    CHECK(manager.report(4).outcome == LegOutcome::PENDING);
+    CHECK(manager.report(5).outcome == LegOutcome::FILLED);
+}
+
+TEST_CASE(partialFillTriggersUnwindOfFilledQuantity) {
+    SimulatedVenueSession good(Behaviour{std::chrono::microseconds(1)});
+    SimulatedVenueSession partial(Behaviour{std::chrono::microseconds(1), 0.4, false});
+    ExecutionManager manager(DispatchMode::PARALLEL);
+    setTriangle(manager);
+    manager.setSessions(&good, &good, &partial);
+
+    manager.execute();
+    // The partial session also partially fills its own unwind, which leaves residual risk.
+    CHECK(manager.getState() == TradeState::ERROR);
+    CHECK(manager.report(2).outcome == LegOutcome::PARTIAL);
+    CHECK(manager.report(3).outcome == LegOutcome::FILLED);
+    CHECK(manager.report(4).outcome == LegOutcome::FILLED);
+    CHECK(manager.report(5).outcome == LegOutcome::PARTIAL);
+}
+
+TEST_CASE(sequentialDispatchStopsAtFirstReject) {
+    SimulatedVenueSession good(Behaviour{std::chrono::microseconds(1)});
+    SimulatedVenueSession bad(Behaviour{std::chrono::microseconds(1), 1.0, true});
+    ExecutionManager manager(DispatchMode::SEQUENTIAL);
+    setTriangle(manager);
+    manager.setSessions(&good, &bad, &good);
+
+    manager.execute();
+    CHECK(manager.getState() == TradeState::UNWOUND);
+    CHECK(manager.report(2).outcome == LegOutcome::PENDING);  // never sent
+    CHECK(manager.report(3).outcome == LegOutcome::FILLED);
+}
+
+TEST_CASE(missingReportTimesOut) {
+    // Holds its report until told to deliver it, as a venue that answers very late.
+    struct HeldSession final : ILegSession {
+        ILegReportSink* sink = nullptr;
+        LegReport report;
+        bool submit(const TradeLeg& leg, uint8_t index, uint32_t execution, ILegReportSink& s) noexcept override {
+            sink = &s;
+            report = LegReport{index, LegOutcome::REJECTED, 0.0, leg.price, execution};
+            return true;
+        }
+        void deliver() noexcept {
+            if (sink != nullptr) sink->onLegReport(report);
+            sink = nullptr;
+        }
+    } held;
+    SimulatedVenueSession good(Behaviour{std::chrono::microseconds(1)});
+    ExecutionManager manager(DispatchMode::PARALLEL, std::chrono::milliseconds(5));
+    setTriangle(manager);
+    manager.setSessions(&good, &held, &good);
+
+    manager.execute();
+    CHECK(manager.getState() == TradeState::ERROR);
+    held.deliver();   // every accepted leg is reported eventually; the manager may now go
+}
+
+TEST_CASE(managerOutlivesReportsStillInFlight) {
+    struct LateSession final : ILegSession {
+        std::thread reporter;
+        std::atomic<bool> delivered{false};
+        bool submit(const TradeLeg& leg, uint8_t index, uint32_t execution, ILegReportSink& sink) noexcept override {
+            if (reporter.joinable()) return false;
+            const LegReport report{index, LegOutcome::FILLED, leg.quantity, leg.price, execution};
+            reporter = std::thread([this, report, &sink] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                sink.onLegReport(report);
+                delivered.store(true);
+            });
+            return true;
+        }
+    } late;
+    {
+        ExecutionManager manager(DispatchMode::SEQUENTIAL, std::chrono::milliseconds(5));
+        setTriangle(manager);
+        manager.setSessions(&late, &late, &late);
+        manager.execute();
+        CHECK(manager.getState() == TradeState::ERROR);
+        CHECK(!late.delivered.load());
+    }   // destroyed only once the late fill has been delivered (ASan flags it otherwise)
+    CHECK(late.delivered.load());
+    late.reporter.join();
+
+    // Legs a simulated session still has queued are reported when it shuts down.
+    ExecutionManager manager(DispatchMode::PARALLEL, std::chrono::milliseconds(1));
+    setTriangle(manager);
+    {
+        SimulatedVenueSession slow(Behaviour{std::chrono::milliseconds(200)});
+        manager.setSessions(&slow, &slow, &slow);
+        manager.execute();
+        CHECK(manager.getState() == TradeState::ERROR);
+    }
+}
+
+TEST_CASE(reportAfterTimeoutIsNotAppliedToTheNextTrade) {
+    // Fills every leg, but only 250ms after it was sent: well past the manager's timeout.
+    struct LateSession final : ILegSession {
+        std::thread reporter;
+        std::atomic<bool> delivered{false};
+        bool submit(const TradeLeg& leg, uint8_t index, uint32_t execution, ILegReportSink& sink) noexcept override {
+            if (reporter.joinable()) return false;
+            const LegReport report{index, LegOutcome::FILLED, leg.quantity, leg.price, execution};
+            reporter = std::thread([this, report, &sink] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+                sink.onLegReport(report);
+                delivered.store(true);
+            });
+            return true;
+        }
+    } late;
+    // Rejects, but only once the late fill has reached the manager.
+    struct GatedRejectSession final : ILegSession {
+        std::atomic<bool>* gate = nullptr;
+        std::thread reporter;
+        bool submit(const TradeLeg& leg, uint8_t index, uint32_t execution, ILegReportSink& sink) noexcept override {
+            if (reporter.joinable()) return false;
+            const LegReport report{index, LegOutcome::REJECTED, 0.0, leg.price, execution};
+            reporter = std::thread([this, report, &sink] {
+                while (!gate->load()) std::this_thread::yield();
+                sink.onLegReport(report);
+            });
+            return true;
+        }
+    } gated;
+    gated.gate = &late.delivered;
+
+    ExecutionManager manager(DispatchMode::SEQUENTIAL, std::chrono::milliseconds(200));
+    setTriangle(manager);
+    manager.setSessions(&late, &late, &late);
+    manager.execute();
+    CHECK(manager.getState() == TradeState::ERROR);
+
+    // The first trade's fill for leg 0 lands while this one waits on its own leg 0.
+    manager.setSessions(&gated, &gated, &gated);
+    manager.execute();
+    CHECK(late.delivered.load());
+    CHECK(manager.report(0).outcome == LegOutcome::REJECTED);
+    CHECK(manager.report(0).filledQuantity == 0.0);
+    CHECK(manager.getState() == TradeState::UNWOUND);
+    late.reporter.join();
+    gated.reporter.join();
+}
+
+TEST_CASE(executionHotPathDoesNotAllocate) {
+    SimulatedVenueSession a(Behaviour{std::chrono::microseconds(1)});
+    SimulatedVenueSession b(Behaviour{std::chrono::microseconds(1)});
+    SimulatedVenueSession partial(Behaviour{std::chrono::microseconds(1), 0.5, false});
+    ExecutionManager parallel(DispatchMode::PARALLEL);
+    ExecutionManager unwinding(DispatchMode::SEQUENTIAL);
+    setTriangle(parallel);
+    setTriangle(unwinding);
+    parallel.setSessions(&a, &b, &a);
+    unwinding.setSessions(&a, &partial, &b);
+    parallel.execute();   // warm-up
+    unwinding.execute();
+
+    // Covers the venue session threads as well as this one.
+    EXPECT_NO_ALLOCATIONS();
+    for (int i = 0; i < 100; ++i) {
+        parallel.execute();
+        unwinding.execute();
+    }
+    CHECK(parallel.getState() == TradeState::COMPLETE);
+    CHECK(unwinding.getState() != TradeState::COMPLETE);
+}
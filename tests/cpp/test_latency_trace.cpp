@@ -0,0 +1,95 @@
+// test_latency_trace.cpp
+#include "TestHarness.hpp"
+#include "core/models/Order.hpp"
+#include "core/models/TickEngine.hpp"
+#include "core/router/SmartOrderRouter.hpp"
+#include "utils/LatencyTracer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace TradingSystem;
+
+TEST_CASE(traceContextStampsStagesAsOffsetsFromReceive) {
+    TraceContext untraced;
+    untraced.mark(TraceStage::Router, 500);
+    untraced.mark(TraceStage::VenueSend);
+    CHECK(!untraced.reached(TraceStage::VenueSend));
+    CHECK(!untraced.active() && !untraced.reached(TraceStage::Router));
+
+    TraceContext trace = TraceContext::begin(1'000);
+    CHECK(trace.active() && trace.reached(TraceStage::Receive));
+    trace.mark(TraceStage::TickEngine, 1'100);
+    trace.mark(TraceStage::RiskCheck, 1'350);                   // Signal skipped
+    trace.mark(TraceStage::Router, 900);                        // clock behind origin: still "reached"
+    trace.mark(TraceStage::VenueSend, 1'000 + (uint64_t{1} << 40));
+    CHECK(trace.sinceReceive(TraceStage::TickEngine) == 100);
+    CHECK(!trace.reached(TraceStage::Signal));
+    CHECK(trace.sinceReceive(TraceStage::RiskCheck) == 350);
+    CHECK(trace.sinceReceive(TraceStage::Router) == 1);
+    CHECK(trace.sinceReceive(TraceStage::VenueSend) == UINT32_MAX);
+
+    Metrics metrics;
+    LatencyTracer tracer(metrics, "t2t");
+    CHECK(&tracer.stage(TraceStage::Signal) == &metrics.histogram("t2t.signal"));
+    tracer.record(untraced);
+    tracer.record(trace);
+    CHECK(tracer.stage(TraceStage::TickEngine).count() == 1);
+    CHECK(tracer.stage(TraceStage::Signal).count() == 0);      // skipped stages record nothing
+    CHECK(tracer.stage(TraceStage::RiskCheck).count() == 1);
+    CHECK(tracer.total().count() == 1);
+    CHECK(tracer.report().find("venue_send") != std::string::npos);
+
+    // Orders stay trivially copyable with the trace on board.
+    Order order(1, internSymbol("EUR/USD"), 1.1, 1e6, OrderSide::BUY, OrderType::MARKET);
+    order.setTrace(trace);
+    const Order copy = order;
+    CHECK(copy.getTrace().sinceReceive(TraceStage::RiskCheck) == 350);
+}
+
+TEST_CASE(traceFollowsQuoteThroughTickEngineAndRouter) {
+    Metrics metrics;
+    LatencyTracer tracer(metrics);
+    std::atomic<uint32_t> tracedSends{0};
+    std::vector<Routing::Venue> venues;
+    venues.emplace_back("TraceA", 0.0, 0.99);
+    venues.emplace_back("TraceB", 0.0, 0.98);
+    Routing::SmartOrderRouter router(std::move(venues), nullptr,
+                                     [&](const Routing::Venue&, const Routing::VenueOrder& order) {
+                                         const TraceContext& t = order.trace;
+                                         if (t.reached(TraceStage::Router) && t.reached(TraceStage::VenueSend)
+                                             && t.sinceReceive(TraceStage::Router) <= t.sinceReceive(TraceStage::VenueSend)) {
+                                             tracedSends.fetch_add(1);
+                                         }
+                                         return true;
+                                     });
+    router.setTracer(&tracer);
+
+    const SymbolId eurUsd = internSymbol("EUR/USD");
+    uint32_t routed = 0;
+    TickEngine engine([&](const TickData& triangle, FxLeg) {
+        TraceContext trace = triangle.trace;
+        trace.mark(TraceStage::Signal);
+        trace.mark(TraceStage::RiskCheck);
+        if (router.sendOrderAsync(Routing::Order{eurUsd, triangle.eurUsd, 1e6, true, trace}) != 0) ++routed;
+    });
+
+    // Priming quotes are untraced; an untraced order still routes but records nothing.
+    engine.onQuote(FxLeg::EURUSD, 1.1200, 1.1202);
+    engine.onQuote(FxLeg::GBPUSD, 1.3100, 1.3102);
+    engine.onQuote(FxLeg::EURGBP, 0.8600, 0.8602);
+    constexpr int kQuotes = 200;
+    for (int i = 1; i <= kQuotes; ++i) {
+        engine.onQuote(FxLeg::EURUSD, 1.1200 + i * 1e-5, 1.1202 + i * 1e-5, 0, TraceContext::begin());
+    }
+    router.waitIdle();
+
+    CHECK(routed == kQuotes + 1);
+    CHECK(tracedSends.load() == 2u * kQuotes);
+    for (std::size_t s = 1; s < kTraceStageCount; ++s) {
+        CHECK(tracer.stage(static_cast<TraceStage>(s)).count() == 2u * kQuotes);
+    }
+    CHECK(tracer.total().count() == 2u * kQuotes);
+    CHECK(metrics.histogram("tick_to_trade.total").count() == 2u * kQuotes);
+}
@@ -0,0 +1,144 @@
+// test_logger.cpp
+#include "TestHarness.hpp"
+#include "utils/Logger.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace TradingSystem;
+
+namespace {
+
+std::string tempPath(const char* tag) {
+    return "/tmp/xalgo_log_test_" + std::string(tag) + "_" + std::to_string(getpid());
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+} // namespace
+
+TEST_CASE(loggerFormatsArgumentsOffTheCallingThread) {
+    const std::string path = tempPath("text") + ".log";
+    std::remove(path.c_str());
+    {
+        Logger::Options options;
+        options.path = path;
+        Logger logger(options);
+        const std::string topic = "MD.EURUSD";
+        const std::string_view venue = "LMAX";
+        logger.info("Executed {} on {} at {} for {}", std::string("buy"), "EUR/USD", 1.1234, 1'000'000);
+        logger.warn("Topic '{}' via {} lagged {} us (ok={}, ch={})", topic, venue, uint64_t{250}, false, 'x');
+        logger.debug("filtered out {}", 1);
+        logger.error("only {} of {} args", 1);
+        logger.flush();
+
+        const std::string text = readFile(path);
+        CHECK(text.find("INFO  [T1] Executed buy on EUR/USD at 1.1234 for 1000000\n") != std::string::npos);
+        CHECK(text.find("WARN  [T1] Topic 'MD.EURUSD' via LMAX lagged 250 us (ok=false, ch=x)\n") != std::string::npos);
+        CHECK(text.find("filtered out") == std::string::npos);
+        CHECK(text.find("ERROR [T1] only 1 of {} args\n") != std::string::npos);
+        CHECK(logger.dropped() == 0);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE(loggerCallsDoNotAllocateAndFullRingsDrop) {
+    Logger::Options options;
+    options.path = tempPath("drop") + ".log";
+    options.ringBytes = 4096;
+    options.idleSleep = std::chrono::milliseconds(200);
+    Logger logger(options);
+    logger.info("warm {}", 0);   // registers this thread's ring
+    const std::string symbol = "GBP/USD";
+    {
+        EXPECT_NO_ALLOCATIONS();
+        for (int i = 0; i < 500; ++i) logger.info("order {} on {} px {}", i, symbol, 1.31);
+    }
+    CHECK(logger.dropped() > 0);
+
+    // Several producers each get their own ring.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < 20; ++i) {
+                logger.info("thread {} message {}", t, i);
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    logger.flush();
+    CHECK(readFile(options.path).find("[T4] thread") != std::string::npos);
+    std::remove(options.path.c_str());
+}
+
+TEST_CASE(loggerKeepsOneRingPerThreadWhenAlternatingLoggers) {
+    Logger::Options options;
+    options.path = tempPath("alt_a") + ".log";
+    options.idleSleep = std::chrono::milliseconds(200);   // keep the writers parked during the scope
+    Logger a(options);
+    options.path = tempPath("alt_b") + ".log";
+    Logger b(options);
+
+    a.info("a {}", -1);
+    b.info("b {}", -1);
+    {
+        EXPECT_NO_ALLOCATIONS();
+        for (int i = 0; i < 200; ++i) {
+            a.info("a {}", i);
+            b.info("b {}", i);
+        }
+    }
+    CHECK(a.ringCount() == 1 && b.ringCount() == 1);
+
+    // Still one ring each, so the thread's lines come out in the order written.
+    a.flush();
+    const std::string text = readFile(tempPath("alt_a") + ".log");
+    std::size_t last = 0;
+    bool ordered = true;
+    for (int i = 0; i < 200 && ordered; ++i) {
+        const std::size_t at = text.find("a " + std::to_string(i) + "\n", last);
+        ordered = at != std::string::npos;
+        last = at;
+    }
+    CHECK(ordered);
+    std::remove((tempPath("alt_a") + ".log").c_str());
+    std::remove((tempPath("alt_b") + ".log").c_str());
+}
+
+TEST_CASE(binaryLogDecodesToTheSameLines) {
+    const std::string binary = tempPath("bin") + ".xlog";
+    const std::string text = tempPath("bin") + ".txt";
+    {
+        Logger::Options options;
+        options.path = binary;
+        options.binary = true;
+        Logger logger(options);
+        for (int i = 0; i < 3; ++i) logger.info("leg {} filled {} @ {}", i, 850'000.0, "0.8576");
+        logger.error("reject on {}", std::string("EUR/GBP"));
+    }   // destructor drains
+
+    std::FILE* out = std::fopen(text.c_str(), "w");
+    CHECK(out != nullptr);
+    if (!out) return;
+    CHECK(Logger::decode(binary, out));
+    std::fclose(out);
+    const std::string decoded = readFile(text);
+    CHECK(decoded.find("INFO  [T1] leg 2 filled 850000 @ 0.8576\n") != std::string::npos);
+    CHECK(decoded.find("ERROR [T1] reject on EUR/GBP\n") != std::string::npos);
+    CHECK(!Logger::decode(text, stdout));   // not a binary log
+    std::remove(binary.c_str());
+    std::remove(text.c_str());
+}
@@ -0,0 +1,76 @@
+// test_main.cpp
+#include "TestHarness.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local uint64_t tAllocations = 0;
+std::atomic<uint64_t> gAllocations{0};
+
+inline void countAllocation() noexcept {
+    ++tAllocations;
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+}
+
+// Count every heap allocation so tests can assert that hot paths stay allocation-free.
+// Release builds use -fno-exceptions, so exhaustion aborts instead of throwing.
+void* operator new(std::size_t size) {
+    countAllocation();
+    void* p = std::malloc(size ? size : 1);
+    if (!p) std::abort();
+    return p;
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+    countAllocation();
+    const std::size_t a = static_cast<std::size_t>(align);
+    void* p = std::aligned_alloc(a, (size + a - 1) / a * a);
+    if (!p) std::abort();
+    return p;
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    countAllocation();
+    return std::malloc(size ? size : 1);
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    countAllocation();
+    const std::size_t a = static_cast<std::size_t>(align);
+    return std::aligned_alloc(a, (size + a - 1) / a * a);
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new[](std::size_t size, std::align_val_t align) { return operator new(size, align); }
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t& tag) noexcept {
+    return operator new(size, align, tag);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+uint64_t TestHarness::allocationCount() noexcept { return tAllocations; }
+uint64_t TestHarness::totalAllocationCount() noexcept { return gAllocations.load(std::memory_order_relaxed); }
+
+int main() {
+    int failedTests = 0;
+    for (const auto& test : TestHarness::registry()) {
+        const int before = TestHarness::failureCount();
+        test.fn();
+        const bool passed = TestHarness::failureCount() == before;
+        if (!passed) ++failedTests;
+        std::cout << (passed ? "[PASS] " : "[FAIL] ") << test.name << "\n";
+    }
+    std::cout << TestHarness::registry().size() - failedTests << "/" << TestHarness::registry().size()
+              << " tests passed\n";
+    return failedTests == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,97 @@
+// test_metrics.cpp
+#include "TestHarness.hpp"
+#include "utils/Metrics.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace TradingSystem;
+
+TEST_CASE(metricsSumPerThreadCountersWithoutAllocating) {
+    Metrics metrics(4, 4);
+    const Counter sent = metrics.counter("zmq.pub.messages_sent");
+    CHECK(metrics.counter("zmq.pub.messages_sent").value() == 0);
+    const Gauge depth = metrics.gaugeHandle("queue.depth");
+
+    sent.add();   // first add on this thread creates its block
+    {
+        EXPECT_NO_ALLOCATIONS();
+        for (int i = 0; i < 999; ++i) sent.add();
+        depth.set(42.0);
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i) {
+                sent.add(2);
+                if ((i & 127) == 0) std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    CHECK(sent.value() == 1000 + 3 * 2000);   // exited threads' counts survive
+
+    metrics.increment("zmq.pub.messages_sent", 5);
+    metrics.gauge("queue.depth", 7.0);
+    CHECK(sent.value() == 7005 && depth.value() == 7.0);
+
+    // Past capacity: handles stay usable and the counts are discarded.
+    for (const char* name : {"a", "b", "c"}) metrics.counter(name).add();
+    const Counter overflow = metrics.counter("d");
+    overflow.add(100);
+    const MetricsSnapshot snap = metrics.snapshot();
+    CHECK(snap.counters.size() == 4 && snap.counters[0].second == 7005);
+    CHECK(snap.gauges.size() == 1 && snap.gauges[0].second == 7.0);
+}
+
+TEST_CASE(latencyHistogramReportsPercentilesWithinBucketError) {
+    LatencyHistogram h;
+    CHECK(h.percentile(0.5) == 0 && h.count() == 0);
+    for (uint64_t v = 1; v <= 10'000; ++v) h.record(v);
+    h.record(uint64_t{1} << 50);   // clamped
+
+    const LatencyHistogram::Summary s = h.summary();
+    CHECK(s.count == 10'001);
+    CHECK(s.p50 >= 5'000 && s.p50 <= 5'000 * 33 / 32);
+    CHECK(s.p99 >= 9'900 && s.p99 <= 9'900 * 33 / 32);
+    CHECK(s.max == LatencyHistogram::kMaxValue);
+
+    // Every value lands in a bucket whose bounds contain it.
+    for (uint64_t v : {0ull, 31ull, 32ull, 63ull, 64ull, 1000ull, 123'456'789ull}) {
+        const std::size_t b = LatencyHistogram::bucketOf(v);
+        CHECK(LatencyHistogram::upperBoundOf(b) >= v);
+        CHECK(b == 0 || LatencyHistogram::upperBoundOf(b - 1) < v);
+    }
+    CHECK(LatencyHistogram::bucketOf(LatencyHistogram::kMaxValue) == LatencyHistogram::kBucketCount - 1);
+}
+
+TEST_CASE(metricsExportWritesPrometheusText) {
+    Metrics metrics;
+    metrics.counter("risk.rejected.price_band").add(3);
+    metrics.gauge("zmq.md_sub.connected", 1.0);
+    LatencyHistogram& ttt = metrics.histogram("tick_to_trade");
+    CHECK(&metrics.histogram("tick_to_trade") == &ttt);
+    ttt.record(800);
+
+    const std::string path = "/tmp/xalgo_metrics_test_" + std::to_string(getpid()) + ".prom";
+    CHECK(metrics.startExporter(path, std::chrono::milliseconds(10)));
+    CHECK(!metrics.startExporter(path, std::chrono::milliseconds(10)));
+    metrics.stopExporter();   // writes a final snapshot
+
+    std::ifstream in(path);
+    std::stringstream text;
+    text << in.rdbuf();
+    const std::string s = text.str();
+    CHECK(s.find("risk_rejected_price_band 3\n") != std::string::npos);
+    CHECK(s.find("zmq_md_sub_connected 1\n") != std::string::npos);
+    CHECK(s.find("tick_to_trade{quantile=\"0.99\"} 800\n") != std::string::npos);
+    CHECK(s.find("tick_to_trade_count 1\n") != std::string::npos);
+    std::remove(path.c_str());
+}
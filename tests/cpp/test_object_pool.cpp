@@ -0,0 +1,68 @@
+// test_object_pool.cpp
+#include "TestHarness.hpp"
+#include "core/execution/ExecutionPools.hpp"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace TradingSystem;
+
+TEST_CASE(poolRecyclesSlotsWithoutAllocatingInSteadyState) {
+    ObjectPool<Order, 64> pool;
+    pool.reserve(100);
+    CHECK(pool.capacity() == 128 && pool.slabCount() == 2);
+
+    const SymbolId symbol = internSymbol("EUR/USD");
+    std::array<Order*, 128> live{};
+    {
+        EXPECT_NO_ALLOCATIONS();
+        for (int round = 0; round < 100; ++round) {
+            for (std::size_t i = 0; i < live.size(); ++i) {
+                live[i] = pool.acquire(i, symbol, 1.1, 1'000'000.0, OrderSide::BUY, OrderType::LIMIT);
+            }
+            CHECK(pool.outstanding() == live.size());
+            for (Order* order : live) ObjectPool<Order, 64>::release(order);
+        }
+    }
+    CHECK(pool.outstanding() == 0 && pool.slabCount() == 2);
+
+    // A recycled slot is the one released last.
+    Order* first = pool.acquire(1, symbol, 1.0, 1.0, OrderSide::SELL, OrderType::MARKET);
+    ObjectPool<Order, 64>::release(first);
+    Order* again = pool.acquire(2, symbol, 2.0, 2.0, OrderSide::BUY, OrderType::MARKET);
+    CHECK(again == first && again->getId() == 2 && again->getSide() == OrderSide::BUY);
+    ObjectPool<Order, 64>::release(again);
+}
+
+TEST_CASE(poolHandlesReleaseAndCrossThreadFreesReturnToOwner) {
+    ReportPool& pool = ReportPool::local();
+    pool.reserve(256);
+    const std::size_t capacity = pool.capacity();
+
+    {
+        ReportHandle report = pool.make(LegReport{1, LegOutcome::FILLED, 500.0, 1.2});
+        CHECK(report->filledQuantity == 500.0);
+        ReportHandle moved = std::move(report);
+        CHECK(!report && moved && pool.outstanding() == 1);
+    }
+    CHECK(pool.outstanding() == 0);
+
+    // Reports handed to another thread and released there go back to this pool.
+    std::vector<LegReport*> handedOff;
+    for (uint8_t i = 0; i < 200; ++i) handedOff.push_back(pool.acquire(LegReport{i}));
+    std::thread consumer([&] {
+        for (LegReport* report : handedOff) ReportPool::release(report);
+    });
+    consumer.join();
+    CHECK(pool.outstanding() == 0);
+
+    {
+        EXPECT_NO_ALLOCATIONS();
+        for (int i = 0; i < 200; ++i) {
+            ReportHandle report = pool.make(LegReport{});
+            CHECK(report);
+        }
+    }
+    CHECK(pool.capacity() == capacity);
+}
@@ -0,0 +1,174 @@
+// test_order_book.cpp
+#include "TestHarness.hpp"
+#include "core/models/OrderBook.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace XAlgo::Data;
+
+namespace {
+
+constexpr double kTick = 1e-5;
+constexpr double kReference = 1.1;
+constexpr uint32_t kLevels = 1u << 16;
+
+/// @brief Price of ladder index `i` in a book built with kReference and kLevels.
+double priceAt(const OrderBook& book, int32_t i) {
+    return book.toPrice(book.toTicks(kReference) - static_cast<PriceTicks>(kLevels / 2) + i);
+}
+
+bool near(double a, double b) { return std::abs(a - b) < 1e-9; }
+
+/// @brief Same finalizer as the book's order-id index, to build colliding probe chains.
+uint64_t homeSlot(uint64_t id, uint64_t mask) {
+    id ^= id >> 33;
+    id *= 0xff51afd7ed558ccdULL;
+    id ^= id >> 33;
+    return id & mask;
+}
+
+std::vector<PriceLevel> collect(BookView view) {
+    std::vector<PriceLevel> out;
+    for (const PriceLevel level : view) out.push_back(level);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE(orderBookL3AddModifyDelete) {
+    OrderBook book(kTick, kReference, kLevels, 64);
+    CHECK(book.addOrder(1, BookSide::BID, 1.09990, 1e6));
+    CHECK(book.addOrder(2, BookSide::BID, 1.09990, 2e6));
+    CHECK(book.addOrder(3, BookSide::BID, 1.09980, 5e6));
+    CHECK(book.addOrder(4, BookSide::ASK, 1.10010, 3e6));
+    CHECK(book.orderCount() == 4);
+    CHECK(near(book.bestBid().price, 1.09990) && book.bestBid().volume == 3e6);
+    CHECK(near(book.midPrice(), 1.10000));
+
+    CHECK(book.modifyOrder(1, 0.5e6));                  // reduce in place
+    CHECK(book.bestBid().volume == 2.5e6);
+    CHECK(book.modifyOrder(1, 4e6));                    // increase: re-queued, volume follows
+    CHECK(book.bestBid().volume == 6e6);
+
+    CHECK(book.deleteOrder(1) && book.deleteOrder(2));
+    CHECK(near(book.bestBid().price, 1.09980) && book.bestBid().volume == 5e6);
+    CHECK(book.modifyOrder(3, 0.0) && !book.hasBid());  // zero volume deletes
+    CHECK(book.orderCount() == 1);
+
+    const uint64_t rejected = book.rejectedUpdates();
+    CHECK(!book.addOrder(4, BookSide::ASK, 1.10020, 1e6));      // duplicate id
+    CHECK(!book.addOrder(5, BookSide::ASK, 2.0, 1e6));          // outside the window
+    CHECK(!book.addOrder(6, BookSide::ASK, 1.10020, 0.0));
+    CHECK(!book.deleteOrder(99) && !book.modifyOrder(99, 1.0));
+    // The index's empty-slot sentinel is a legal feed value and must not match a free slot.
+    CHECK(!book.addOrder(UINT64_MAX, BookSide::ASK, 1.10020, 1e6));
+    CHECK(!book.deleteOrder(UINT64_MAX) && !book.modifyOrder(UINT64_MAX, 1.0));
+    CHECK(book.orderCount() == 1);
+    CHECK(book.rejectedUpdates() == rejected + 8);
+}
+
+TEST_CASE(orderBookBestLevelSurvivesSummaryWordBoundaries) {
+    OrderBook book(kTick, kReference, kLevels, 16);
+    // Levels in different occupancy words and different summary words (4096 levels each).
+    const std::vector<int32_t> levels{0, 63, 64, 4095, 4096, 40000, 40063, 40064, kLevels - 1};
+    for (const int32_t i : levels) {
+        CHECK(book.applyDelta(BookDelta{BookSide::BID, priceAt(book, i), 1.0 + i}));
+        CHECK(book.applyDelta(BookDelta{BookSide::ASK, priceAt(book, i), 1.0 + i}));
+    }
+
+    // Bids fall back from the top, asks climb from the bottom, one removal at a time.
+    for (std::size_t k = levels.size(); k-- > 0;) {
+        CHECK(book.hasBid() && near(book.bestBid().price, priceAt(book, levels[k])));
+        CHECK(book.bestBid().volume == 1.0 + levels[k]);
+        book.applyDelta(BookDelta{BookSide::BID, priceAt(book, levels[k]), 0.0});
+    }
+    CHECK(!book.hasBid());
+    for (const int32_t i : levels) {
+        CHECK(book.hasAsk() && near(book.bestAsk().price, priceAt(book, i)));
+        book.applyDelta(BookDelta{BookSide::ASK, priceAt(book, i), 0.0});
+    }
+    CHECK(!book.hasAsk());
+}
+
+TEST_CASE(orderBookIndexEraseKeepsWrappedProbeChains) {
+    // 8 orders: the id index has 16 slots. Chain ids homed at the last slot so the probe
+    // run wraps to the front, then delete from the middle of the run.
+    constexpr uint64_t kMask = 15;
+    std::vector<uint64_t> ids;
+    for (uint64_t id = 1; ids.size() < 3; ++id) {
+        if (homeSlot(id, kMask) == kMask) ids.push_back(id);
+    }
+    for (uint64_t id = 1; ids.size() < 5; ++id) {
+        if (homeSlot(id, kMask) == 0) ids.push_back(id);
+    }
+
+    OrderBook book(kTick, kReference, kLevels, 8);
+    for (std::size_t k = 0; k < ids.size(); ++k) CHECK(book.addOrder(ids[k], BookSide::BID, 1.09990, 1.0 + k));
+    CHECK(book.deleteOrder(ids[0]));                    // head of the wrapped run
+    CHECK(book.deleteOrder(ids[3]));                    // homed at 0, displaced past the wrap
+    for (const std::size_t k : {1u, 2u, 4u}) CHECK(book.modifyOrder(ids[k], 0.5));
+    CHECK(book.bestBid().volume == 1.5 && book.orderCount() == 3);
+
+    // Random churn against a reference model on the same tiny index.
+    std::mt19937_64 rng(3);
+    std::unordered_map<uint64_t, std::pair<BookSide, double>> live;
+    for (const std::size_t k : {1u, 2u, 4u}) live[ids[k]] = {BookSide::BID, 1.09990};
+    bool consistent = true;
+    for (int step = 0; step < 20'000 && consistent; ++step) {
+        const uint64_t id = 1 + rng() % 24;
+        if (live.count(id) != 0) {
+            consistent = book.deleteOrder(id);
+            live.erase(id);
+        } else if (live.size() < 8) {
+            const BookSide side = (id & 1) ? BookSide::BID : BookSide::ASK;
+            const double price = side == BookSide::BID ? 1.0999 - 1e-5 * (id % 5) : 1.1001 + 1e-5 * (id % 5);
+            consistent = book.addOrder(id, side, price, 1.0);
+            live[id] = {side, price};
+        }
+        double bestBid = 0.0, bestAsk = 0.0;
+        for (const auto& [liveId, order] : live) {
+            if (order.first == BookSide::BID) bestBid = std::max(bestBid, order.second);
+            else if (bestAsk == 0.0 || order.second < bestAsk) bestAsk = order.second;
+        }
+        consistent = consistent && book.orderCount() == live.size()
+                     && book.hasBid() == (bestBid != 0.0) && (bestBid == 0.0 || near(book.bestBid().price, bestBid))
+                     && book.hasAsk() == (bestAsk != 0.0) && (bestAsk == 0.0 || near(book.bestAsk().price, bestAsk));
+    }
+    CHECK(consistent);
+}
+
+TEST_CASE(orderBookSnapshotRecentresWindowAndViewsRespectDepth) {
+    OrderBook book(kTick, kReference, kLevels, 16);
+    CHECK(book.addOrder(1, BookSide::BID, 1.09990, 1e6));
+
+    // 150.0 is far outside the current window: the snapshot re-centres it.
+    OrderBookSnapshot snapshot;
+    for (int i = 0; i < 4; ++i) {
+        snapshot.bids.push_back(PriceLevel{150.00000 - 1e-5 * i, 1e6 * (i + 1)});
+        snapshot.asks.push_back(PriceLevel{150.00002 + 1e-5 * i, 2e6 * (i + 1)});
+    }
+    book.applySnapshot(snapshot);
+    CHECK(book.orderCount() == 0);
+    CHECK(near(book.bestBid().price, 150.0) && near(book.bestAsk().price, 150.00002));
+    CHECK(!book.applyDelta(BookDelta{BookSide::BID, 1.09990, 1e6}));
+    CHECK(book.applyDelta(BookDelta{BookSide::BID, 149.99999, 7e6}));   // replaces a level's volume
+
+    const std::vector<PriceLevel> top = collect(book.topBids(3));
+    CHECK(top.size() == 3);
+    CHECK(near(top[0].price, 150.0) && near(top[1].price, 149.99999) && near(top[2].price, 149.99998));
+    CHECK(top[1].volume == 7e6);
+    CHECK(collect(book.topAsks(10)).size() == 4);
+    CHECK(collect(book.topAsks(0)).empty());
+
+    OrderBookSnapshot copy;
+    book.copyTo(copy, 2);
+    CHECK(copy.bids.size() == 2 && copy.asks.size() == 2 && copy.asks[1].volume == 4e6);
+
+    book.clear();
+    CHECK(!book.hasBid() && !book.hasAsk() && collect(book.topBids(5)).empty());
+}
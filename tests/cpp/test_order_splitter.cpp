@@ -0,0 +1,79 @@
+// test_order_splitter.cpp
+#include "TestHarness.hpp"
+#include "core/router/OrderSplitter.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace TradingSystem::Routing;
+using XAlgo::Data::PriceLevel;
+
+namespace {
+
+bool near(double a, double b, double eps = 1e-9) { return std::fabs(a - b) < eps; }
+
+VenueDepth depthOf(const std::vector<PriceLevel>& levels, double feeBps = 0.0) {
+    VenueDepth d;
+    d.levels = levels.data();
+    d.levelCount = static_cast<uint32_t>(levels.size());
+    d.feeBps = feeBps;
+    return d;
+}
+
+} // namespace
+
+TEST_CASE(splitterTakesCheapestLevelsAcrossVenues) {
+    const std::vector<PriceLevel> a{{1.1000, 100}, {1.1002, 100}, {1.1004, 100}};
+    const std::vector<PriceLevel> b{{1.1001, 100}, {1.1003, 100}};
+    const VenueDepth venues[] = {depthOf(a), depthOf(b)};
+    OrderSplitter splitter(SplitCostModel{0.0, 0.0, 5});
+
+    SplitPlan plan;
+    splitter.split(true, 350, venues, 2, plan);
+    // 1.1000, 1.1001, 1.1002 fully, then half of 1.1003.
+    CHECK(plan.count == 2);
+    CHECK(plan.slices[0].venue == 0 && near(plan.slices[0].quantity, 200));
+    CHECK(plan.slices[1].venue == 1 && near(plan.slices[1].quantity, 150));
+    CHECK(near(plan.slices[1].limitPrice, 1.1003));
+    CHECK(near(plan.allocated, 350) && near(plan.unallocated, 0));
+    CHECK(near(plan.avgPrice, (100 * 1.1000 + 100 * 1.1001 + 100 * 1.1002 + 50 * 1.1003) / 350));
+}
+
+TEST_CASE(splitterPricesFeesLatencyAndReliability) {
+    const std::vector<PriceLevel> levels{{1.1000, 100}, {1.1010, 100}};
+    SplitPlan plan;
+
+    // Same book; a 20 bps fee makes venue 0's top level worse than venue 1's second level.
+    VenueDepth venues[] = {depthOf(levels, 20.0), depthOf(levels, 0.0)};
+    OrderSplitter splitter(SplitCostModel{0.0, 0.0, 5});
+    splitter.split(true, 200, venues, 2, plan);
+    CHECK(plan.count == 1 && plan.slices[0].venue == 1);
+
+    // Latency and unreliability are priced the same way.
+    venues[0] = depthOf(levels);
+    venues[0].latencyUs = 40'000.0;   // 40 ms at 0.5 bps/ms = 20 bps
+    splitter.setCostModel(SplitCostModel{0.5, 0.0, 5});
+    splitter.split(true, 200, venues, 2, plan);
+    CHECK(plan.count == 1 && plan.slices[0].venue == 1);
+
+    venues[0] = depthOf(levels);
+    venues[0].reliability = 0.5;      // 50% miss at 40 bps = 20 bps
+    splitter.setCostModel(SplitCostModel{0.0, 40.0, 5});
+    splitter.split(true, 200, venues, 2, plan);
+    CHECK(plan.count == 1 && plan.slices[0].venue == 1);
+}
+
+TEST_CASE(splitterSellsIntoBestBidsAndReportsShortfall) {
+    const std::vector<PriceLevel> a{{1.0999, 50}, {1.0990, 50}};
+    const std::vector<PriceLevel> b{{1.0995, 50}, {0.0, 0}, {1.0980, 50}};
+    VenueDepth venues[] = {depthOf(a), depthOf(b), depthOf(a)};
+    venues[2].available = false;
+    OrderSplitter splitter(SplitCostModel{0.0, 0.0, 2});   // venue 1's third level is out of range
+
+    SplitPlan plan;
+    splitter.split(false, 500, venues, 3, plan);
+    CHECK(plan.count == 2);
+    CHECK(near(plan.slices[0].quantity, 100) && near(plan.slices[0].limitPrice, 1.0990));
+    CHECK(near(plan.slices[1].quantity, 50) && near(plan.slices[1].limitPrice, 1.0995));
+    CHECK(near(plan.allocated, 150) && near(plan.unallocated, 350));
+}
@@ -0,0 +1,72 @@
+// test_position_book.cpp
+#include "TestHarness.hpp"
+#include "core/models/PositionBook.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace TradingSystem;
+
+TEST_CASE(positionBookNetsTriangleExposurePerCurrency) {
+    const SymbolId eurUsd = internSymbol("EUR/USD");
+    const SymbolId gbpUsd = internSymbol("GBP/USD");
+    const SymbolId eurGbp = internSymbol("EURGBP");
+    PositionBook book;
+    CHECK(book.addSymbol(eurUsd) && book.addSymbol(gbpUsd) && book.addSymbol(eurGbp));
+    CHECK(!book.addSymbol(internSymbol("NOTAPAIR")));
+    CHECK(book.currencyCount() == 3);
+
+    // USD -> EUR -> GBP -> USD
+    CHECK(book.onFill(TradeLeg(eurUsd, 1.10, 1'000'000, OrderSide::BUY)));
+    CHECK(book.onFill(TradeLeg(eurGbp, 0.85, 1'000'000, OrderSide::SELL)));
+    CHECK(book.onFill(TradeLeg(gbpUsd, 1.30, 850'000, OrderSide::SELL)));
+    CHECK(!book.onFill(kInvalidSymbol, 1.0, 1.0));
+    CHECK(book.fills() == 3);
+
+    CHECK(std::fabs(book.exposure("EUR")) < 1e-6);
+    CHECK(std::fabs(book.exposure("GBP")) < 1e-6);
+    CHECK(std::fabs(book.exposure("USD") - 5'000.0) < 1e-6);
+    CHECK(book.exposure("JPY") == 0.0);
+
+    double all[8];
+    CHECK(book.exposures(all, 8) == 3);
+    CHECK(all[book.currencyId("USD")] == book.exposure("USD"));
+
+    const PositionSnapshot eur = book.snapshot(eurUsd);
+    CHECK(eur.netQuantity == 1'000'000 && eur.avgPrice == 1.10);
+    CHECK(book.snapshot(gbpUsd).netQuantity == -850'000);
+}
+
+TEST_CASE(positionSnapshotsNeverTearUnderConcurrentUpdates) {
+    // Alternating +1 @ 2.0 and -1 @ 0.0 keeps the position at one of two states, with
+    // quantity and price changing together; a torn read would mix them.
+    Position position(internSymbol("EUR/USD"));
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> reads{0};
+
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const PositionSnapshot s = position.snapshot();
+            const bool flat = s.netQuantity == 0.0 && s.avgPrice == 0.0;
+            const bool held = s.netQuantity == 1.0 && s.avgPrice == 2.0;
+            if (!flat && !held) torn.fetch_add(1, std::memory_order_relaxed);
+            reads.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::yield();
+        }
+    });
+
+    for (int i = 0; i < 200'000; ++i) {
+        position.update(1.0, 2.0);
+        position.update(-1.0, 0.0);
+        if ((i & 1023) == 0) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    CHECK(torn.load() == 0);
+    CHECK(reads.load() > 0);
+    CHECK(position.getNetQuantity() == 0.0 && position.getAveragePrice() == 0.0);
+}
@@ -0,0 +1,122 @@
+// test_risk_manager.cpp
+#include "TestHarness.hpp"
+#include "core/Risk/RiskManager.hpp"
+
+#include <string>
+
+using namespace TradingSystem;
+
+TEST_CASE(riskCheckEnforcesSizeBandAndExposureCaps) {
+    const SymbolId eurUsd = internSymbol("EUR/USD");
+    PositionBook book;
+    CHECK(book.addSymbol(eurUsd));
+    RiskManager risk(100e6, &book);
+
+    // Nothing armed: anything sane passes, nonsense does not.
+    CHECK(risk.check(eurUsd, true, 1e6, 1.10, 0) == RiskCheck::Accepted);
+    CHECK(risk.check(eurUsd, true, 0.0, 1.10, 0) == RiskCheck::InvalidOrder);
+    CHECK(risk.check(kInvalidSymbol, true, 1e6, 1.10, 0) == RiskCheck::InvalidOrder);
+
+    risk.setSymbolLimits(eurUsd, SymbolRiskLimits{5e6, 6e6, 20.0, UINT32_MAX});
+    // Band armed before any reference price: fail closed.
+    CHECK(risk.check(eurUsd, true, 1e6, 1.10, 0) == RiskCheck::PriceBand);
+    risk.updateReferencePrice(eurUsd, 1.10);
+    CHECK(risk.check(eurUsd, true, 1e6, 1.1021, 0) == RiskCheck::Accepted);   // 19 bps
+    CHECK(risk.check(eurUsd, true, 1e6, 1.1030, 0) == RiskCheck::PriceBand);  // 27 bps
+    CHECK(risk.check(eurUsd, true, 5e6, 1.10, 0) == RiskCheck::OrderSize);
+
+    // Symbol cap counts what is already booked.
+    book.onFill(eurUsd, 4e6, 1.10);
+    CHECK(risk.check(eurUsd, true, 1e6, 1.10, 0) == RiskCheck::Accepted);     // 5M * 1.1 = 5.5M
+    CHECK(risk.check(eurUsd, true, 2e6, 1.10, 0) == RiskCheck::SymbolNotional);
+    CHECK(risk.check(eurUsd, false, 2e6, 1.10, 0) == RiskCheck::Accepted);    // reduces
+
+    // Currency cap on the quote side: long 4M EUR is short 4.4M USD.
+    CHECK(risk.setCurrencyLimit("USD", 5e6));
+    CHECK(!risk.setCurrencyLimit("JPY", 5e6));
+    CHECK(risk.check(eurUsd, true, 1e6, 1.10, 0) == RiskCheck::CurrencyNotional);
+    CHECK(risk.check(eurUsd, false, 1e6, 1.10, 0) == RiskCheck::Accepted);
+
+    CHECK(risk.rejections(RiskCheck::PriceBand) == 2);
+    CHECK(risk.rejections(RiskCheck::InvalidOrder) == 2);
+    CHECK(risk.totalRejections() == 7);
+    CHECK(std::string(toString(RiskCheck::CurrencyNotional)) == "currency_notional");
+}
+
+TEST_CASE(riskThrottleAndDrawdownHaltStopTheOrderPath) {
+    const SymbolId gbpUsd = internSymbol("GBP/USD");
+    RiskManager risk(1e6);
+    SymbolRiskLimits limits;
+    limits.maxOrdersPerSecond = 3;
+    risk.setSymbolLimits(gbpUsd, limits);
+
+    const uint64_t t0 = TscClock::now();
+    for (int i = 0; i < 3; ++i) CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t0) == RiskCheck::Accepted);
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t0) == RiskCheck::OrderRate);
+    // Well past a second later the window has rolled over.
+    const uint64_t later = t0 + static_cast<uint64_t>(2e9 / TscClock::toNanos(1));
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, later) == RiskCheck::Accepted);
+
+    CHECK(risk.evaluateOrderRisk(40e3, 1.0));
+    CHECK(!risk.evaluateOrderRisk(60e3, 1.0));
+
+    risk.updatePosition(-20e3);
+    risk.updatePosition(15e3);
+    CHECK(risk.isStrategyAllowed());
+    CHECK(risk.currentDrawdown() == 20e3);
+    risk.updatePosition(-30e3);   // 35k down, past 3% of 1M
+    CHECK(!risk.isStrategyAllowed());
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, later) == RiskCheck::StrategyHalted);
+}
+
+TEST_CASE(riskThrottlesDoNotSpendBudgetOnRejectedOrders) {
+    const SymbolId eurUsd = internSymbol("EUR/USD");
+    const SymbolId gbpUsd = internSymbol("GBP/USD");
+    RiskManager risk(100e6);
+    risk.setMaxOrdersPerSecond(3);
+    SymbolRiskLimits limits;
+    limits.maxOrdersPerSecond = 1;
+    risk.setSymbolLimits(gbpUsd, limits);
+
+    // The second GBP order is stopped by its own throttle and leaves the global budget alone.
+    const uint64_t t0 = TscClock::now();
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t0) == RiskCheck::Accepted);
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t0) == RiskCheck::OrderRate);
+    CHECK(risk.check(eurUsd, true, 1e3, 1.10, t0) == RiskCheck::Accepted);
+    CHECK(risk.check(eurUsd, true, 1e3, 1.10, t0) == RiskCheck::Accepted);
+    CHECK(risk.check(eurUsd, true, 1e3, 1.10, t0) == RiskCheck::OrderRate);
+
+    // Next window: a GBP order the global throttle refuses gets its symbol token back.
+    const uint64_t t1 = t0 + static_cast<uint64_t>(2e9 / TscClock::toNanos(1));
+    risk.setMaxOrdersPerSecond(1);
+    CHECK(risk.check(eurUsd, true, 1e3, 1.10, t1) == RiskCheck::Accepted);
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t1) == RiskCheck::OrderRate);
+    risk.setMaxOrdersPerSecond(UINT32_MAX);
+    CHECK(risk.check(gbpUsd, true, 1e3, 1.31, t1) == RiskCheck::Accepted);
+}
+
+TEST_CASE(riskRejectionsAreExportedThroughMetrics) {
+    const SymbolId eurUsd = internSymbol("EUR/USD");
+    Metrics metrics;
+    RiskManager risk(100e6);
+    risk.attachMetrics(metrics);
+    risk.setMaxOrderNotional(1e6);
+
+    CHECK(risk.check(eurUsd, true, 1e6, 1.10, 0) == RiskCheck::OrderSize);
+    CHECK(risk.check(eurUsd, true, 0.0, 1.10, 0) == RiskCheck::InvalidOrder);
+    CHECK(risk.check(eurUsd, true, 2e6, 1.10, 0) == RiskCheck::OrderSize);
+    CHECK(risk.check(eurUsd, true, 1e5, 1.10, 0) == RiskCheck::Accepted);
+
+    // The check path only bumps the manager's own atomics; nothing reaches Metrics yet.
+    CHECK(risk.rejections(RiskCheck::OrderSize) == 2);
+    CHECK(metrics.counter("risk.rejected.order_size").value() == 0);
+
+    risk.publishMetrics();
+    risk.publishMetrics();   // publishes deltas: a second call adds nothing
+    CHECK(metrics.counter("risk.rejected.order_size").value() == 2);
+    CHECK(metrics.counter("risk.rejected.invalid_order").value() == 1);
+    CHECK(metrics.counter("risk.rejected.price_band").value() == 0);
+    const std::string text = metrics.snapshot().toText();
+    CHECK(text.find("risk_rejected_order_size 2\n") != std::string::npos);
+    CHECK(text.find("risk_rejected_accepted") == std::string::npos);
+}
@@ -0,0 +1,99 @@
+// test_rolling_johansen.cpp
+#include "TestHarness.hpp"
+#include "core/models/RollingJohansen.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace TradingSystem;
+
+namespace {
+
+using Engine = RollingJohansenEngine<3>;
+
+/// @brief Two cointegrated random walks and one independent one.
+std::vector<Engine::Vector> cointegratedPath(std::size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> step(0.0, 1e-4);
+    std::vector<Engine::Vector> path(n);
+    double common = 1.10, independent = 0.85;
+    for (std::size_t t = 0; t < n; ++t) {
+        common += step(rng);
+        independent += step(rng);
+        path[t] << common, 1.31 * common + 0.5 * step(rng), independent;
+    }
+    return path;
+}
+
+/// @brief Johansen eigenvalues (descending) computed directly from the last `window`
+/// (ΔX_t, X_{t-1}) pairs of `path`, with no incremental state.
+std::array<double, 3> directEigenvalues(const std::vector<Engine::Vector>& path, std::size_t window) {
+    using Matrix = Engine::Matrix;
+    const std::size_t end = path.size();
+    Eigen::MatrixXd d(3, static_cast<Eigen::Index>(window)), l(3, static_cast<Eigen::Index>(window));
+    for (std::size_t k = 0; k < window; ++k) {
+        const std::size_t t = end - window + k;
+        d.col(static_cast<Eigen::Index>(k)) = path[t] - path[t - 1];
+        l.col(static_cast<Eigen::Index>(k)) = path[t - 1];
+    }
+    d.colwise() -= d.rowwise().mean();
+    l.colwise() -= l.rowwise().mean();
+    const double T = static_cast<double>(window);
+    const Matrix s00 = d * d.transpose() / T;
+    const Matrix s11 = l * l.transpose() / T;
+    const Matrix s01 = d * l.transpose() / T;
+
+    // |λ S11 - S10 S00^-1 S01| = 0 as a generalized symmetric problem.
+    const Matrix a = s01.transpose() * s00.inverse() * s01;
+    Eigen::GeneralizedSelfAdjointEigenSolver<Matrix> solver(a, s11, Eigen::EigenvaluesOnly);
+    return {solver.eigenvalues()(2), solver.eigenvalues()(1), solver.eigenvalues()(0)};
+}
+
+} // namespace
+
+TEST_CASE(rollingJohansenMatchesDirectSolveOverTheWindow) {
+    constexpr std::size_t kWindow = 250;
+    // Three and a half windows: exercises sliding removals and the shadow swap.
+    const std::vector<Engine::Vector> path = cointegratedPath(3 * kWindow + kWindow / 2 + 1, 17);
+    Engine engine(kWindow, 7);
+    for (const Engine::Vector& x : path) engine.push(x);
+    engine.solve();
+
+    const JohansenResult<3>& r = engine.result();
+    CHECK(r.valid);
+    const std::array<double, 3> expected = directEigenvalues(path, kWindow);
+    for (int i = 0; i < 3; ++i) CHECK(std::abs(r.eigenvalues[i] - expected[i]) < 1e-8);
+
+    double trace = 0.0;
+    for (int i = 2; i >= 0; --i) {
+        const double term = -static_cast<double>(kWindow) * std::log(1.0 - expected[i]);
+        trace += term;
+        CHECK(std::abs(r.traceStats[i] - trace) < 1e-5 * trace + 1e-9);
+        CHECK(std::abs(r.maxEigenStats[i] - term) < 1e-5 * term + 1e-9);
+    }
+
+    // One cointegrating relation between the first two series; both tests should find it.
+    CHECK(r.rank == 1);
+    CHECK(r.maxEigenRank == 1);
+}
+
+TEST_CASE(rollingJohansenRarelyFindsCointegrationBetweenIndependentWalks) {
+    // A 95% test rejects a true null now and then; over 40 paths it should be the exception.
+    int traceRejects = 0, maxEigenRejects = 0;
+    for (uint64_t seed = 0; seed < 40; ++seed) {
+        std::mt19937_64 rng(seed);
+        std::normal_distribution<double> step(0.0, 1e-4);
+        Engine engine(500);
+        Engine::Vector x(1.1, 1.3, 0.85);
+        for (int t = 0; t < 1200; ++t) {
+            x += Engine::Vector(step(rng), step(rng), step(rng));
+            engine.push(x);
+        }
+        CHECK(engine.isWarm() && engine.result().valid);
+        traceRejects += engine.result().cointegrated() ? 1 : 0;
+        maxEigenRejects += engine.result().maxEigenRank > 0 ? 1 : 0;
+    }
+    CHECK(traceRejects <= 8);
+    CHECK(maxEigenRejects <= 8);
+}
@@ -0,0 +1,85 @@
+// test_shm_ring.cpp
+#include "TestHarness.hpp"
+#include "core/messaging/ShmBroadcastRing.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace hft::core::messaging;
+
+namespace {
+
+std::string uniqueName(const char* tag) {
+    return "/xalgo_test_" + std::string(tag) + "_" + std::to_string(getpid());
+}
+
+struct Received {
+    std::string topic;
+    std::string payload;
+};
+
+bool readOne(ShmBroadcastRing::Reader& reader, std::vector<char>& buf, Received& out) {
+    uint32_t topicLength = 0, payloadLength = 0;
+    if (!reader.tryRead(buf.data(), topicLength, payloadLength)) return false;
+    out.topic.assign(buf.data(), topicLength);
+    out.payload.assign(buf.data() + topicLength, payloadLength);
+    return true;
+}
+
+} // namespace
+
+TEST_CASE(shmRingBroadcastsToEveryReaderAcrossMappings) {
+    const std::string name = uniqueName("bcast");
+    ShmBroadcastRing::unlink(name);
+    // Two independent mappings of the same object, as two processes would have.
+    auto writer = ShmBroadcastRing::attach(name, ShmRingOptions{64, 128});
+    auto other = ShmBroadcastRing::attach(name, ShmRingOptions{64, 128});
+    CHECK(writer != nullptr && other != nullptr);
+    if (!writer || !other) return;
+    CHECK(ShmBroadcastRing::attach(name, ShmRingOptions{128, 128}) == nullptr);   // geometry mismatch
+
+    ShmBroadcastRing::Reader a(*other), b(*other);
+    std::vector<char> buf(other->maxMessageSize());
+    Received msg;
+    CHECK(!readOne(a, buf, msg));
+
+    for (int i = 0; i < 10; ++i) CHECK(writer->publish("MD.EURUSD", "tick-" + std::to_string(i)));
+    CHECK(!writer->publish("MD", std::string(writer->maxMessageSize(), 'x')));
+
+    for (int i = 0; i < 10; ++i) {
+        CHECK(readOne(a, buf, msg) && msg.topic == "MD.EURUSD" && msg.payload == "tick-" + std::to_string(i));
+    }
+    CHECK(!readOne(a, buf, msg));
+    int seenByB = 0;
+    while (readOne(b, buf, msg)) ++seenByB;
+    CHECK(seenByB == 10);
+
+    // A late reader starts at the head.
+    ShmBroadcastRing::Reader late(*other);
+    CHECK(!readOne(late, buf, msg));
+    ShmBroadcastRing::unlink(name);
+}
+
+TEST_CASE(shmRingSlowReaderDropsOldestAndResynchronises) {
+    const std::string name = uniqueName("lap");
+    ShmBroadcastRing::unlink(name);
+    auto ring = ShmBroadcastRing::attach(name, ShmRingOptions{16, 64});
+    CHECK(ring != nullptr);
+    if (!ring) return;
+
+    ShmBroadcastRing::Reader reader(*ring);
+    for (int i = 0; i < 40; ++i) ring->publish("T", std::to_string(i));
+
+    std::vector<char> buf(ring->maxMessageSize());
+    Received msg;
+    CHECK(readOne(reader, buf, msg));
+    CHECK(msg.payload == "24");   // the last 16 survive
+    CHECK(reader.dropped() == 24);
+    int rest = 0;
+    while (readOne(reader, buf, msg)) ++rest;
+    CHECK(rest == 15 && msg.payload == "39");
+    ShmBroadcastRing::unlink(name);
+}
@@ -0,0 +1,41 @@
+// test_signal_engine.cpp
+#include "TestHarness.hpp"
+#include "core/models/Signal.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace TradingSystem;
+
+TEST_CASE(streamingZScoreMatchesBatchOverWindow) {
+    constexpr std::size_t kWindow = 250;
+    SignalEngine engine;
+    StreamingZScore rolling(kWindow);
+    std::vector<double> history;
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> noise(0.0, 1e-5);
+
+    double maxError = 0.0;
+    for (int i = 0; i < 20'000; ++i) {
+        // Large offset + tiny variance is where naive sum/sum-of-squares breaks down.
+        const double spread = 1.0e3 + noise(rng);
+        history.push_back(spread);
+        const double z = rolling.update(spread);
+        if (history.size() >= kWindow && i % 101 == 0) {
+            const std::vector<double> window(history.end() - kWindow, history.end());
+            maxError = std::max(maxError, std::abs(z - engine.computeAdaptiveZScore(window)));
+        }
+    }
+    CHECK(rolling.isWarm());
+    CHECK(maxError < 1e-6);
+}
+
+TEST_CASE(ewmaZScoreTracksLevelShift) {
+    StreamingZScore ewma(100, ZScoreMode::EWMA);
+    for (int i = 0; i < 1'000; ++i) ewma.update(0.001 + ((i % 2) ? 1e-6 : -1e-6));
+    CHECK(std::abs(ewma.mean() - 0.001) < 1e-6);
+
+    // A jump well outside the recent range scores strongly positive.
+    CHECK(ewma.update(0.0011) > 3.0);
+}
@@ -0,0 +1,39 @@
+// test_symbol_registry.cpp
+#include "TestHarness.hpp"
+#include "core/models/Order.hpp"
+#include "core/models/SymbolRegistry.hpp"
+
+#include <string>
+
+using namespace TradingSystem;
+
+TEST_CASE(registryHandsOutDenseStableIds) {
+    NameRegistry registry(3);
+    const NameRegistry::Id eurUsd = registry.intern("EUR/USD");
+    const NameRegistry::Id gbpUsd = registry.intern("GBP/USD");
+    CHECK(eurUsd == 0 && gbpUsd == 1);
+    CHECK(registry.intern("EUR/USD") == eurUsd);
+    CHECK(registry.find("GBP/USD") == gbpUsd);
+    CHECK(registry.find("USD/JPY") == NameRegistry::kInvalid);
+    CHECK(registry.intern("") == NameRegistry::kInvalid);
+
+    const std::string& name = registry.name(eurUsd);
+    CHECK(registry.intern("EUR/GBP") == 2);
+    CHECK(registry.intern("USD/JPY") == NameRegistry::kInvalid);   // full
+    CHECK(registry.size() == 3);
+    CHECK(&registry.name(eurUsd) == &name && name == "EUR/USD");   // never moves
+    CHECK(registry.name(NameRegistry::kInvalid).empty());
+}
+
+TEST_CASE(ordersCarryIdsAndCopyWithoutAllocating) {
+    const SymbolId symbol = internSymbol("EUR/CHF");
+    const uint64_t before = TestHarness::allocationCount();
+    for (uint64_t i = 0; i < 1000; ++i) {
+        const Order order(i, symbol, 0.94, 1'000'000, OrderSide::BUY, OrderType::LIMIT);
+        const Order copy = order;
+        CHECK(copy.getSymbolId() == symbol);
+        CHECK(symbolRegistry().find("EUR/CHF") == symbol);
+    }
+    CHECK(TestHarness::allocationCount() == before);
+    CHECK(Order(1, symbol, 0.94, 1, OrderSide::SELL, OrderType::MARKET).getSymbol() == "EUR/CHF");
+}
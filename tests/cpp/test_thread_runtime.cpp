@@ -0,0 +1,84 @@
+// test_thread_runtime.cpp
+#include "TestHarness.hpp"
+#include "core/concurrency/ThreadRuntime.hpp"
+#include "utils/ConfigLoader.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace TradingSystem;
+
+TEST_CASE(threadTopologyResolvesFromConfig) {
+    std::string error;
+    const auto values = ConfigLoader::parse(R"(
+threads:
+  zmq_listener:
+    cpu: 0
+    idle: busy_poll
+  router.LMAX:
+    priority: 40
+    idle: sleep
+    sleep_us: 50
+  logger:
+    idle: no_such_policy
+)", "threads.yaml", &error);
+    CHECK(values.has_value());
+    const ThreadTopology topology = ConfigSnapshot::fromValues(*values).threads;
+    CHECK(topology.threads.size() == 3);
+
+    const ThreadSpec* listener = topology.find("zmq_listener");
+    CHECK(listener != nullptr && listener->cpu == 0 && listener->idle == IdlePolicy::BusyPoll);
+    const ThreadSpec* router = topology.find("router.LMAX");
+    CHECK(router != nullptr && router->priority == 40 && router->cpu == -1);
+    CHECK(router->idle == IdlePolicy::Sleep && router->sleep == std::chrono::microseconds(50));
+    CHECK(topology.find("logger")->idle == IdlePolicy::SpinYield);   // unknown policy keeps the default
+    CHECK(topology.find("execution") == nullptr);
+
+    IdlePolicy policy = IdlePolicy::Sleep;
+    CHECK(!parseIdlePolicy("spin", policy) && policy == IdlePolicy::Sleep);
+    CHECK(parseIdlePolicy(toString(IdlePolicy::BusyPoll), policy) && policy == IdlePolicy::BusyPoll);
+}
+
+TEST_CASE(threadRuntimeAppliesSpecAndReportsUsage) {
+    ThreadSpec pinned;
+    pinned.name = "test.pinned";
+    pinned.cpu = 0;
+    pinned.idle = IdlePolicy::Sleep;
+    pinned.sleep = std::chrono::microseconds(200);
+    ThreadRuntime runtime(ThreadTopology{{pinned}});
+    CHECK(runtime.spec("test.other").cpu == -1 && runtime.spec("test.other").name == "test.other");
+
+    std::atomic<bool> release{false};
+    std::atomic<bool> sawPolicy{false};
+    std::thread worker = runtime.start("test.pinned", [&] {
+        IdleStrategy idle = IdleStrategy::forCurrentThread();
+        sawPolicy = idle.policy() == IdlePolicy::Sleep;
+        volatile uint64_t work = 0;
+        for (int i = 0; i < 2'000'000; ++i) work = work + static_cast<uint64_t>(i);
+        while (!release.load()) idle.idle();   // sleeps once the spin budget is spent: voluntary switches
+    });
+    std::thread unnamed = runtime.start("test.other", [] {});
+    unnamed.join();
+
+    // Live figures come from procfs while the thread runs.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::vector<ThreadStats> live = runtime.stats();
+    CHECK(live.size() == 2);
+    const ThreadStats* p = live[0].name == "test.pinned" ? &live[0] : &live[1];
+    CHECK(p->running && p->tid > 0 && p->requestedCpu == 0);
+    CHECK(p->pinned && p->lastCpu == 0);
+    CHECK(p->cpuNanos > 0 && p->voluntarySwitches > 0);
+
+    release = true;
+    worker.join();
+    const std::vector<ThreadStats> done = runtime.stats();
+    for (const ThreadStats& s : done) {
+        CHECK(!s.running);
+        if (s.name == "test.pinned") CHECK(s.cpuNanos >= p->cpuNanos && s.voluntarySwitches >= p->voluntarySwitches);
+        else CHECK(!s.pinned && s.requestedCpu == -1);
+    }
+    CHECK(sawPolicy.load());
+    CHECK(IdleStrategy::forCurrentThread().policy() == IdlePolicy::SpinYield);   // not a runtime thread
+}
@@ -0,0 +1,131 @@
+// test_tick_engine.cpp
+#include "TestHarness.hpp"
+#include "core/models/TickEngine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace TradingSystem;
+
+namespace {
+
+void primeTriangle(TickEngine& engine) {
+    engine.onQuote(FxLeg::EURUSD, 1.12000, 1.12002);
+    engine.onQuote(FxLeg::GBPUSD, 1.31000, 1.31002);
+    engine.onQuote(FxLeg::EURGBP, 0.85500, 0.85502);
+}
+
+} // namespace
+
+TEST_CASE(tickEngineFiresOnlyOnceAllLegsArePrimed) {
+    int calls = 0;
+    TickEngine engine([&](const TickData&, FxLeg) { ++calls; });
+
+    engine.onQuote(FxLeg::EURUSD, 1.12000, 1.12002);
+    engine.onQuote(FxLeg::GBPUSD, 1.31000, 1.31002);
+    CHECK(calls == 0);
+    CHECK(!engine.isPrimed());
+
+    engine.onQuote(FxLeg::EURGBP, 0.85500, 0.85502);
+    CHECK(calls == 1);
+    CHECK(engine.isPrimed());
+    CHECK(engine.triangle().eurUsd == 0.5 * (1.12000 + 1.12002));
+}
+
+TEST_CASE(tickEngineConflatesDuplicatesAndDropsStaleQuotes) {
+    int calls = 0;
+    TickEngine engine([&](const TickData&, FxLeg) { ++calls; });
+    primeTriangle(engine);
+    const int primedCalls = calls;
+
+    CHECK(engine.onQuote(FxLeg::EURUSD, 1.12000, 1.12002) == IngestResult::CONFLATED);
+    CHECK(engine.onQuote(FxLeg::GBPUSD, 1.31001, 1.31003, 10) == IngestResult::UPDATED);
+    CHECK(engine.onQuote(FxLeg::GBPUSD, 1.31005, 1.31007, 9) == IngestResult::STALE);
+    CHECK(engine.onQuote(FxLeg::GBPUSD, 1.31005, 1.31007, 10) == IngestResult::STALE);
+    CHECK(engine.onQuote(FxLeg::EURGBP, 0.85510, 0.85500) == IngestResult::REJECTED);
+    CHECK(engine.onQuote(FxLeg::EURGBP, 0.0, 0.85500) == IngestResult::REJECTED);
+
+    CHECK(calls == primedCalls + 1);
+    CHECK(engine.conflatedCount() == 1);
+    CHECK(engine.staleCount() == 2);
+    CHECK(engine.rejectedCount() == 2);
+}
+
+TEST_CASE(tickEngineSkipsCallbackWhenMidIsUnchanged) {
+    int calls = 0;
+    FxLeg lastLeg = FxLeg::EURUSD;
+    TickEngine engine([&](const TickData&, FxLeg leg) { ++calls; lastLeg = leg; });
+    primeTriangle(engine);
+    const int primedCalls = calls;
+
+    // Wider spread, same mid: stored in history but the triangle did not move.
+    CHECK(engine.onQuote(FxLeg::EURGBP, 0.85499, 0.85503) == IngestResult::UPDATED);
+    CHECK(calls == primedCalls);
+    CHECK(engine.history(FxLeg::EURGBP).size() == 2);
+
+    CHECK(engine.onQuote(FxLeg::EURGBP, 0.85501, 0.85503) == IngestResult::UPDATED);
+    CHECK(calls == primedCalls + 1);
+    CHECK(lastLeg == FxLeg::EURGBP);
+}
+
+TEST_CASE(quoteHistoryWrapsAndKeepsNewestFirst) {
+    TickEngine engine(nullptr, 8);
+    for (int i = 1; i <= 20; ++i) {
+        engine.onQuote(FxLeg::EURUSD, 1.0 + i * 1e-5, 1.0 + i * 1e-5 + 2e-5);
+    }
+    const QuoteHistory& history = engine.history(FxLeg::EURUSD);
+    CHECK(history.capacity() == 8);
+    CHECK(history.size() == 8);
+    CHECK(history.totalPushed() == 20);
+    CHECK(history.latest().bid == 1.0 + 20 * 1e-5);
+    CHECK(history[7].bid == 1.0 + 13 * 1e-5);
+    CHECK(history.latest().receivedTsc >= history[7].receivedTsc);
+}
+
+TEST_CASE(tickEngineSteadyStateDoesNotAllocate) {
+    double spreadSum = 0.0;
+    TickEngine engine([&](const TickData& t, FxLeg) { spreadSum += t.eurUsd - t.eurGbp * t.gbpUsd; }, 1024);
+    primeTriangle(engine);
+
+    const uint64_t before = TestHarness::allocationCount();
+    for (int i = 0; i < 100'000; ++i) {
+        const double bump = (i % 97) * 1e-5;
+        engine.onQuote(static_cast<FxLeg>(i % 3), 1.0 + bump, 1.0 + bump + 2e-5);
+    }
+    CHECK(TestHarness::allocationCount() == before);
+    CHECK(engine.triangleUpdates() > 0);
+    CHECK(spreadSum != 0.0);
+}
+
+TEST_CASE(tickEngineThroughputAndP99) {
+    constexpr int kQuotes = 1'000'000;
+    constexpr int kSampled = 100'000;
+    uint64_t callbacks = 0;
+    TickEngine engine([&](const TickData&, FxLeg) { ++callbacks; });
+    primeTriangle(engine);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kQuotes; ++i) {
+        const double bump = (i % 101) * 1e-5;
+        engine.onQuote(static_cast<FxLeg>(i % 3), 1.0 + bump, 1.0 + bump + 2e-5);
+    }
+    const double elapsedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double quotesPerSec = kQuotes / elapsedSec;
+
+    std::vector<double> latencyNs(kSampled);
+    for (int i = 0; i < kSampled; ++i) {
+        const double bump = (i % 89) * 1e-5;
+        const uint64_t t0 = TscClock::now();
+        engine.onQuote(static_cast<FxLeg>(i % 3), 1.1 + bump, 1.1 + bump + 2e-5);
+        latencyNs[i] = TscClock::toNanos(TscClock::now() - t0);
+    }
+    std::sort(latencyNs.begin(), latencyNs.end());
+    const double p99 = latencyNs[static_cast<size_t>(0.99 * (kSampled - 1))];
+
+    std::cout << "  tick engine: " << quotesPerSec / 1e6 << " M quotes/s, p99 " << p99 << " ns\n";
+    // Generous bounds so sanitizer/coverage builds pass; Release is orders of magnitude better.
+    CHECK(quotesPerSec > 1e6);
+    CHECK(p99 < 5'000.0);
+    CHECK(callbacks > 0);
+}
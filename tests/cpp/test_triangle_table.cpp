@@ -0,0 +1,88 @@
+// test_triangle_table.cpp
+#include "TestHarness.hpp"
+#include "core/models/TriangleTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace TradingSystem;
+
+namespace {
+
+constexpr std::size_t kSymbols = 32;
+
+/// @brief Random triangles over kSymbols symbols, every leg primed, then `quotes` noisy ticks.
+std::vector<double> randomRun(KernelIsa isa, std::size_t triangles, std::size_t quotes) {
+    TriangleTable table(kSymbols);
+    table.forceKernel(isa);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<uint32_t> pick(0, kSymbols - 1);
+    for (std::size_t i = 0; i < triangles; ++i) {
+        const uint32_t a = pick(rng);
+        uint32_t b = pick(rng), c = pick(rng);
+        while (b == a) b = pick(rng);
+        while (c == a || c == b) c = pick(rng);
+        table.addTriangle(a, b, c);
+    }
+    std::vector<double> mids(kSymbols);
+    for (uint32_t s = 0; s < kSymbols; ++s) table.onQuote(s, mids[s] = 1.0 + 0.01 * s);
+
+    std::normal_distribution<double> noise(0.0, 1e-4);
+    for (std::size_t q = 0; q < quotes; ++q) {
+        const uint32_t s = pick(rng);
+        mids[s] += noise(rng);
+        table.onQuote(s, mids[s]);
+    }
+    return std::vector<double>(table.zScores(), table.zScores() + table.size());
+}
+
+} // namespace
+
+TEST_CASE(triangleStatisticsOnlyMoveWithTheirOwnLegs) {
+    constexpr double kAlpha = 0.1;
+    TriangleTable table(6, kAlpha);
+    table.addTriangle(0, 1, 2);
+    table.addTriangle(3, 4, 5);
+    for (uint32_t s = 0; s < 6; ++s) table.onQuote(s, 1.0 + 0.1 * s);
+
+    // Push triangle 1 off its mean, then tick only triangle 0's legs.
+    table.onQuote(3, 1.40);
+    table.onQuote(3, 1.45);
+    const double z1 = table.zScore(1);
+    CHECK(z1 != 0.0);
+
+    // Reference EWMA for triangle 0, folded once per quote on one of its legs.
+    double mean = 1.0 - 1.1 * 1.2, var = 0.0;
+    for (int i = 1; i <= 50; ++i) {
+        const double mid = 1.0 + 0.001 * (i % 7);
+        table.onQuote(0, mid);
+        const double s = mid - 1.1 * 1.2;
+        const double d = s - mean;
+        mean += kAlpha * d;
+        var = (1.0 - kAlpha) * (var + kAlpha * d * d);
+    }
+    CHECK(table.zScore(1) == z1);
+    CHECK(std::abs(table.zScore(0) - (table.spread(0) - mean) / std::sqrt(var)) < 1e-9);
+
+    // Re-scoring without statistics leaves them alone.
+    table.onQuote(4, 1.41, false);
+    table.onQuote(4, 1.40, false);
+    CHECK(table.zScore(1) == z1);
+}
+
+TEST_CASE(triangleKernelsAgreeWithScalar) {
+    const KernelIsa best = TriangleTable::detectKernel();
+    for (const std::size_t triangles : {5u, 64u, 301u}) {
+        const std::vector<double> reference = randomRun(KernelIsa::SCALAR, triangles, 5'000);
+        for (const KernelIsa isa : {KernelIsa::AVX2, KernelIsa::AVX512}) {
+            if (static_cast<uint8_t>(isa) > static_cast<uint8_t>(best)) continue;
+            const std::vector<double> z = randomRun(isa, triangles, 5'000);
+            double maxDiff = 0.0;
+            for (std::size_t i = 0; i < triangles; ++i) maxDiff = std::max(maxDiff, std::abs(z[i] - reference[i]));
+            CHECK(maxDiff < 1e-6);
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// test_wire_format.cpp
+#include "TestHarness.hpp"
+#include "core/messaging/WireFormat.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace hft::core::messaging;
+
+namespace {
+
+XAlgo::Data::MarketData sampleMarketData(std::size_t depth) {
+    XAlgo::Data::MarketData md;
+    md.symbol_id = TradingSystem::internSymbol("EUR/USD");
+    md.bid_price = 1.12340;
+    md.ask_price = 1.12342;
+    md.mid_price = 1.12341;
+    md.last_price = 1.12341;
+    md.spread = 2e-5;
+    md.volume = 3.5e6;
+    md.timestamp = std::chrono::system_clock::now();
+    for (std::size_t i = 0; i < depth; ++i) {
+        md.book.bids.push_back({1.12340 - 1e-5 * static_cast<double>(i), 1e6 + static_cast<double>(i)});
+        md.book.asks.push_back({1.12342 + 1e-5 * static_cast<double>(i), 2e6 + static_cast<double>(i)});
+    }
+    return md;
+}
+
+// The free-form text payload consumers parse today.
+std::string toText(const XAlgo::Data::MarketData& md) {
+    char buf[1024];
+    int n = std::snprintf(buf, sizeof(buf), "%s,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%lld,%zu",
+                          TradingSystem::symbolName(md.symbol_id).c_str(), md.last_price, md.mid_price, md.bid_price, md.ask_price, md.spread,
+                          md.volume, static_cast<long long>(md.timestamp.time_since_epoch().count()),
+                          md.book.bids.size());
+    for (const auto& l : md.book.bids) n += std::snprintf(buf + n, sizeof(buf) - n, ",%.17g,%.17g", l.price, l.volume);
+    n += std::snprintf(buf + n, sizeof(buf) - n, ",%zu", md.book.asks.size());
+    for (const auto& l : md.book.asks) n += std::snprintf(buf + n, sizeof(buf) - n, ",%.17g,%.17g", l.price, l.volume);
+    return std::string(buf, static_cast<std::size_t>(n));
+}
+
+void fromText(const std::string& text, XAlgo::Data::MarketData& md) {
+    const char* p = text.c_str();
+    const char* comma = std::strchr(p, ',');
+    md.symbol_id = TradingSystem::symbolRegistry().find(std::string_view(p, static_cast<std::size_t>(comma - p)));
+    char* end = const_cast<char*>(comma);
+    auto next = [&] { return std::strtod(end + 1, &end); };
+    md.last_price = next();
+    md.mid_price = next();
+    md.bid_price = next();
+    md.ask_price = next();
+    md.spread = next();
+    md.volume = next();
+    md.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::system_clock::duration(std::strtoll(end + 1, &end, 10)));
+    md.book.bids.resize(static_cast<std::size_t>(next()));
+    for (auto& l : md.book.bids) { l.price = next(); l.volume = next(); }
+    md.book.asks.resize(static_cast<std::size_t>(next()));
+    for (auto& l : md.book.asks) { l.price = next(); l.volume = next(); }
+}
+
+} // namespace
+
+TEST_CASE(wireRoundTripsTickOrderAndExecutionReport) {
+    char buf[128];
+
+    const TradingSystem::TickData tick{1.1234, 1.3100, 0.8560, std::chrono::steady_clock::now()};
+    const std::size_t tickLen = wire::encode(tick, buf, sizeof(buf));
+    CHECK(tickLen == wire::MessageHeader::kSize + wire::TickEncoder::kBlockLength);
+    TradingSystem::TickData tickOut{};
+    CHECK(wire::decode(buf, tickLen, tickOut));
+    CHECK(tickOut.eurUsd == tick.eurUsd && tickOut.gbpUsd == tick.gbpUsd && tickOut.eurGbp == tick.eurGbp);
+    CHECK(tickOut.timestamp == tick.timestamp);
+
+    const TradingSystem::Order order(42, TradingSystem::internSymbol("GBP/USD"), 1.31, 500'000, TradingSystem::OrderSide::SELL,
+                                     TradingSystem::OrderType::LIMIT);
+    const std::size_t orderLen = wire::encode(order, buf, sizeof(buf));
+    wire::OrderDecoder orderDec;
+    CHECK(orderDec.wrap(buf, orderLen));
+    CHECK(orderDec.orderId() == 42 && orderDec.symbol() == "GBP/USD");
+    CHECK(orderDec.price() == 1.31 && orderDec.quantity() == 500'000);
+    CHECK(orderDec.side() == TradingSystem::OrderSide::SELL && orderDec.type() == TradingSystem::OrderType::LIMIT);
+
+    const LegReport report{2, LegOutcome::PARTIAL, 400'000, 0.856, 7};
+    const std::size_t reportLen = wire::encode(42, report, 123, buf, sizeof(buf));
+    LegReport reportOut;
+    CHECK(wire::decode(buf, reportLen, reportOut));
+    CHECK(reportOut.leg == 2 && reportOut.outcome == LegOutcome::PARTIAL);
+    CHECK(reportOut.filledQuantity == 400'000 && reportOut.price == 0.856);
+    CHECK(reportOut.execution == 7);   // the manager matches reports to its execution by this
+
+    // A version 1 writer's 40-byte block still decodes, with no execution number.
+    char v1[wire::MessageHeader::kSize + 40];
+    std::memcpy(v1, buf, sizeof(v1));
+    const uint16_t v1Block = 40, v1Version = 1;
+    std::memcpy(v1, &v1Block, 2);
+    std::memcpy(v1 + 6, &v1Version, 2);
+    LegReport legacy;
+    legacy.execution = 99;
+    CHECK(wire::decode(v1, sizeof(v1), legacy));
+    CHECK(legacy.leg == 2 && legacy.price == 0.856 && legacy.execution == 0);
+    // A report is not a tick, however the bytes line up.
+    CHECK(!wire::decode(buf, reportLen, tickOut));
+}
+
+TEST_CASE(wireMarketDataRoundTripsInPlaceWithoutAllocating) {
+    const XAlgo::Data::MarketData md = sampleMarketData(5);
+    std::vector<char> buf(512);
+    const std::size_t len = wire::encode(md, buf.data(), buf.size());
+    CHECK(len == wire::MessageHeader::kSize + wire::MarketDataEncoder::kBlockLength + 2 * 4 + 10 * 16);
+
+    XAlgo::Data::MarketData out = sampleMarketData(5);   // warm capacity, as a reused consumer would be
+    const uint64_t before = TestHarness::allocationCount();
+    for (int i = 0; i < 1000; ++i) {
+        CHECK(wire::encode(md, buf.data(), buf.size()) == len);
+        CHECK(wire::decode(buf.data(), len, out));
+    }
+    CHECK(TestHarness::allocationCount() == before);
+
+    CHECK(out.symbol_id == md.symbol_id && out.bid_price == md.bid_price && out.volume == md.volume);
+    CHECK(out.timestamp == md.timestamp);
+    CHECK(out.book.bids.size() == 5 && out.book.asks.size() == 5);
+    CHECK(out.book.bids[4].price == md.book.bids[4].price && out.book.asks[3].volume == md.book.asks[3].volume);
+
+    // Too small a buffer fails cleanly on either side.
+    CHECK(wire::encode(md, buf.data(), len - 1) == 0);
+    CHECK(!wire::decode(buf.data(), len - 1, out));
+}
+
+TEST_CASE(wireDecoderSkipsFieldsAppendedByNewerVersions) {
+    const XAlgo::Data::MarketData md = sampleMarketData(2);
+    char v1[256];
+    const std::size_t len = wire::encode(md, v1, sizeof(v1));
+
+    // A v2 writer appended an 8-byte field to the root block.
+    constexpr std::size_t kRoot = wire::MessageHeader::kSize + wire::MarketDataEncoder::kBlockLength;
+    CHECK(len > kRoot);
+    if (len <= kRoot) return;
+    char v2[264] = {};
+    std::memcpy(v2, v1, kRoot);
+    const uint16_t blockLength = wire::MarketDataEncoder::kBlockLength + 8;
+    const uint16_t version = 2;
+    std::memcpy(v2, &blockLength, 2);
+    std::memcpy(v2 + 6, &version, 2);
+    std::memcpy(v2 + kRoot + 8, v1 + kRoot, len - kRoot);
+
+    wire::MarketDataDecoder dec;
+    CHECK(dec.wrap(v2, len + 8));
+    CHECK(dec.actingVersion() == 2);
+    CHECK(dec.symbol() == "EUR/USD");
+    CHECK(dec.bidCount() == 2 && dec.askCount() == 2);
+    CHECK(dec.ask(1).price == md.book.asks[1].price);
+}
+
+TEST_CASE(wireFormatThroughputAgainstTextPayloads) {
+    constexpr int kMessages = 20'000;
+    const XAlgo::Data::MarketData md = sampleMarketData(5);
+    XAlgo::Data::MarketData out = sampleMarketData(5);
+    double sink = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMessages; ++i) {
+        const std::string text = toText(md);
+        fromText(text, out);
+        sink += out.book.asks[4].price;
+    }
+    const double textPerSec = kMessages / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    CHECK(out.book.bids[2].volume == md.book.bids[2].volume);
+
+    char buf[512];
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMessages; ++i) {
+        const std::size_t len = wire::encode(md, buf, sizeof(buf));
+        wire::decode(buf, len, out);
+        sink += out.book.asks[4].price;
+    }
+    const double binaryPerSec = kMessages / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "  market data round trip: text " << textPerSec / 1e6 << " M msgs/s, binary "
+              << binaryPerSec / 1e6 << " M msgs/s (" << binaryPerSec / textPerSec << "x)\n";
+    CHECK(binaryPerSec > textPerSec);
+    CHECK(sink > 0.0);
+}
@@ -0,0 +1,154 @@
+// test_zmq_message.cpp
+#include "TestHarness.hpp"
+#include "core/messaging/ZmqMessage.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace hft::core::messaging;
+
+namespace {
+
+/// @brief What the receive loop does per message: recv() rebuilds the slot's frames in place.
+void receiveInto(ZmqMessage& slot, std::string_view topic, std::string_view payload) {
+    slot.topicFrame.rebuild(topic.data(), topic.size());
+    slot.payloadFrame.rebuild(payload.data(), payload.size());
+}
+
+/// @brief Handler whose state is poisoned on destruction, so a call into a retired
+/// handler shows up as a changed tag (and as a use-after-free under ASan).
+struct VersionedHandler {
+    static constexpr uint64_t kAlive = 0x600DF00D;
+
+    uint64_t version;
+    std::atomic<uint64_t>* lastSeen;
+    std::atomic<uint64_t>* violations;
+    std::vector<uint64_t> tag = std::vector<uint64_t>(4, kAlive);
+
+    VersionedHandler(uint64_t v, std::atomic<uint64_t>& seen, std::atomic<uint64_t>& bad)
+        : version(v), lastSeen(&seen), violations(&bad) {}
+    VersionedHandler(const VersionedHandler&) = default;
+    ~VersionedHandler() { tag.assign(tag.size(), 0); }
+
+    void operator()(ZmqMessage&) const {
+        const bool before = tag[0] == kAlive;
+        std::this_thread::yield();   // give the swapping thread a chance to retire us mid-call
+        if (!before || tag[3] != kAlive || lastSeen->exchange(version) > version) ++*violations;
+    }
+};
+
+} // namespace
+
+TEST_CASE(dispatcherDeliversToTheInstalledHandler) {
+    std::vector<ZmqMessage> batch(3);
+    receiveInto(batch[0], "md.EURUSD", "1.1");
+    receiveInto(batch[1], "md.GBPUSD", "1.3");
+    receiveInto(batch[2], "md.EURGBP", "0.85");
+
+    MessageDispatcher dispatcher;
+    CHECK(!dispatcher.dispatch(batch[0]));
+    CHECK(!dispatcher.dispatch(MessageBatch(batch.data(), batch.size())));
+
+    std::vector<std::string> topics;
+    dispatcher.setHandler([&](ZmqMessage& m) { topics.emplace_back(m.topic()); });
+    CHECK(dispatcher.dispatch(MessageBatch(batch.data(), batch.size())));
+    CHECK(topics.size() == 3 && topics[0] == "md.EURUSD" && topics[2] == "md.EURGBP");
+
+    // A batch handler replaces the per-message one and sees the whole run in one call.
+    std::size_t calls = 0, seen = 0;
+    dispatcher.setBatchHandler([&](const MessageBatch& b) {
+        ++calls;
+        seen += b.size();
+    });
+    CHECK(dispatcher.dispatch(MessageBatch(batch.data(), batch.size())));
+    CHECK(dispatcher.dispatch(batch[1]));
+    CHECK(calls == 2 && seen == 4 && topics.size() == 3);
+
+    dispatcher.setHandler(nullptr);
+    CHECK(!dispatcher.dispatch(batch[0]));
+}
+
+TEST_CASE(dispatcherSwapsHandlersWhileAnotherThreadDispatches) {
+    std::vector<ZmqMessage> batch(4);
+    for (ZmqMessage& m : batch) receiveInto(m, "md.EURUSD", "1.1");
+
+    std::atomic<uint64_t> lastSeen{0}, violations{0}, dispatched{0};
+    std::atomic<bool> stop{false};
+    MessageDispatcher dispatcher;
+    dispatcher.setHandler(VersionedHandler(0, lastSeen, violations));
+
+    std::thread receiver([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            dispatcher.dispatch(MessageBatch(batch.data(), batch.size()));
+            ++dispatched;
+            // Yield outside the read guard so a single-core runner can still publish.
+            std::this_thread::yield();
+        }
+    });
+
+    while (dispatched.load() == 0) std::this_thread::yield();
+    constexpr uint64_t kSwaps = 500;
+    for (uint64_t v = 1; v <= kSwaps; ++v) {
+        dispatcher.setHandler(VersionedHandler(v, lastSeen, violations));
+        std::this_thread::yield();
+    }
+    // Once set returns, the old handlers are gone: the next dispatch sees the last one.
+    const uint64_t after = dispatched.load();
+    while (dispatched.load() < after + 2) std::this_thread::yield();
+    stop.store(true);
+    receiver.join();
+
+    CHECK(violations.load() == 0);
+    CHECK(lastSeen.load() == kSwaps);
+}
+
+TEST_CASE(handlerMayMoveMessagesOutAndSlotsAreReused) {
+    // Slot 0 as the ZMQ loop fills it, slot 1 as the shared-memory loop does.
+    constexpr std::size_t kMaxMessage = 64;
+    std::vector<ZmqMessage> batch(2);
+    receiveInto(batch[0], "md.EURUSD", "1.1");
+    const std::string_view shm = "md.GBPUSD1.3";
+    batch[1].local.assign(shm.begin(), shm.end());
+    batch[1].local.resize(kMaxMessage);
+    batch[1].localTopicLength = 9;
+    batch[1].localPayloadLength = 3;
+    batch[1].isLocal = true;
+
+    std::vector<ZmqMessage> kept;
+    kept.reserve(4);
+    MessageDispatcher dispatcher;
+    dispatcher.setHandler([&](ZmqMessage& m) { kept.push_back(std::move(m)); });
+    CHECK(dispatcher.dispatch(MessageBatch(batch.data(), batch.size())));
+
+    CHECK(kept.size() == 2);
+    CHECK(kept[0].topic() == "md.EURUSD" && kept[0].payload() == "1.1");
+    CHECK(kept[1].topic() == "md.GBPUSD" && kept[1].payload() == "1.3");
+    // Moved-from slots are empty but valid: frames of size 0, no local storage.
+    CHECK(batch[0].topicFrame.size() == 0 && batch[0].payloadFrame.size() == 0);
+    CHECK(batch[1].local.size() < kMaxMessage);
+
+    // Next batch into the same slots, as listenLoop / shmListenLoop refill them.
+    receiveInto(batch[0], "md.USDJPY", "150.2");
+    if (batch[1].local.size() < kMaxMessage) {
+        batch[1].local.resize(kMaxMessage);
+        batch[1].isLocal = true;
+    }
+    const std::string_view next = "md.EURGBP0.85";
+    std::copy(next.begin(), next.end(), batch[1].local.begin());
+    batch[1].localTopicLength = 9;
+    batch[1].localPayloadLength = 4;
+
+    std::vector<std::string> seen;
+    dispatcher.setHandler([&](ZmqMessage& m) { seen.emplace_back(std::string(m.topic()) + "=" + std::string(m.payload())); });
+    CHECK(dispatcher.dispatch(MessageBatch(batch.data(), batch.size())));
+    CHECK(seen.size() == 2 && seen[0] == "md.USDJPY=150.2" && seen[1] == "md.EURGBP=0.85");
+
+    // The messages taken earlier do not alias the reused slots.
+    CHECK(kept[0].topic() == "md.EURUSD" && kept[0].payload() == "1.1");
+    CHECK(kept[1].topic() == "md.GBPUSD" && kept[1].payload() == "1.3");
+}